@@ -0,0 +1,238 @@
+"""
+Export the dense autoencoder as int8 tables for the native firmware engine.
+
+The firmware does not run a TFLite interpreter; it executes the
+128->64->24->8->24->64->128 autoencoder directly with per-channel int8
+weights. This script:
+- Loads float dense weights from a Keras model saved by
+  train_tflm_autoencoder.py (--keras-model), or trains the same architecture
+  with a small numpy Adam loop when TensorFlow is not available.
+- Calibrates per-tensor int8 activation ranges on features.npz.
+- Quantizes weights per output channel (symmetric) and folds the input
+  zero-point into int32 biases.
+- Emits firmware/include/autoencoder_model_data.hpp plus golden vectors
+  (input, float-model MSE, int8-model MSE) for tests/test_autoencoder.cpp.
+
+The int8 forward pass here mirrors firmware/src/autoencoder.cpp bit for bit.
+"""
+
+import argparse
+import pathlib
+
+import numpy as np
+
+FEATURES = pathlib.Path("data/processed/features.npz")
+HEADER = pathlib.Path("../firmware/include/autoencoder_model_data.hpp")
+GOLDEN = pathlib.Path("../firmware/tests/autoencoder_golden.txt")
+LAYER_DIMS = [128, 64, 24, 8, 24, 64, 128]
+
+
+def load_keras_weights(path: pathlib.Path):
+    import tensorflow as tf
+
+    model = tf.keras.models.load_model(path)
+    dense = [l for l in model.layers if isinstance(l, tf.keras.layers.Dense)]
+    # Keras kernels are [in, out]; the firmware stores [out, in].
+    return [(l.get_weights()[0].T.astype(np.float64), l.get_weights()[1].astype(np.float64)) for l in dense]
+
+
+def forward_float(layers, x: np.ndarray) -> np.ndarray:
+    for i, (w, b) in enumerate(layers):
+        x = x @ w.T + b
+        if i + 1 < len(layers):
+            x = np.maximum(x, 0.0)
+    return x
+
+
+def train_numpy(x: np.ndarray, epochs: int, seed: int, lr: float = 1e-3, batch: int = 32):
+    rng = np.random.default_rng(seed)
+    layers = []
+    for fan_in, fan_out in zip(LAYER_DIMS[:-1], LAYER_DIMS[1:]):
+        limit = np.sqrt(6.0 / (fan_in + fan_out))  # glorot_uniform, as Keras Dense
+        layers.append([rng.uniform(-limit, limit, (fan_out, fan_in)), np.zeros(fan_out)])
+    m = [[np.zeros_like(w), np.zeros_like(b)] for w, b in layers]
+    v = [[np.zeros_like(w), np.zeros_like(b)] for w, b in layers]
+    beta1, beta2, eps, step = 0.9, 0.999, 1e-7, 0
+
+    for _ in range(epochs):
+        order = rng.permutation(len(x))
+        for start in range(0, len(x), batch):
+            xb = x[order[start : start + batch]]
+            acts = [xb]
+            for i, (w, b) in enumerate(layers):
+                z = acts[-1] @ w.T + b
+                acts.append(np.maximum(z, 0.0) if i + 1 < len(layers) else z)
+            grad = 2.0 * (acts[-1] - xb) / acts[-1].size
+            step += 1
+            for i in reversed(range(len(layers))):
+                if i + 1 < len(layers):
+                    grad = grad * (acts[i + 1] > 0)
+                gw = grad.T @ acts[i]
+                gb = grad.sum(axis=0)
+                grad = grad @ layers[i][0]
+                for j, g in enumerate((gw, gb)):
+                    m[i][j] = beta1 * m[i][j] + (1 - beta1) * g
+                    v[i][j] = beta2 * v[i][j] + (1 - beta2) * g * g
+                    m_hat = m[i][j] / (1 - beta1**step)
+                    v_hat = v[i][j] / (1 - beta2**step)
+                    layers[i][j] -= lr * m_hat / (np.sqrt(v_hat) + eps)
+    return [(w, b) for w, b in layers]
+
+
+def activation_qparams(lo: float, hi: float):
+    lo, hi = min(lo, 0.0), max(hi, 0.0)
+    scale = (hi - lo) / 255.0 if hi > lo else 1.0
+    zero_point = int(np.clip(np.round(-128 - lo / scale), -128, 127))
+    return scale, zero_point
+
+
+def quantize_multiplier(m: float):
+    """Returns (q31 multiplier, shift) with m = mult * 2^(shift - 31)."""
+    if m == 0.0:
+        return 0, 0
+    mant, shift = np.frexp(m)
+    mult = int(np.round(mant * (1 << 31)))
+    if mult == (1 << 31):
+        mult //= 2
+        shift += 1
+    return mult, int(shift)
+
+
+def quantize(layers, calib: np.ndarray):
+    # Activation ranges: input is fixed to [0, 1] by the feature contract.
+    ranges = [(0.0, 1.0)]
+    x = calib
+    for i, (w, b) in enumerate(layers):
+        x = x @ w.T + b
+        if i + 1 < len(layers):
+            x = np.maximum(x, 0.0)
+        ranges.append((float(x.min()), float(x.max())))
+    act = [activation_qparams(lo, hi) for lo, hi in ranges]
+
+    qlayers = []
+    for i, (w, b) in enumerate(layers):
+        s_in, zp_in = act[i]
+        s_out, zp_out = act[i + 1]
+        w_scale = np.maximum(np.abs(w).max(axis=1), 1e-12) / 127.0
+        wq = np.clip(np.round(w / w_scale[:, None]), -127, 127).astype(np.int64)
+        bq = np.round(b / (s_in * w_scale)).astype(np.int64)
+        bq -= zp_in * wq.sum(axis=1)
+        mults, shifts = zip(*(quantize_multiplier(s_in * ws / s_out) for ws in w_scale))
+        qlayers.append(
+            {
+                "w": wq,
+                "bias": bq,
+                "mult": np.array(mults, dtype=np.int64),
+                "shift": np.array(shifts, dtype=np.int64),
+                "zp_out": zp_out,
+                "relu": i + 1 < len(layers),
+            }
+        )
+    return act, qlayers
+
+
+def quantize_input(x: np.ndarray, scale: float, zero_point: int) -> np.ndarray:
+    # Same rounding as the firmware: floor(x / scale + 0.5).
+    return np.clip(np.floor(x / scale + 0.5) + zero_point, -128, 127).astype(np.int64)
+
+
+def forward_int8(act, qlayers, x: np.ndarray) -> np.ndarray:
+    q = quantize_input(x, *act[0])
+    for layer in qlayers:
+        acc = q @ layer["w"].T + layer["bias"]
+        total_shift = 31 - layer["shift"]
+        prod = acc * layer["mult"] + (np.int64(1) << (total_shift - 1))
+        out = (prod >> total_shift) + layer["zp_out"]
+        lo = layer["zp_out"] if layer["relu"] else -128
+        q = np.clip(out, lo, 127)
+    s_out, zp_out = act[-1]
+    return (q - zp_out).astype(np.float32) * np.float32(s_out)
+
+
+def emit_array(f, ctype: str, name: str, values, per_line: int = 16):
+    values = list(values)
+    f.write(f"constexpr {ctype} {name}[{len(values)}] = {{\n")
+    for i in range(0, len(values), per_line):
+        f.write("    " + ", ".join(str(int(v)) for v in values[i : i + per_line]) + ",\n")
+    f.write("};\n")
+
+
+def emit_header(path: pathlib.Path, act, qlayers, threshold: float, source: str):
+    with path.open("w") as f:
+        f.write("#pragma once\n\n")
+        f.write("// Generated by ai/scripts/export_autoencoder_int8.py -- do not edit.\n")
+        f.write(f"// Source: {source}\n\n")
+        f.write("#include <cstddef>\n#include <cstdint>\n\n")
+        f.write(f"constexpr std::size_t kAeLayerCount = {len(qlayers)};\n")
+        emit_array(f, "std::size_t", "kAeLayerDims", LAYER_DIMS)
+        f.write(f"constexpr float kAeInputScale = {act[0][0]:.9e}f;\n")
+        f.write(f"constexpr int32_t kAeInputZeroPoint = {act[0][1]};\n")
+        f.write(f"constexpr float kAeOutputScale = {act[-1][0]:.9e}f;\n")
+        f.write(f"constexpr int32_t kAeOutputZeroPoint = {act[-1][1]};\n")
+        f.write(f"// 99th percentile reconstruction MSE of the float model on normal windows.\n")
+        f.write(f"constexpr float kAeMseThreshold = {threshold:.9e}f;\n")
+        for i, layer in enumerate(qlayers):
+            f.write(f"\n// Layer {i}: {LAYER_DIMS[i]} -> {LAYER_DIMS[i + 1]}{' relu' if layer['relu'] else ''}\n")
+            f.write(f"constexpr int32_t kAeL{i}ZeroPoint = {layer['zp_out']};\n")
+            emit_array(f, "int8_t", f"kAeL{i}Weights", layer["w"].reshape(-1), per_line=32)
+            emit_array(f, "int32_t", f"kAeL{i}Bias", layer["bias"], per_line=8)
+            emit_array(f, "int32_t", f"kAeL{i}Multiplier", layer["mult"], per_line=8)
+            emit_array(f, "int8_t", f"kAeL{i}Shift", layer["shift"], per_line=32)
+    print(f"Wrote {path}")
+
+
+def emit_golden(path: pathlib.Path, x: np.ndarray, mse_float: np.ndarray, mse_int8: np.ndarray, labels: np.ndarray):
+    with path.open("w") as f:
+        f.write(f"{len(x)} {x.shape[1]}\n")
+        for row, mf, mq, label in zip(x, mse_float, mse_int8, labels):
+            f.write(f"{int(label)} {mf:.9e} {mq:.9e}\n")
+            f.write(" ".join(f"{v:.9e}" for v in row) + "\n")
+    print(f"Wrote {path} ({len(x)} vectors)")
+
+
+def main():
+    parser = argparse.ArgumentParser()
+    parser.add_argument("--features-path", type=str, default=str(FEATURES))
+    parser.add_argument("--keras-model", type=str, default="", help="Saved Keras autoencoder; numpy training if empty.")
+    parser.add_argument("--epochs", type=int, default=3000)
+    parser.add_argument("--seed", type=int, default=7)
+    parser.add_argument("--golden-count", type=int, default=24)
+    parser.add_argument("--header", type=str, default=str(HEADER))
+    parser.add_argument("--golden", type=str, default=str(GOLDEN))
+    args = parser.parse_args()
+
+    data = np.load(args.features_path)
+    x = data["X"].astype(np.float64)
+    y = data["y"]
+    normal = x[y == 0]
+
+    if args.keras_model:
+        layers = load_keras_weights(pathlib.Path(args.keras_model))
+        source = args.keras_model
+    else:
+        layers = train_numpy(normal, args.epochs, args.seed)
+        source = f"numpy Adam, {args.epochs} epochs, seed {args.seed}, normal windows of {args.features_path}"
+    dims = [w.shape[1] for w, _ in layers] + [layers[-1][0].shape[0]]
+    if dims != LAYER_DIMS:
+        raise SystemExit(f"{source}: layer dims {dims}, firmware expects {LAYER_DIMS}")
+
+    mse_float = np.mean((forward_float(layers, x) - x) ** 2, axis=1)
+    threshold = float(np.percentile(mse_float[y == 0], 99))
+    act, qlayers = quantize(layers, normal)
+    mse_int8 = np.mean((forward_int8(act, qlayers, x.astype(np.float32)) - x.astype(np.float32)) ** 2, axis=1)
+
+    flagged_f = mse_float > threshold
+    flagged_q = mse_int8 > threshold
+    print(f"float recall={flagged_f[y == 1].mean():.3f} fpr={flagged_f[y == 0].mean():.3f}")
+    print(f"int8  recall={flagged_q[y == 1].mean():.3f} fpr={flagged_q[y == 0].mean():.3f}")
+    print(f"int8 vs float MSE: max rel err={np.max(np.abs(mse_int8 - mse_float) / mse_float):.4f}")
+
+    emit_header(pathlib.Path(args.header), act, qlayers, threshold, source)
+    # Golden set: first N/2 normal and N/2 anomalous windows.
+    half = args.golden_count // 2
+    idx = np.concatenate([np.flatnonzero(y == 0)[:half], np.flatnonzero(y == 1)[:half]])
+    emit_golden(pathlib.Path(args.golden), x[idx].astype(np.float32), mse_float[idx], mse_int8[idx], y[idx])
+
+
+if __name__ == "__main__":
+    main()
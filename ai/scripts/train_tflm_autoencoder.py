@@ -2,7 +2,8 @@
 Milestone 6: Tiny autoencoder training + TFLite Micro export.
 
 This script:
-- Generates simple spectral feature windows (or uses synthetic signals)
+- Loads the 128-bin log-magnitude feature windows of extract_features.py
+  (or derives them from raw/synthetic waveforms)
 - Trains a tiny dense autoencoder (Keras)
 - Exports to TFLite
 - Emits a C header with a const uint8_t array for firmware
@@ -14,6 +15,7 @@ import numpy as np
 import tensorflow as tf
 
 RAW = pathlib.Path("data/raw")
+FEATURES = pathlib.Path("data/processed/features.npz")
 OUT = pathlib.Path("models")
 OUT.mkdir(exist_ok=True)
 
@@ -33,11 +35,24 @@ def load_or_generate(num_samples: int = 200, n: int = 256):
     return np.stack(X, axis=0)
 
 
-def to_features(waveforms: np.ndarray) -> np.ndarray:
-    fft = np.fft.rfft(waveforms, axis=1)
-    mag = np.abs(fft)
-    mag = mag / (np.max(mag, axis=1, keepdims=True) + 1e-6)
-    return mag.astype(np.float32)
+def to_features(waveforms: np.ndarray, fft_size: int = 256, bins: int = 128) -> np.ndarray:
+    # Same contract as the firmware's feature_vector_from_spectrum and
+    # extract_features.py: first `bins` bins of a `fft_size`-point FFT of the
+    # full-scale window, log1p, per-window max normalization. Longer waveforms
+    # are truncated and shorter ones zero-padded, as extract_rf_feature_vector does.
+    fft = np.fft.rfft(waveforms[:, :fft_size], n=fft_size, axis=1)
+    logmag = np.log1p(np.abs(fft[:, :bins]) + 1e-6)
+    logmag = logmag / (np.max(logmag, axis=1, keepdims=True) + 1e-6)
+    return logmag.astype(np.float32)
+
+
+def load_features(features_path: pathlib.Path) -> np.ndarray:
+    # Normal windows of features.npz, which export_autoencoder_int8.py also
+    # calibrates and scores on; raw waveforms only when it is missing.
+    if features_path.exists():
+        data = np.load(features_path)
+        return data["X"][data["y"] == 0].astype(np.float32)
+    return to_features(load_or_generate())
 
 
 def build_autoencoder(input_dim: int):
@@ -92,15 +107,19 @@ def main():
     parser.add_argument("--batch-size", type=int, default=32)
     parser.add_argument("--output", type=str, default="models/tiny_autoencoder.tflite")
     parser.add_argument("--header", type=str, default="models/tflm_model.h")
+    parser.add_argument("--keras-output", type=str, default="models/tiny_autoencoder.keras",
+                        help="Float model for export_autoencoder_int8.py (native firmware engine).")
+    parser.add_argument("--features-path", type=str, default=str(FEATURES),
+                        help="extract_features.py output; falls back to data/raw waveforms.")
     args = parser.parse_args()
 
-    waveforms = load_or_generate()
-    features = to_features(waveforms)
+    features = load_features(pathlib.Path(args.features_path))
 
     model = build_autoencoder(features.shape[1])
     model.fit(features, features, epochs=args.epochs, batch_size=args.batch_size, verbose=0)
     loss = model.evaluate(features, features, verbose=0)
     print(f"Training complete. Recon loss: {loss:.6f}")
+    model.save(args.keras_output)
 
     tflite_bytes = export_tflite(model, features, pathlib.Path(args.output))
     emit_c_array(tflite_bytes, pathlib.Path(args.header))
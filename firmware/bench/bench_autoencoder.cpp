@@ -0,0 +1,51 @@
+#include "autoencoder.hpp"
+
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <vector>
+
+// Reports microseconds per autoencoder inference (quantize, six dense layers,
+// dequantize + MSE) on the host, single-window and batched.
+int main() {
+    std::array<float, kAutoencoderInputs> features{};
+    for (std::size_t i = 0; i < features.size(); ++i) {
+        features[i] = static_cast<float>((i * 2654435761u) >> 24) / 255.0f;
+    }
+
+    constexpr std::size_t kWarmup = 1000;
+    constexpr std::size_t kReps = 50000;
+    float sink = 0.0f;
+    for (std::size_t r = 0; r < kWarmup; ++r) {
+        sink += autoencoder_reconstruction_error(features.data());
+    }
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t r = 0; r < kReps; ++r) {
+        features[r % features.size()] += 1e-7f;
+        sink += autoencoder_reconstruction_error(features.data());
+    }
+    const auto stop = std::chrono::steady_clock::now();
+    const double us = std::chrono::duration<double, std::micro>(stop - start).count() / static_cast<double>(kReps);
+    std::printf("autoencoder int8 128-64-24-8-24-64-128: %.3f us/inference, arena %zu bytes%s\n", us,
+                autoencoder_arena_bytes(), sink == 12345.0f ? " " : "");
+
+    // Batch form: each weight row is reused across a 4-window tile.
+    constexpr std::size_t kBatch = 16;
+    std::vector<float> batch_features(kBatch * kAutoencoderInputs);
+    for (std::size_t i = 0; i < batch_features.size(); ++i) {
+        batch_features[i] = features[i % features.size()];
+    }
+    std::vector<int8_t> scratch(autoencoder_batch_scratch_bytes(kBatch));
+    std::vector<float> mse(kBatch);
+    constexpr std::size_t kBatchReps = kReps / kBatch;
+    const auto batch_start = std::chrono::steady_clock::now();
+    for (std::size_t r = 0; r < kBatchReps; ++r) {
+        autoencoder_reconstruction_error_batch(batch_features.data(), kBatch, scratch.data(), mse.data());
+        sink += mse[r % kBatch];
+    }
+    const auto batch_stop = std::chrono::steady_clock::now();
+    const double batch_us = std::chrono::duration<double, std::micro>(batch_stop - batch_start).count() /
+                            static_cast<double>(kBatchReps * kBatch);
+    std::printf("autoencoder int8 batch=%zu: %.3f us/inference%s\n", kBatch, batch_us, sink == 12345.0f ? " " : "");
+    return 0;
+}
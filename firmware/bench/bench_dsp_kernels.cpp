@@ -0,0 +1,52 @@
+#include "dsp_kernels.hpp"
+
+#include <chrono>
+#include <complex>
+#include <cstdio>
+#include <vector>
+
+// Compares the feature-tail kernels per ISA over a gateway-sized rescoring batch.
+int main() {
+    constexpr std::size_t kBins = 2049; // N=4096 real FFT
+    constexpr std::size_t kReps = 4000;
+    std::vector<std::complex<float>> bins(kBins);
+    for (std::size_t k = 0; k < kBins; ++k) {
+        bins[k] = {static_cast<float>(k % 97) - 48.0f, static_cast<float>(k % 31) - 15.0f};
+    }
+    std::vector<float> mags(kBins);
+    std::vector<float> logs(kBins);
+
+    std::printf("%8s %16s %16s %16s\n", "isa", "mag_sq ns/bin", "mag_stats ns/bin", "log10 ns/bin");
+    for (DspIsa isa : {DspIsa::Scalar, DspIsa::Sse2, DspIsa::Avx2, DspIsa::Neon}) {
+        if (!dsp_select_isa(isa)) {
+            continue;
+        }
+        float sink = 0.0f;
+        auto start = std::chrono::steady_clock::now();
+        for (std::size_t r = 0; r < kReps; ++r) {
+            dsp_magnitude_squared(bins.data(), kBins, mags.data());
+            sink += mags[r % kBins];
+        }
+        auto stop = std::chrono::steady_clock::now();
+        const double sq_ns = std::chrono::duration<double, std::nano>(stop - start).count() / (kReps * kBins);
+
+        start = std::chrono::steady_clock::now();
+        for (std::size_t r = 0; r < kReps; ++r) {
+            sink += dsp_magnitude_stats(bins.data(), kBins, 1.0f / 4096.0f, mags.data()).sum;
+        }
+        stop = std::chrono::steady_clock::now();
+        const double stats_ns = std::chrono::duration<double, std::nano>(stop - start).count() / (kReps * kBins);
+
+        start = std::chrono::steady_clock::now();
+        for (std::size_t r = 0; r < kReps; ++r) {
+            dsp_log10(mags.data(), kBins, logs.data());
+            sink += logs[r % kBins];
+        }
+        stop = std::chrono::steady_clock::now();
+        const double log_ns = std::chrono::duration<double, std::nano>(stop - start).count() / (kReps * kBins);
+
+        std::printf("%8s %16.3f %16.3f %16.3f%s\n", dsp_isa_name(isa), sq_ns, stats_ns, log_ns,
+                    sink == 12345.0f ? " " : "");
+    }
+    return 0;
+}
@@ -0,0 +1,113 @@
+#include "fft.hpp"
+#include "fft_q15.hpp"
+#include "model_inference.hpp"
+#include "rf_batch.hpp"
+
+#include <chrono>
+#include <complex>
+#include <cstdio>
+#include <vector>
+
+namespace {
+double time_features(RfFeatureBackend backend, const RFSampleWindow& window) {
+    set_rf_feature_backend(backend);
+    constexpr std::size_t kReps = 20000;
+    float sink = 0.0f;
+    const auto start = std::chrono::steady_clock::now();
+    for (std::size_t r = 0; r < kReps; ++r) {
+        sink += extract_rf_features(window).peak_dbm;
+    }
+    const auto stop = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::micro>(stop - start).count() / static_cast<double>(kReps) +
+           (sink == 12345.0f ? 1.0 : 0.0);
+}
+} // namespace
+
+// Reports microseconds per window for the complex, real-input and Q15 FFTs, then
+// the full extract_rf_features cost per backend (including a 4/8-bin Goertzel
+// bank) at the default window size, and batch scoring per window.
+int main() {
+    FftPlan plan;
+    FftPlanQ15 plan_q15;
+    if (!fft_plan_init(plan, kMaxFftSize) || !fft_plan_init_q15(plan_q15, kMaxFftSize)) {
+        return 1;
+    }
+
+    std::printf("%8s %14s %14s %14s\n", "N", "complex us/win", "real us/win", "q15 us/win");
+    for (std::size_t n = 64; n <= kMaxFftSize; n <<= 1) {
+        std::vector<int16_t> samples(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            samples[i] = static_cast<int16_t>(static_cast<int>((i * 2654435761u) >> 20) % 4096 - 2048);
+        }
+        std::vector<std::complex<float>> work(n);
+        std::vector<int16_t> work_q15(n + 2);
+        const std::size_t reps = (1u << 22) / n;
+        float sink = 0.0f;
+
+        auto start = std::chrono::steady_clock::now();
+        for (std::size_t r = 0; r < reps; ++r) {
+            for (std::size_t i = 0; i < n; ++i) {
+                work[i] = {static_cast<float>(samples[i]), 0.0f};
+            }
+            fft_complex(plan, work.data(), n);
+            sink += work[1].real();
+        }
+        auto stop = std::chrono::steady_clock::now();
+        const double complex_us = std::chrono::duration<double, std::micro>(stop - start).count() / static_cast<double>(reps);
+
+        start = std::chrono::steady_clock::now();
+        for (std::size_t r = 0; r < reps; ++r) {
+            fft_real(plan, samples.data(), n, n, work.data());
+            sink += work[1].real();
+        }
+        stop = std::chrono::steady_clock::now();
+        const double real_us = std::chrono::duration<double, std::micro>(stop - start).count() / static_cast<double>(reps);
+
+        start = std::chrono::steady_clock::now();
+        for (std::size_t r = 0; r < reps; ++r) {
+            int exponent = 0;
+            fft_real_q15(plan_q15, samples.data(), n, n, work_q15.data(), exponent);
+            sink += static_cast<float>(work_q15[2] + exponent);
+        }
+        stop = std::chrono::steady_clock::now();
+        const double q15_us = std::chrono::duration<double, std::micro>(stop - start).count() / static_cast<double>(reps);
+
+        std::printf("%8zu %14.3f %14.3f %14.3f%s\n", n, complex_us, real_us, q15_us, sink == 12345.0f ? " " : "");
+    }
+
+    RFSampleWindow window{};
+    window.sample_count = kMaxRfSamples;
+    for (std::size_t i = 0; i < window.sample_count; ++i) {
+        window.samples[i] = static_cast<int16_t>(static_cast<int>((i * 2654435761u) >> 20) % 4096 - 2048);
+    }
+    init_model_inference();
+    std::printf("\nextract_rf_features N=%zu: real %.3f us, complex %.3f us, q15 %.3f us\n", kMaxRfSamples,
+                time_features(RfFeatureBackend::RealFft, window),
+                time_features(RfFeatureBackend::ComplexFft, window),
+                time_features(RfFeatureBackend::FixedQ15, window));
+
+    const uint16_t watched[] = {5, 12, 19, 26, 33, 40, 47, 54};
+    for (std::size_t count : {std::size_t{4}, std::size_t{8}}) {
+        set_goertzel_bins(watched, count);
+        std::printf("extract_rf_features N=%zu: goertzel %zu bins %.3f us\n", kMaxRfSamples, count,
+                    time_features(RfFeatureBackend::GoertzelBank, window));
+    }
+
+    // Batch scoring: per-window cost when twiddles are shared across a batch.
+    std::vector<RFSampleWindow> windows(64, window);
+    std::vector<RFEvent> events(windows.size());
+    for (std::size_t batch : {std::size_t{1}, std::size_t{8}, std::size_t{32}}) {
+        RfBatchWorkspace ws;
+        rf_batch_init(ws, kMaxRfSamples, batch);
+        constexpr std::size_t kReps = 500;
+        const auto start = std::chrono::steady_clock::now();
+        for (std::size_t r = 0; r < kReps; ++r) {
+            rf_batch_score(ws, windows.data(), windows.size(), events.data());
+        }
+        const auto stop = std::chrono::steady_clock::now();
+        const double us = std::chrono::duration<double, std::micro>(stop - start).count() /
+                          static_cast<double>(kReps * windows.size());
+        std::printf("rf_batch_score N=%zu batch=%zu: %.3f us/window\n", kMaxRfSamples, batch, us);
+    }
+    return 0;
+}
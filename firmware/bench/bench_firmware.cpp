@@ -0,0 +1,334 @@
+#include "bench_harness.hpp"
+
+#include "crypto.hpp"
+#include "decimator.hpp"
+#include "dsp_kernels.hpp"
+#include "fft.hpp"
+#include "mesh_encode.hpp"
+#include "model_inference.hpp"
+#include "prescreen.hpp"
+#include "telemetry.hpp"
+
+#include <cmath>
+#include <complex>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+// End-to-end stage benchmarks: FFT magnitude, CIC/FIR decimation, feature
+// extraction, the energy pre-screen, inference, mesh encode/decode and AES-GCM at several sizes.
+//
+//   bench_firmware [--json out.json] [--baseline base.json] [--max-regression pct] [--quick]
+//
+// With --baseline, each stage's median is compared to the stored run and the
+// exit code is 1 if any stage regressed by more than --max-regression (default 15%).
+namespace {
+RFSampleWindow make_window(std::size_t count) {
+    RFSampleWindow w{};
+    w.timestamp_ms = 1000;
+    w.center_freq_hz = 915000000;
+    w.sample_count = count;
+    for (std::size_t i = 0; i < count; ++i) {
+        w.samples[i] = static_cast<int16_t>(static_cast<int>((i * 2654435761u) >> 20) % 4096 - 2048);
+    }
+    return w;
+}
+
+MeshFrame make_frame(MeshMsgType type, std::size_t routes) {
+    MeshFrame f{};
+    f.header.version = 1;
+    f.header.msg_type = type;
+    f.header.ttl = 4;
+    f.header.seq_no = 42;
+    std::snprintf(f.header.src_node_id, sizeof(f.header.src_node_id), "node-bench");
+    std::snprintf(f.header.dest_node_id, sizeof(f.header.dest_node_id), "gw");
+    f.security.encrypted = true;
+    for (std::size_t i = 0; i < f.security.nonce.size(); ++i) {
+        f.security.nonce[i] = static_cast<uint8_t>(i + 1);
+    }
+    f.telemetry.rf_event.features = {-55.5f, -42.0f};
+    f.telemetry.rf_event.anomaly_score = 0.12f;
+    f.telemetry.gps.valid_fix = true;
+    f.telemetry.health.battery_v = 3.8f;
+    f.routing.entry_count = routes;
+    for (std::size_t i = 0; i < routes; ++i) {
+        f.routing.entries[i].neighbor_id[0] = 'p';
+        f.routing.entries[i].neighbor_id[1] = static_cast<char>('0' + i);
+        f.routing.entries[i].rssi_dbm = static_cast<int8_t>(-60 - static_cast<int>(i));
+        f.routing.entries[i].link_quality = 200;
+        f.routing.entries[i].cost = static_cast<uint8_t>(i + 1);
+    }
+    return f;
+}
+
+int compare_with_baseline(const std::vector<BenchResult>& results, const char* path, double max_regression_pct) {
+    const std::vector<BenchResult> baseline = bench_read_json(path);
+    if (baseline.empty()) {
+        std::fprintf(stderr, "baseline %s missing or empty\n", path);
+        return 1;
+    }
+    int regressions = 0;
+    std::printf("\n%-28s %6s %12s %12s %8s\n", "vs baseline", "param", "base ns", "now ns", "delta");
+    for (const BenchResult& r : results) {
+        for (const BenchResult& b : baseline) {
+            if (b.name != r.name || b.param != r.param || b.median_ns <= 0.0) {
+                continue;
+            }
+            const double delta = (r.median_ns - b.median_ns) / b.median_ns * 100.0;
+            const bool regressed = delta > max_regression_pct;
+            regressions += regressed ? 1 : 0;
+            std::printf("%-28s %6zu %12.1f %12.1f %+7.1f%%%s\n", r.name.c_str(), r.param, b.median_ns, r.median_ns,
+                        delta, regressed ? "  REGRESSION" : "");
+        }
+    }
+    return regressions == 0 ? 0 : 1;
+}
+} // namespace
+
+int main(int argc, char** argv) {
+    const char* json_path = nullptr;
+    const char* baseline_path = nullptr;
+    double max_regression_pct = 15.0;
+    BenchOptions opt;
+    for (int i = 1; i < argc; ++i) {
+        if (std::strcmp(argv[i], "--json") == 0 && i + 1 < argc) {
+            json_path = argv[++i];
+        } else if (std::strcmp(argv[i], "--baseline") == 0 && i + 1 < argc) {
+            baseline_path = argv[++i];
+        } else if (std::strcmp(argv[i], "--max-regression") == 0 && i + 1 < argc) {
+            max_regression_pct = std::strtod(argv[++i], nullptr);
+        } else if (std::strcmp(argv[i], "--quick") == 0) {
+            opt.warmup = 20;
+            opt.samples = 21;
+            opt.min_sample_ns = 5000.0;
+        } else {
+            std::fprintf(stderr, "usage: %s [--json out.json] [--baseline base.json] [--max-regression pct] [--quick]\n",
+                         argv[0]);
+            return 2;
+        }
+    }
+
+    std::vector<BenchResult> results;
+    std::printf("%-28s %6s %12s %12s %12s\n", "stage", "param", "min ns", "median ns", "p99 ns");
+    auto record = [&](const BenchResult& r) {
+        bench_print(r);
+        results.push_back(r);
+    };
+
+    // compute_fft_mag body: real FFT + fused magnitude/max/sum, per FFT size.
+    {
+        FftPlan plan;
+        fft_plan_init(plan, kMaxFftSize);
+        for (std::size_t n = 64; n <= kMaxFftSize; n <<= 2) {
+            std::vector<int16_t> samples(n);
+            for (std::size_t i = 0; i < n; ++i) {
+                samples[i] = static_cast<int16_t>(static_cast<int>((i * 2654435761u) >> 20) % 4096 - 2048);
+            }
+            std::vector<std::complex<float>> spectrum(n / 2 + 1);
+            std::vector<float> mags(n / 2 + 1);
+            record(bench_run("compute_fft_mag", n, n * sizeof(int16_t), opt, [&] {
+                fft_real(plan, samples.data(), n, n, spectrum.data());
+                const MagnitudeStats stats =
+                    dsp_magnitude_stats(spectrum.data(), mags.size(), 1.0f / static_cast<float>(n), mags.data());
+                bench_keep(stats);
+            }));
+        }
+    }
+
+    // Narrowband analysis at equal bin width: a full-rate R*128-point FFT
+    // against CIC/FIR decimation by R followed by a 128-point FFT.
+    {
+        constexpr std::size_t kBins = 128;
+        FftPlan plan;
+        fft_plan_init(plan, kMaxFftSize);
+        std::vector<std::pair<BenchResult, BenchResult>> narrowband;
+        for (uint16_t r : {uint16_t{2}, uint16_t{4}, uint16_t{8}, uint16_t{16}, uint16_t{32}}) {
+            const std::size_t raw = kBins * r;
+            std::vector<int16_t> samples(raw);
+            for (std::size_t i = 0; i < raw; ++i) {
+                samples[i] = static_cast<int16_t>(static_cast<int>((i * 2654435761u) >> 20) % 4096 - 2048);
+            }
+            std::vector<std::complex<float>> spectrum(raw / 2 + 1);
+            std::vector<float> mags(raw / 2 + 1);
+            std::vector<int16_t> decimated(kBins + 1);
+            Decimator dec;
+            decimator_init(dec, r);
+            const BenchResult full = bench_run("narrowband_fft/full_rate", r, raw * sizeof(int16_t), opt, [&] {
+                fft_real(plan, samples.data(), raw, raw, spectrum.data());
+                const MagnitudeStats stats = dsp_magnitude_stats(spectrum.data(), kBins / 2 + 1,
+                                                                 1.0f / static_cast<float>(raw), mags.data());
+                bench_keep(stats);
+            });
+            const BenchResult decim = bench_run("narrowband_fft/decimated", r, raw * sizeof(int16_t), opt, [&] {
+                decimator_process(dec, samples.data(), raw, decimated.data());
+                fft_real(plan, decimated.data(), kBins, kBins, spectrum.data());
+                const MagnitudeStats stats = dsp_magnitude_stats(spectrum.data(), kBins / 2 + 1,
+                                                                 1.0f / static_cast<float>(kBins), mags.data());
+                bench_keep(stats);
+            });
+            const BenchResult filter = bench_run("decimate_cic_fir", r, raw * sizeof(int16_t), opt, [&] {
+                const std::size_t n = decimator_process(dec, samples.data(), raw, decimated.data());
+                bench_keep(n);
+            });
+            record(full);
+            record(decim);
+            record(filter);
+            narrowband.emplace_back(full, decim);
+        }
+        std::printf("\n%-28s %6s %14s %14s %8s\n", "narrowband, 128 out bins", "R", "full-rate ns",
+                    "decimated ns", "saved");
+        for (const auto& [full, decim] : narrowband) {
+            std::printf("%-28s %6zu %14.1f %14.1f %7.1f%%\n", "", full.param, full.median_ns, decim.median_ns,
+                        (full.median_ns - decim.median_ns) / full.median_ns * 100.0);
+        }
+        std::printf("\n");
+    }
+
+    init_model_inference();
+    const RfFeatureBackend backends[] = {RfFeatureBackend::RealFft, RfFeatureBackend::ComplexFft,
+                                         RfFeatureBackend::FixedQ15};
+    const char* backend_names[] = {"extract_rf_features/real", "extract_rf_features/complex",
+                                   "extract_rf_features/q15"};
+    for (std::size_t b = 0; b < 3; ++b) {
+        set_rf_feature_backend(backends[b]);
+        for (std::size_t n = 32; n <= kMaxRfSamples; n <<= 1) {
+            const RFSampleWindow window = make_window(n);
+            record(bench_run(backend_names[b], n, n * sizeof(int16_t), opt, [&] {
+                const RfFeatures f = extract_rf_features(window);
+                bench_keep(f);
+            }));
+        }
+    }
+    set_rf_feature_backend(RfFeatureBackend::RealFft);
+
+    // Pre-screen cost per window: what FFTTflmTask pays instead of the
+    // feature/inference stages when a window is skipped.
+    for (std::size_t n = 32; n <= kMaxRfSamples; n <<= 1) {
+        const RFSampleWindow window = make_window(n);
+        record(bench_run("window_ac_energy", n, n * sizeof(int16_t), opt, [&] {
+            const float e = window_ac_energy(window.samples.data(), n);
+            bench_keep(e);
+        }));
+    }
+
+    RfFeatureVector vec{};
+    for (std::size_t n = 32; n <= kMaxRfSamples; n <<= 1) {
+        const RFSampleWindow window = make_window(n);
+        record(bench_run("extract_rf_feature_vector", n, n * sizeof(int16_t), opt, [&] {
+            extract_rf_feature_vector(window, vec);
+            bench_keep(vec);
+        }));
+    }
+
+    {
+        const RfFeatures scalar{-55.0f, -40.0f};
+        record(bench_run("run_model_inference/scalar", 2, 0, opt, [&] {
+            const float s = run_model_inference(scalar);
+            bench_keep(s);
+        }));
+        extract_rf_feature_vector(make_window(kMaxRfSamples), vec);
+        record(bench_run("run_model_inference/ae_int8", kFeatureBins, kFeatureBins * sizeof(float), opt, [&] {
+            const float s = run_model_inference(vec);
+            bench_keep(s);
+        }));
+    }
+
+    AesGcmKey key{};
+    key.bytes.fill(0x11);
+    // A telemetry frame, and routing frames with a small and a full route table.
+    const std::pair<MeshMsgType, std::size_t> frames[] = {
+        {MeshMsgType::Telemetry, 0}, {MeshMsgType::Routing, 2}, {MeshMsgType::Routing, kMaxRoutes}};
+    for (const auto& [type, routes] : frames) {
+        const MeshFrame frame = make_frame(type, routes);
+        const std::size_t len = encode_mesh_frame(frame).len;
+        if (len == 0) {
+            std::fprintf(stderr, "encode_mesh_frame failed for %zu routes\n", routes);
+            return 1;
+        }
+        record(bench_run("encode_mesh_frame", len, len, opt, [&] {
+            const EncodedFrame enc = encode_mesh_frame(frame);
+            bench_keep(enc);
+        }));
+        const EncodedFrame clear = encode_mesh_frame(frame);
+        record(bench_run("decode_mesh_frame_clear", len, len, opt, [&] {
+            MeshFrame decoded{};
+            const bool ok = decode_mesh_frame_clear(clear, decoded);
+            bench_keep(ok);
+            bench_keep(decoded);
+        }));
+        // What a relay reads for its forwarding decision, against the full decode above.
+        record(bench_run("mesh_frame_view/header", len, len, opt, [&] {
+            MeshFrameView view;
+            uint32_t ttl = 0;
+            uint32_t hop_count = 0;
+            uint32_t seq = 0;
+            const char* src = nullptr;
+            std::size_t src_len = 0;
+            const bool ok =
+                mesh_frame_view_open(clear.bytes.data(), clear.len, view) &&
+                mesh_frame_view_uint(view, MeshMapKey::Header, static_cast<uint8_t>(MeshHeaderKey::Ttl), ttl) &&
+                mesh_frame_view_uint(view, MeshMapKey::Header, static_cast<uint8_t>(MeshHeaderKey::HopCount),
+                                     hop_count) &&
+                mesh_frame_view_uint(view, MeshMapKey::Header, static_cast<uint8_t>(MeshHeaderKey::SeqNo), seq) &&
+                mesh_frame_view_text(view, MeshMapKey::Header, static_cast<uint8_t>(MeshHeaderKey::SrcNodeId), src,
+                                     src_len);
+            bench_keep(ok);
+            bench_keep(ttl + hop_count + seq);
+            bench_keep(src_len);
+        }));
+        record(bench_run("encrypt_mesh_frame", len, len, opt, [&] {
+            const EncryptedFrame enc = encrypt_mesh_frame(frame, key);
+            bench_keep(enc);
+        }));
+    }
+
+    {
+        // Steady-state telemetry: the next frame against its keyframe, with a
+        // new nonce and anomaly score and everything else unchanged.
+        const MeshFrame keyframe = make_frame(MeshMsgType::Telemetry, 0);
+        MeshFrame next = keyframe;
+        next.header.seq_no++;
+        next.header.ref_seq_no = keyframe.header.seq_no;
+        next.security.nonce[0]++;
+        next.counters.tx_counter++;
+        next.telemetry.rf_event.timestamp_ms += 1000;
+        next.telemetry.rf_event.anomaly_score += 0.1f;
+        const std::size_t len = encode_mesh_delta(next, keyframe).len;
+        record(bench_run("encode_mesh_delta", len, len, opt, [&] {
+            const EncodedFrame enc = encode_mesh_delta(next, keyframe);
+            bench_keep(enc);
+        }));
+    }
+
+    {
+        const uint8_t nonce[kNonceLength] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12};
+        std::vector<uint8_t> plaintext(1024);
+        std::vector<uint8_t> ciphertext(1024);
+        uint8_t tag[kAuthTagLength];
+        for (std::size_t i = 0; i < plaintext.size(); ++i) {
+            plaintext[i] = static_cast<uint8_t>(i * 7);
+        }
+        for (std::size_t len : {std::size_t{16}, std::size_t{64}, std::size_t{256}, std::size_t{1024}}) {
+            record(bench_run("aes_gcm_encrypt", len, len, opt, [&] {
+                const AesGcmResult r = aes_gcm_encrypt(plaintext.data(), len, key, nonce, sizeof(nonce),
+                                                       ciphertext.data(), ciphertext.size(), tag, sizeof(tag));
+                bench_keep(r);
+                bench_keep(ciphertext[0]);
+            }));
+        }
+    }
+
+    if (json_path != nullptr) {
+        if (!bench_write_json(json_path, results)) {
+            std::fprintf(stderr, "failed to write %s\n", json_path);
+            return 1;
+        }
+        std::printf("\nwrote %s\n", json_path);
+    }
+    if (baseline_path != nullptr) {
+        return compare_with_baseline(results, baseline_path, max_regression_pct);
+    }
+    return 0;
+}
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// Minimal benchmark harness for the host bench targets. Each sample times a
+// batch of calls sized so one sample spans at least `min_sample_ns`; ns/op is
+// sample time / batch. Reports min / median / p99 over the samples.
+struct BenchOptions {
+    std::size_t warmup = 200;
+    std::size_t samples = 101;
+    double min_sample_ns = 20000.0;
+};
+
+struct BenchResult {
+    std::string name;
+    std::size_t param = 0;        // window / frame / payload size for the stage
+    std::size_t bytes_per_op = 0; // 0 when throughput is not meaningful
+    std::size_t samples = 0;
+    std::size_t batch = 0;
+    double min_ns = 0.0;
+    double median_ns = 0.0;
+    double p99_ns = 0.0;
+    double bytes_per_s = 0.0;     // from the median
+};
+
+// Keeps results observable so the optimizer cannot drop the measured call.
+template <typename T>
+inline void bench_keep(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "g"(&value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+template <typename Fn>
+BenchResult bench_run(const char* name, std::size_t param, std::size_t bytes_per_op, const BenchOptions& opt, Fn&& fn) {
+    using Clock = std::chrono::steady_clock;
+    for (std::size_t i = 0; i < opt.warmup; ++i) {
+        fn();
+    }
+
+    // Calibrate the batch so timer resolution stays well below one sample.
+    std::size_t batch = 1;
+    for (;;) {
+        const auto start = Clock::now();
+        for (std::size_t i = 0; i < batch; ++i) {
+            fn();
+        }
+        const double ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+        if (ns >= opt.min_sample_ns || batch >= (1u << 24)) {
+            break;
+        }
+        batch *= 2;
+    }
+
+    std::vector<double> per_op(opt.samples);
+    for (double& v : per_op) {
+        const auto start = Clock::now();
+        for (std::size_t i = 0; i < batch; ++i) {
+            fn();
+        }
+        v = std::chrono::duration<double, std::nano>(Clock::now() - start).count() / static_cast<double>(batch);
+    }
+    std::sort(per_op.begin(), per_op.end());
+
+    BenchResult r;
+    r.name = name;
+    r.param = param;
+    r.bytes_per_op = bytes_per_op;
+    r.samples = per_op.size();
+    r.batch = batch;
+    r.min_ns = per_op.front();
+    r.median_ns = per_op[per_op.size() / 2];
+    r.p99_ns = per_op[std::min(per_op.size() - 1, (per_op.size() * 99) / 100)];
+    r.bytes_per_s = bytes_per_op != 0 && r.median_ns > 0.0 ? static_cast<double>(bytes_per_op) * 1e9 / r.median_ns : 0.0;
+    return r;
+}
+
+inline void bench_print(const BenchResult& r) {
+    std::printf("%-28s %6zu %12.1f %12.1f %12.1f", r.name.c_str(), r.param, r.min_ns, r.median_ns, r.p99_ns);
+    if (r.bytes_per_s > 0.0) {
+        std::printf(" %10.1f MB/s", r.bytes_per_s / 1e6);
+    }
+    std::printf("\n");
+}
+
+// One result object per line so baselines diff cleanly and bench_read_json
+// can parse them back without a JSON library.
+inline bool bench_write_json(const char* path, const std::vector<BenchResult>& results) {
+    FILE* f = std::fopen(path, "w");
+    if (f == nullptr) {
+        return false;
+    }
+    std::fprintf(f, "{\n  \"schema\": 1,\n  \"results\": [\n");
+    for (std::size_t i = 0; i < results.size(); ++i) {
+        const BenchResult& r = results[i];
+        std::fprintf(f,
+                     "    {\"name\": \"%s\", \"param\": %zu, \"bytes_per_op\": %zu, \"samples\": %zu, "
+                     "\"batch\": %zu, \"min_ns\": %.1f, \"median_ns\": %.1f, \"p99_ns\": %.1f, "
+                     "\"bytes_per_s\": %.0f}%s\n",
+                     r.name.c_str(), r.param, r.bytes_per_op, r.samples, r.batch, r.min_ns, r.median_ns, r.p99_ns,
+                     r.bytes_per_s, i + 1 < results.size() ? "," : "");
+    }
+    std::fprintf(f, "  ]\n}\n");
+    return std::fclose(f) == 0;
+}
+
+// Reads name/param/median_ns back from a file written by bench_write_json.
+inline std::vector<BenchResult> bench_read_json(const char* path) {
+    std::vector<BenchResult> out;
+    FILE* f = std::fopen(path, "r");
+    if (f == nullptr) {
+        return out;
+    }
+    char line[512];
+    while (std::fgets(line, sizeof(line), f) != nullptr) {
+        char name[128];
+        BenchResult r;
+        if (std::sscanf(line, " {\"name\": \"%127[^\"]\", \"param\": %zu", name, &r.param) != 2) {
+            continue;
+        }
+        const char* median = std::strstr(line, "\"median_ns\": ");
+        if (median == nullptr) {
+            continue;
+        }
+        r.name = name;
+        r.median_ns = std::strtod(median + std::strlen("\"median_ns\": "), nullptr);
+        out.push_back(r);
+    }
+    std::fclose(f);
+    return out;
+}
@@ -0,0 +1,142 @@
+#include "adc.hpp"
+#include "config.hpp"
+#include "model_inference.hpp"
+#include "replay_source.hpp"
+#include "window_pool.hpp"
+#include "window_profile.hpp"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+// Host pipeline throughput over recorded data: a memory-mapped .npy (or stored
+// .npz member) feeds the continuous-capture producer, and every window runs
+// extract_rf_features, extract_rf_feature_vector and run_model_inference.
+//
+//   bench_replay --file path.npy [--member name] [--fft-size N] [--passes P]
+//                [--scale S] [--realtime] [--rate hz]
+//
+// Unpaced by default: the producer only waits for the consumer, so windows/s
+// is the pipeline ceiling. --realtime paces the source at --rate (default
+// NodeConfig::adc_sample_rate_hz) and reports drops at that rate instead.
+namespace {
+struct ReplayLoop {
+    ReplaySource* src;
+    uint32_t passes;
+};
+
+// Rewinds at the end of the array until `passes` full passes have been read,
+// so the run has a fixed size.
+std::size_t read_passes(int16_t* out, std::size_t count, void* ctx) {
+    auto* loop = static_cast<ReplayLoop*>(ctx);
+    std::size_t n = replay_read(*loop->src, out, count);
+    if (n == 0 && loop->src->passes < loop->passes) {
+        loop->src->pos = 0;
+        n = replay_read(*loop->src, out, count);
+    }
+    return n;
+}
+} // namespace
+
+int main(int argc, char** argv) {
+    const char* file = nullptr;
+    const char* member = nullptr;
+    NodeConfig cfg = load_config();
+    bool realtime = false;
+    uint32_t passes = 4;
+    float scale = 2048.0f;
+    for (int i = 1; i < argc; ++i) {
+        const bool has_value = i + 1 < argc;
+        if (std::strcmp(argv[i], "--file") == 0 && has_value) {
+            file = argv[++i];
+        } else if (std::strcmp(argv[i], "--member") == 0 && has_value) {
+            member = argv[++i];
+        } else if (std::strcmp(argv[i], "--fft-size") == 0 && has_value) {
+            cfg.fft_size = static_cast<uint16_t>(std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--rate") == 0 && has_value) {
+            cfg.adc_sample_rate_hz = static_cast<uint32_t>(std::atol(argv[++i]));
+        } else if (std::strcmp(argv[i], "--passes") == 0 && has_value) {
+            passes = static_cast<uint32_t>(std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--scale") == 0 && has_value) {
+            scale = static_cast<float>(std::atof(argv[++i]));
+        } else if (std::strcmp(argv[i], "--realtime") == 0) {
+            realtime = true;
+        } else {
+            std::fprintf(stderr,
+                         "usage: %s --file path.npy|path.npz [--member name] [--fft-size N] [--passes P] "
+                         "[--scale S] [--realtime] [--rate hz]\n",
+                         argv[0]);
+            return 2;
+        }
+    }
+    if (file == nullptr || passes == 0) {
+        std::fprintf(stderr, "--file is required\n");
+        return 2;
+    }
+
+    ReplaySource src;
+    const ReplayError err = replay_open(src, file, member);
+    if (err != ReplayError::None) {
+        std::fprintf(stderr, "%s: %s\n", file, replay_error_name(err));
+        return 1;
+    }
+    src.scale = scale;
+    init_model_inference(cfg);
+    const std::size_t window_len = window_profile().samples;
+    if (src.info.count < window_len) {
+        std::fprintf(stderr, "%s: %zu samples, shorter than one %zu-sample window\n", file, src.info.count,
+                     window_len);
+        return 1;
+    }
+
+    ReplayLoop loop{&src, passes};
+    AdcCaptureConfig capture{};
+    capture.sample_rate_hz = cfg.adc_sample_rate_hz;
+    capture.host_source = read_passes;
+    capture.host_source_ctx = &loop;
+    capture.host_paced = realtime;
+
+    uint64_t windows = 0;
+    double score_sum = 0.0;
+    RfFeatureVector vec{};
+    const auto start = std::chrono::steady_clock::now();
+    if (!adc_capture_start(capture)) {
+        std::fprintf(stderr, "adc_capture_start failed\n");
+        return 1;
+    }
+    for (;;) {
+        const WindowHandle h = adc_capture_take_handle(nullptr);
+        if (h == kNoWindow) {
+            if (adc_capture_stats().source_done && !adc_capture_pending()) {
+                break;
+            }
+            std::this_thread::yield();
+            continue;
+        }
+        const RfWindow* w = window_pool_get(h);
+        const RfFeatures features = extract_rf_features(w->samples, w->sample_count);
+        extract_rf_feature_vector(w->samples, w->sample_count, vec);
+        score_sum += run_model_inference(vec) + 1e-3 * features.peak_dbm;
+        window_pool_release(h);
+        ++windows;
+    }
+    const double elapsed_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    const AdcCaptureStats stats = adc_capture_stats();
+    adc_capture_stop();
+    const std::size_t file_samples = src.info.count;
+    replay_close(src);
+
+    const double samples = static_cast<double>(windows) * static_cast<double>(window_len);
+    const double windows_per_s = elapsed_s > 0.0 ? static_cast<double>(windows) / elapsed_s : 0.0;
+    const double realtime_factor =
+        elapsed_s > 0.0 ? samples / elapsed_s / static_cast<double>(cfg.adc_sample_rate_hz) : 0.0;
+    std::printf("file=%s%s%s samples=%zu fft_size=%zu passes=%u mode=%s\n", file, member ? ":" : "",
+                member ? member : "", file_samples, window_len, passes, realtime ? "realtime" : "unpaced");
+    std::printf("windows=%llu dropped=%llu elapsed=%.3f s  %.0f windows/s  %.2fx real time at %u Hz\n",
+                static_cast<unsigned long long>(windows), static_cast<unsigned long long>(stats.windows_dropped),
+                elapsed_s, windows_per_s, realtime_factor, cfg.adc_sample_rate_hz);
+    std::printf("score checksum=%.6f\n", score_sum);
+    return 0;
+}
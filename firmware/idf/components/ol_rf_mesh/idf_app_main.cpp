@@ -25,9 +25,12 @@ extern "C" void app_main(void) {
     init_mesh();
     set_mesh_node_id(cfg.node_id.c_str());
     init_radio_driver();
-    init_model_inference();
+    const bool dsp_ready = init_model_inference(cfg);
     init_ota();
     init_fault_monitor();
+    if (!dsp_ready) {
+        record_fault("Window profile allocation failed");
+    }
 
     RouteEntry gw{};
     std::snprintf(gw.neighbor_id, sizeof(gw.neighbor_id), "gateway");
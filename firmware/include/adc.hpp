@@ -1,7 +1,112 @@
 #pragma once
 
+#include "config.hpp"
 #include "telemetry.hpp"
+#include "window_pool.hpp"
 
 void init_adc();
 
+// Blocking one-shot capture of a single window. Kept for the hardware smoke
+// test; returns an empty window while continuous capture owns the ADC.
 RFSampleWindow collect_rf_window(uint32_t now_ms);
+
+// Continuous capture: samples stream at a fixed rate straight into pool windows
+// in the background (ESP-IDF adc_continuous DMA on target, a timed producer
+// thread on host). Windows are window_profile().samples long unless a
+// scheduler shortens them. Each completed window moves into a handoff slot that the
+// consumer takes without waiting; if the consumer falls behind, the older
+// unread window is released and counted as dropped, as is a window whose
+// samples arrived while the pool was exhausted.
+// Host producer sample source: writes up to `count` samples and returns how
+// many; 0 ends the stream (replay_source_read adapts a ReplaySource).
+using AdcSampleSource = std::size_t (*)(int16_t* out, std::size_t count, void* ctx);
+
+// Layout of the next window, chosen by the producer at each window boundary.
+struct AdcWindowPlan {
+    std::size_t samples;      // window length; 0 or > window_profile().samples = full profile
+    std::size_t skip;         // samples discarded before the window starts (retune settling)
+    uint32_t center_freq_hz;  // stamped into the window
+    uint8_t band;
+};
+
+// Called in the producer's context (the DMA callback on target) before the
+// first window and after each completed one, so it must not block.
+// `sample_index` is the absolute index of the next sample to arrive.
+using AdcWindowScheduler = AdcWindowPlan (*)(uint64_t sample_index, void* ctx);
+
+struct AdcCaptureConfig {
+    uint32_t sample_rate_hz = 20000;
+    // Integer decimation (CIC + compensating FIR, decimator.hpp) applied in the
+    // producer before samples reach a window. Windows, sample indices and
+    // scheduler positions are then at sample_rate_hz / decimation. 1 = off.
+    uint16_t decimation = 1;
+    // false: no background producer; samples arrive through adc_capture_ingest
+    // (host tests).
+    bool start_producer = true;
+    // Host only. nullptr keeps the stub waveform.
+    AdcSampleSource host_source = nullptr;
+    void* host_source_ctx = nullptr;
+    // Host only. true: real time at sample_rate_hz. false: as fast as windows
+    // are taken, waiting instead of dropping (throughput runs).
+    bool host_paced = true;
+    // nullptr: every window is window_profile().samples long, band 0.
+    AdcWindowScheduler scheduler = nullptr;
+    void* scheduler_ctx = nullptr;
+};
+
+struct AdcCaptureStats {
+    uint32_t windows_completed;
+    uint32_t windows_taken;
+    uint32_t windows_dropped;
+    uint32_t dma_overflows;  // target only: driver pool overran before the callback ran
+    uint32_t samples_skipped; // discarded by scheduler skips
+    uint32_t windows_filtered; // completed on a band other than the one asked for (adc_capture_want_band)
+    bool source_done;        // host only: the producer's source returned 0
+};
+
+// Releases the one-shot unit if init_adc() claimed it. Returns false if the
+// driver rejects the rate or the decimation factor; the achieved rate is
+// adc_capture_sample_rate_hz() (before decimation).
+bool adc_capture_start(const AdcCaptureConfig& cfg);
+void adc_capture_stop();
+bool adc_capture_running();
+uint32_t adc_capture_sample_rate_hz();
+
+// Producer entry point, called from the DMA callback / host thread. Safe
+// against a concurrent adc_capture_take, but only one producer may call it.
+void adc_capture_ingest(const int16_t* samples, std::size_t count);
+
+// Non-blocking. Returns the newest completed window if one arrived since the
+// previous call, transferring its pool reference to the caller (release when
+// done), else kNoWindow. timestamp_ms is derived from the sample clock (ms
+// since capture start); `first_sample`, if given, receives the absolute index
+// of samples[0].
+WindowHandle adc_capture_take_handle(uint64_t* first_sample = nullptr);
+
+// Copying convenience over adc_capture_take_handle; keeps the first
+// kMaxRfSamples samples of longer windows.
+bool adc_capture_take(RFSampleWindow& out, uint64_t* first_sample = nullptr);
+
+// True if a take would return a window.
+bool adc_capture_pending();
+
+// Restricts the handoff to windows captured on `band`; others are released as
+// they complete, without counting as dropped. A band sweep sets the next band
+// after each take so every band is handed out in turn, however the sweep
+// period lines up with the consumer's. kAdcAnyBand (the default after
+// adc_capture_start) hands out every window.
+constexpr uint8_t kAdcAnyBand = 0xFF;
+void adc_capture_want_band(uint8_t band);
+
+// RF front-end setting. adc_frontend_tune is a BandTuneFn for the band plan:
+// it is called in the capture context and only publishes the band's center
+// frequency and gain for the front-end driver.
+struct AdcFrontEnd {
+    uint32_t center_freq_hz;
+    int8_t gain_db;
+    uint32_t tunes;
+};
+bool adc_frontend_tune(const BandConfig& band, void* ctx);
+AdcFrontEnd adc_frontend();
+
+AdcCaptureStats adc_capture_stats();
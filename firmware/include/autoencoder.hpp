@@ -0,0 +1,31 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Native int8 engine for the dense 128->64->24->8->24->64->128 autoencoder
+// exported by ai/scripts/export_autoencoder_int8.py. Weights are per-channel
+// symmetric int8 with folded int32 biases; activations are per-tensor int8.
+// Activations ping-pong between two statically sized buffers, so a call uses
+// a few dozen bytes of stack regardless of model size.
+constexpr std::size_t kAutoencoderInputs = 128;
+
+// Reconstruction MSE of `features` (kAutoencoderInputs values, normalized to
+// [0, 1] as in ai/scripts/extract_features.py). Not reentrant: the activation
+// arena is shared.
+float autoencoder_reconstruction_error(const float* features);
+
+// Reentrant batch form: `features` is [batch][kAutoencoderInputs], `scratch`
+// holds autoencoder_batch_scratch_bytes(batch) caller-owned bytes. Results are
+// identical to the single-window call.
+void autoencoder_reconstruction_error_batch(const float* features, std::size_t batch, int8_t* scratch,
+                                            float* mse_out);
+std::size_t autoencoder_batch_scratch_bytes(std::size_t batch);
+
+// Maps reconstruction MSE to 0..1; 0.5 is the calibrated threshold (p99 MSE of
+// normal windows).
+float autoencoder_anomaly_score(float mse);
+float autoencoder_mse_threshold();
+
+// Static activation arena size in bytes.
+std::size_t autoencoder_arena_bytes();
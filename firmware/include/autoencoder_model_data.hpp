@@ -0,0 +1,793 @@
+#pragma once
+
+// Generated by ai/scripts/export_autoencoder_int8.py -- do not edit.
+// Source: numpy Adam, 3000 epochs, seed 7, normal windows of data/processed/features.npz
+
+#include <cstddef>
+#include <cstdint>
+
+constexpr std::size_t kAeLayerCount = 6;
+constexpr std::size_t kAeLayerDims[7] = {
+    128, 64, 24, 8, 24, 64, 128,
+};
+constexpr float kAeInputScale = 3.921568627e-03f;
+constexpr int32_t kAeInputZeroPoint = -128;
+constexpr float kAeOutputScale = 4.089315494e-03f;
+constexpr int32_t kAeOutputZeroPoint = -126;
+// 99th percentile reconstruction MSE of the float model on normal windows.
+constexpr float kAeMseThreshold = 4.756626655e-03f;
+
+// Layer 0: 128 -> 64 relu
+constexpr int32_t kAeL0ZeroPoint = -128;
+constexpr int8_t kAeL0Weights[8192] = {
+    25, 25, 14, -65, -27, 64, -28, 22, 19, -44, -8, 17, 6, 6, -4, -1, 70, 65, 50, 65, -26, -112, 45, -99, -68, 12, 44, 71, 31, -7, -20, 0,
+    -68, -41, -21, -67, -57, -95, 118, -24, 7, 24, 16, -27, 64, 57, -35, -25, -32, 65, 1, 64, -100, -7, -47, -88, 62, -5, 54, 42, -5, 46, 7, -12,
+    44, -99, 44, -69, 72, -5, 31, -2, 58, 1, -82, 74, 22, 111, -1, -48, 12, 75, 106, -2, 15, 30, 20, -21, 23, -4, -104, 15, -41, 25, -55, 45,
+    -49, -41, -96, -68, 102, 38, 45, 25, 68, 37, 57, -1, -55, 20, 60, 108, -12, 57, -127, 25, 42, -46, 24, 38, -38, 20, 20, -56, 42, -20, -61, 5,
+    -32, 8, 51, 53, 32, 1, 127, 5, 31, 14, 33, 99, 115, 74, -8, 76, 2, 49, -35, 11, 24, 10, -90, 21, 20, 25, 26, 42, -42, -15, -17, -41,
+    -20, 65, 15, -43, -58, 28, 42, 66, 42, 16, -3, -27, 36, 2, -10, -51, -27, 97, 8, -53, 48, 20, 6, -15, 67, -17, -120, -60, 12, -56, -2, 3,
+    -38, 5, 2, 25, -70, 3, 63, 12, 38, -4, 5, -42, -7, 2, 11, 57, 81, -60, 52, 35, -118, 0, -4, -46, 102, 56, -86, 12, 7, -51, -1, 35,
+    58, -90, 35, -52, 36, 73, -30, 52, 4, 103, 5, -115, 0, -56, 6, 46, -21, -15, -7, 6, -35, -64, -52, 53, 65, -15, -22, -14, -4, -121, -41, 10,
+    -114, 62, 16, -57, -115, 65, -101, -101, -101, -114, 103, -65, -55, 84, 27, -86, -21, 97, -35, 52, -110, 56, 69, 81, 42, -38, -119, 1, 64, -85, -65, 5,
+    61, 100, -103, -87, 75, 34, 54, 126, 111, 87, 69, -32, 33, -87, 64, 64, 54, -19, -36, -25, -127, 86, 7, -34, 8, 54, -35, 83, 106, -34, -99, 64,
+    125, -96, 52, 82, 107, -103, -111, 124, -105, -89, 16, -18, 62, -84, 105, -79, 67, -118, -11, -127, -53, -53, 54, -16, -120, 126, 98, 105, -70, -32, -76, -103,
+    -127, -3, -103, -89, 91, -8, -87, 40, -66, 3, -61, 0, 30, 6, -32, 72, 94, -88, -99, -104, 122, 112, -75, 119, -81, -2, -5, 105, -125, -53, 22, -118,
+    -52, 65, 123, 127, 100, 70, 66, 61, 14, 67, -33, -46, 98, -11, 91, -11, -23, 66, -26, -11, -27, 85, -15, 18, -66, 49, 29, -15, 27, -15, -26, 49,
+    18, -23, 53, -54, -28, 21, -51, 21, -80, 75, 17, -23, 8, -21, 59, -97, -20, 6, 82, -92, -33, -2, -22, -58, -4, -45, -85, 66, -51, -72, 46, 14,
+    -61, 42, 27, -7, -1, 39, 32, -43, -11, -26, 58, -23, 25, 56, -1, -61, 0, -45, 33, 44, -37, 32, -84, -16, 39, -3, -21, 24, 29, -23, -27, -28,
+    -43, -40, 31, 44, -98, -11, -23, 12, 58, 59, -63, -12, 21, -1, -9, -97, 23, -44, 13, -44, -71, 43, -4, 13, 23, -1, -78, 34, -77, -96, 38, 68,
+    -113, 60, 81, -14, -112, 47, -65, 37, -32, 35, -62, -6, 6, 33, -76, 118, -54, -50, -62, -111, -20, 70, 54, -78, -93, -46, 69, -3, 108, 40, 31, 68,
+    64, -40, -62, -16, -3, -92, -15, 36, -93, -93, -83, -55, 118, -121, -81, -86, -7, -124, -11, -86, -59, 75, -81, 30, -24, -21, 81, -87, 108, 101, 43, -115,
+    42, 26, 70, -73, 116, 99, -99, -47, -120, 85, 106, 125, 29, 42, 46, 18, 116, 28, -42, 3, -123, 57, 50, -20, 90, 65, -42, -108, -94, -81, -50, -13,
+    109, -57, 102, 46, 90, -25, -127, 73, -65, -91, 77, 48, -74, -59, 112, -59, 52, -95, 81, -98, 4, -119, 13, 89, -106, -58, 68, 28, -48, 33, -12, 93,
+    -53, 66, 35, 62, -31, 58, 51, -29, -122, 119, 55, -76, 59, -57, -8, 92, -13, -54, -50, -109, -72, -59, -84, -112, -9, -73, 61, 109, -58, 19, 2, -109,
+    -96, 99, -7, 78, -111, 24, 94, 94, -127, 6, -34, 67, -110, -60, 80, -8, -12, 120, -46, -118, -28, -89, -107, 17, 117, 20, 38, -45, 18, 65, 23, 78,
+    13, -78, 21, -2, -86, 31, 81, -94, 12, 60, -25, -59, -33, 11, 48, 15, -101, 82, 109, -102, -64, -84, 90, 105, -117, -43, -79, -8, 108, -110, -84, -3,
+    6, 63, -16, -92, -38, 124, 64, -99, 79, -49, 72, -125, 95, -87, -11, 42, 2, -86, -93, -55, -115, -73, -95, -9, -37, 22, -56, -120, -43, 66, -63, -25,
+    57, -28, 90, 98, -52, 54, -67, -93, -20, 20, 100, -92, 46, -12, -96, 110, 44, -96, 94, -103, -105, -45, 102, -119, 98, 24, -110, 13, -14, 10, 53, 38,
+    116, -90, 71, -26, 64, 90, 114, -62, -17, 103, 103, -37, 102, -28, -37, 58, -11, -18, -33, -22, -92, -113, 56, 10, 36, 69, -71, -70, -60, -54, 58, -37,
+    -49, 28, -81, -102, 43, 56, -54, 28, -119, -30, 15, -64, -41, 21, 18, -91, 46, -109, 111, -79, -65, -79, 114, -57, 22, 116, 105, -118, 0, 19, 44, -45,
+    -48, -127, -119, 7, -109, -76, -46, -109, -121, 99, -21, -78, 45, -125, -66, 107, 91, 29, -105, -49, -122, -75, -121, -97, 26, -104, -90, 94, -44, -45, -104, 67,
+    28, -4, -7, -77, -68, 22, 29, 55, 32, -16, -80, 73, -93, -106, 31, 93, 78, 63, -112, -70, 45, 57, 19, 102, 5, -12, 19, -56, 26, -58, 92, -18,
+    74, 44, 10, 3, 52, -15, -108, -81, 15, 44, -15, 43, -12, 29, -6, 52, -15, -32, -51, 97, 5, 55, -42, -103, 39, -57, 25, -22, -61, 75, 24, -45,
+    -15, 43, -28, 30, -127, 6, 20, -5, -48, -22, -46, 37, 33, -15, -60, 58, -46, 31, -72, -16, -7, 28, 57, -73, 49, 24, -14, -11, -52, -18, 68, -29,
+    32, 83, 48, 102, 38, -28, 65, -121, 70, 85, -24, -64, -44, 31, 26, -56, -104, 6, 9, -37, -44, -31, -6, -63, 76, 29, 34, -110, -7, -82, -13, -61,
+    48, 0, 33, 31, 90, -9, 52, 27, 30, -67, -24, 127, 27, 23, 51, -48, -48, -29, -43, 20, 44, -83, -66, 1, 10, 12, -29, 41, -12, -11, 70, 13,
+    -1, -26, -59, 21, -37, -5, 83, 52, 37, -47, 37, -116, 54, 56, 30, 23, -99, 48, -27, 71, -27, 30, -23, 37, 72, -24, 32, 33, -43, -13, -53, 46,
+    -16, -43, 36, 5, 17, 83, -27, 15, -70, -46, 58, -46, 29, 79, -49, 55, 19, 50, 30, 11, -15, 7, -52, 23, 30, 38, -38, -14, -104, 30, 38, -16,
+    85, -86, 53, -29, 63, 45, 37, -29, -10, 30, 2, -75, 13, -11, 24, -50, -23, -15, -8, -23, 13, -14, 7, -11, -47, 0, 31, -70, -51, -51, -29, 28,
+    5, 127, 23, 36, 64, 58, 26, -22, 74, 12, 61, -3, -25, 82, -26, 47, 15, -22, -63, 35, -47, 69, 55, -57, -91, 61, -12, -38, 2, -29, 21, 34,
+    45, 53, -74, 14, -28, 95, -60, -9, 57, -34, -53, -18, -48, 62, -59, -61, -105, 27, -29, 49, 71, 37, -41, -71, -25, 108, 24, -63, 46, 64, 53, 43,
+    9, 63, -17, -75, 40, -41, -37, 59, -21, 2, 74, -27, 101, 75, -21, -22, -40, 56, -46, -56, 71, 26, 28, 59, -61, -79, -40, -77, -29, 24, 8, 16,
+    -62, -26, 85, -71, -29, -82, 63, -50, -61, 23, 3, 50, 49, -52, -108, -28, 74, -59, 34, -58, 13, -36, -5, 96, -20, -31, 9, -15, -37, -48, -18, -30,
+    -71, -95, -21, -58, 78, 81, -45, 24, 95, -42, 8, -21, 32, 109, -96, 110, 35, 68, 28, 87, -50, 46, -65, -4, 40, -81, -116, 67, 71, 35, -51, 34,
+    -111, 35, 13, 23, -20, -75, 51, -15, 55, -40, -110, 4, 25, 99, 91, -117, 62, -66, 43, -36, -51, -9, 2, 42, 29, 39, -35, 38, -45, 21, -16, 10,
+    -127, -7, -77, -35, -113, 33, 93, -43, -105, 24, -100, 92, -100, -41, -7, -102, -52, -63, 48, 116, -41, 67, -96, 14, -23, -60, 75, 55, -98, -58, 74, 117,
+    22, 87, 116, 54, 30, -76, -39, 25, 101, -56, -33, -126, 43, -20, 68, -73, 34, 37, -15, -84, -30, 55, -84, -109, -16, -73, 69, 74, 106, 79, 31, -85,
+    43, 115, 100, 106, 92, -12, 23, 30, 0, 12, -46, 5, 16, 24, 68, 25, 35, 65, -46, -7, -31, 5, 46, -70, -2, 66, -5, 41, -17, -22, 10, -51,
+    -48, -11, 106, 8, -51, 72, -60, 59, 44, 32, -9, -39, -70, -45, -38, -5, 49, -9, 63, 2, -68, -9, -51, -63, 55, 12, -50, -37, 52, -13, -85, 29,
+    -61, 70, -8, 15, -14, 26, 79, 5, -98, -8, -46, -59, -15, -42, 89, 5, 54, 15, -59, 9, 5, -46, -6, 71, -59, -72, -8, 34, 13, 13, -86, -44,
+    -24, -15, 77, 50, -29, -76, -38, 43, 30, 8, -36, -8, 32, 23, -46, -100, -96, -56, 67, 18, 53, -127, -73, 49, 1, -68, -20, 43, 16, -47, -55, 62,
+    -9, 56, 9, -107, -67, -112, -79, -77, -22, -46, -35, 81, -122, -101, 79, 9, -16, -59, 11, -71, 92, 83, -45, -121, 99, -51, 40, 91, 76, 93, -3, 87,
+    -10, -60, -5, -42, 68, 85, -92, -86, -30, -9, 117, 113, 119, 59, 45, -59, -33, -127, 85, -57, -107, -47, -45, 57, -126, -69, 101, 91, 33, 15, -71, 96,
+    67, 3, -87, -73, -31, -43, -112, -24, -13, -54, -30, -43, -31, 30, -1, -77, 75, 3, -11, 54, 64, 89, 79, 43, 56, -88, 51, -63, -62, -97, -26, -123,
+    40, 63, 70, -95, 36, 86, -118, -78, -59, -10, -84, 10, -40, 40, 8, 48, -65, 53, 60, 57, -110, 114, 20, -58, -17, 4, 5, -64, -60, -35, 72, -16,
+    -119, -12, -77, -126, 123, -53, 10, -37, -115, 103, 112, -81, -21, -33, -86, 42, 73, 67, 45, -124, -70, 4, 52, -29, -13, 88, -123, -60, -54, 127, -70, -117,
+    -22, 39, -89, 88, -78, 53, -87, 98, -77, 60, 87, -63, -105, 22, 0, -5, 73, -10, -1, -3, -12, -24, -87, -53, -61, -65, 73, -99, -76, 7, -48, -67,
+    -33, 1, 45, 122, 91, -18, -12, -22, -67, 116, -111, -76, 42, 23, -57, 113, -23, 25, -105, 101, -102, -27, 99, 115, 104, 84, -69, -121, -12, -113, 119, -127,
+    -45, -76, -125, 0, -109, 103, 48, -34, 88, 77, -45, 89, 111, 31, -38, 103, 114, -39, -107, 95, 42, -69, 17, -49, 108, -41, -78, -118, -41, 126, -73, -11,
+    63, -3, 17, 117, -19, 43, 33, -100, 47, 10, 17, -13, 4, -44, -39, -58, 73, 40, -40, 12, 5, -84, -1, 53, -95, -10, 12, 9, -11, -62, 65, 54,
+    -5, 82, 13, 87, -32, 2, -77, -90, -48, 47, 50, -108, 95, -65, -41, 50, -6, 11, -19, -9, 45, -49, 61, 31, -14, 76, -17, 46, -3, -88, -30, 21,
+    -64, -27, 78, 50, -103, 66, -67, -80, 16, -29, 34, 66, 48, -70, 45, 23, 39, -58, 13, 67, -21, -13, -33, -72, -56, -23, -127, 36, 4, 44, -46, -50,
+    62, 0, 50, -52, -7, 74, -101, 12, 10, -76, 20, 10, -37, -2, 4, -6, 71, -34, -50, -21, 103, -43, -18, -12, -49, -1, 50, 46, 2, 48, -53, 59,
+    4, -17, -84, -70, 21, -83, -18, -36, 81, -87, 56, -37, -62, -33, 5, 127, 58, -16, 49, 4, -29, -18, 118, 16, 87, -36, -53, 61, -56, 59, 3, -42,
+    83, 41, -65, -76, 83, 98, 100, 14, -11, -28, -54, -68, 46, -79, 0, -28, 1, 93, 4, 119, 59, 36, 94, -7, 71, -22, -8, 80, -12, 12, 33, -21,
+    112, -68, -48, -4, -78, 70, -94, 66, 41, -20, 42, -7, -92, 23, -126, -50, 6, 16, 96, 66, -29, 20, 18, -17, 6, -27, -29, 21, 3, 124, -68, 25,
+    -8, 76, 1, 29, 75, 27, 46, -8, 67, -9, -38, -15, -46, -1, 75, 1, -27, 79, -85, -34, 5, -100, 19, 45, -2, 75, 94, -27, -14, -1, -37, -31,
+    72, -127, 59, 30, -124, -112, 47, 29, -55, 72, -81, -28, -104, 22, -106, -86, 55, -11, 28, 42, 10, -83, 37, -106, -68, -22, -104, -106, 24, 41, -42, -39,
+    -79, -8, 6, 94, -119, 85, 108, -50, 44, 70, 24, -59, 11, 77, -102, -20, -126, 70, 54, -120, 47, 33, -98, -9, 32, -49, -7, 101, 20, -12, -115, -102,
+    69, 46, 69, 6, 11, -3, 44, -50, -13, -21, 28, -77, -125, -108, -90, 70, 37, 46, -24, -104, -19, 73, -11, 18, -38, -96, 19, -15, -51, -69, 33, -57,
+    6, -70, 48, -46, -18, 87, 41, 42, -49, 72, -40, 103, 77, 29, 68, -7, 38, -99, 106, 62, -98, -75, 8, 49, -96, 98, -49, 104, 49, -13, -45, -107,
+    -108, 20, 55, 86, -41, 93, -59, 94, 91, -92, 77, 40, 37, 71, 0, -7, -40, 76, 86, -90, 54, -62, -86, -82, 7, -62, -70, -104, -52, 55, -122, -14,
+    14, -115, -60, 88, 109, 74, -89, 52, -22, -89, -15, 90, 80, -34, -114, 87, 105, -6, -76, 0, 38, -13, -44, -68, -57, -116, -68, 99, -127, 44, 58, -31,
+    12, -76, 29, 41, 47, -12, 101, 77, 6, 35, -64, 97, 26, 83, -61, 106, -104, -1, -103, -83, 55, -113, -38, -84, 73, -110, -49, 74, 34, 39, 108, -122,
+    30, 49, 48, 42, -112, -107, 56, 18, -67, -127, -2, -106, 49, -48, 63, -107, -12, -105, 56, 6, -71, 99, 33, -48, 74, -39, 97, -57, 106, -113, 45, -60,
+    -27, 26, -119, -76, -105, 51, -77, -8, -51, -74, 98, -6, 29, 42, 71, -67, -111, -15, -88, -126, 94, 23, -29, -97, 56, 1, -88, 110, 103, 97, 72, -1,
+    -57, 29, -94, 20, -115, -127, 45, -47, 40, 60, 73, 19, 76, 31, 96, 89, -120, -65, -35, -69, -87, 82, -125, -86, 56, -76, -66, 107, 56, -22, -98, -65,
+    110, 63, -114, 42, -38, 45, -59, -99, -125, -59, 80, 88, 37, 52, -82, -44, 89, 111, -22, 60, 98, 113, -58, 30, -35, -17, -17, -61, -126, 57, 40, 76,
+    -93, -73, 15, 98, -15, -81, 15, 104, 82, 90, -30, -67, 82, 63, 77, -35, -61, -72, 82, 95, -42, 83, -37, -21, 8, -76, -66, -66, -67, -4, -107, 61,
+    -59, 82, 97, -18, 40, 27, 15, 28, 101, -78, 33, 35, 22, -43, -10, 50, 21, 52, -54, 74, 43, -56, 47, -10, 24, 60, 39, 18, -29, 8, 110, 97,
+    -67, 36, -40, -56, 71, 54, -37, -102, 19, -59, -23, -127, 16, -32, 16, 70, -44, 13, -78, 31, 60, -38, 84, 55, 19, -54, -57, -2, -75, -32, -43, -70,
+    -37, -9, 38, 41, 21, 18, 0, 9, -51, 4, 59, -55, -91, 73, 13, 65, 110, 37, 53, -13, -18, 81, -67, 56, -19, 22, -8, -42, 19, 80, 40, -117,
+    -47, 59, 107, 58, 34, -70, 52, 69, -20, 28, 44, -98, -16, 19, -38, -85, -92, -37, -24, -98, -36, -126, -5, 18, 48, 90, 41, -7, -27, -51, 59, -58,
+    21, -64, 68, -80, -27, -75, 78, 21, 23, -53, -86, 78, 55, 48, 111, 6, -85, 18, -59, -5, -18, 7, 92, 66, -29, 67, 78, 57, 4, 87, -10, -103,
+    -63, 30, -38, -27, -32, -82, -106, -116, 33, -50, -19, 96, 22, 66, 54, 100, -112, -36, 99, -17, 99, -84, -114, 86, -30, -6, 96, -75, 104, -33, -69, -72,
+    -4, -16, 84, -116, -118, -92, 17, 59, -13, 19, 26, -123, -69, 111, -49, 99, -10, -75, -127, -76, -51, -23, -21, 3, -15, -120, -64, 102, -121, 48, -14, 41,
+    -48, -39, -4, 90, -49, -107, -119, 83, -53, -99, 15, 74, 16, -92, -31, -64, -124, 103, -18, -96, 84, 108, 67, -67, -82, -3, 12, 82, 103, 90, -46, 12,
+    -96, 5, -110, -99, -97, -51, -49, 52, -108, -99, 40, 44, 54, 56, 42, 13, 62, -107, -74, 62, -79, 8, -61, -18, 85, 41, -14, -58, 78, 40, -15, 94,
+    49, 123, 42, 102, 13, 54, 88, -105, -7, 27, -113, 74, 55, 112, -33, -8, 105, -23, 85, -20, -41, -57, -73, -18, -87, 84, 121, -103, -114, -127, 110, -109,
+    46, -50, -77, -65, 48, -123, 93, 17, -68, -75, 40, 33, -47, -42, -9, 105, 10, 87, 36, 16, -3, 46, -2, 58, -81, -45, 95, -27, 88, 112, 20, -102,
+    66, 42, -53, 93, -4, -113, -110, -69, 28, 81, -103, -122, 31, -23, -15, 82, 107, 119, 71, -127, -89, 22, 116, -107, 4, -26, -24, -59, -59, -67, -101, 14,
+    -5, 99, 92, 121, 10, 69, -24, 25, 67, 19, -6, -22, -65, 11, -34, -36, 12, 52, 63, -19, -20, 27, 28, 9, 9, 50, -9, 29, -1, 38, 66, 39,
+    40, 63, -31, 38, 61, -25, -27, -92, -75, 48, -28, 45, -38, 44, -34, -4, 38, -18, -52, -49, 31, -40, -16, 44, -19, -43, 27, 29, -61, -20, -32, 61,
+    -86, -6, -40, 43, 33, -67, 52, -12, -36, 61, 1, 36, -42, -30, 22, 42, 20, -8, -127, -31, 31, 86, 38, 13, -59, -5, -36, 39, 46, -5, 36, 2,
+    -54, 31, -29, -48, -23, 13, -60, -3, 60, 31, 15, 56, 25, 10, -2, -27, -38, -23, -42, -1, 33, -2, -65, 41, -86, 78, 36, 36, -24, 48, -53, -67,
+    7, -70, -51, -27, -88, 81, 52, -89, 20, -30, 44, 56, 76, -77, 51, 8, -60, -5, -9, 60, 4, -124, 37, -1, 65, -76, 84, 69, -71, -9, -62, 15,
+    -60, 42, -89, 19, 27, -36, -4, 98, -50, -68, -35, -28, 6, -61, 23, 45, 18, 19, -13, -44, -41, 20, -5, 47, -35, 25, 17, 73, 36, -22, 57, -8,
+    75, 41, 44, 11, -67, 23, -35, 10, -5, 60, 2, 43, -88, -15, 48, -54, 112, 5, 27, 26, -46, 5, -2, 19, -2, -26, -16, -92, -34, 21, 38, -72,
+    -6, 43, -44, 71, 60, -58, 15, 49, 23, 55, 127, 7, -27, 78, 3, -45, -30, -8, 40, 2, -36, 86, 15, -56, 61, -8, -78, -5, 42, 106, -57, 85,
+    68, -65, -10, 29, -48, -101, 78, -88, -8, -22, 96, 10, -22, 115, -42, 53, -69, 57, 56, 77, -10, -70, 27, 95, -52, -122, -82, 102, -126, -112, -103, 91,
+    -31, 41, 48, -20, 52, -13, 10, -52, -127, 22, -62, -61, 93, -39, -98, 27, 6, -112, -43, 24, -60, 115, 68, -4, 98, -116, -73, 96, -1, -84, 13, 52,
+    23, -116, -118, -26, -123, -105, 30, -18, -105, 88, -36, 89, 21, 26, -22, 36, -68, -64, 86, -78, -34, 56, -46, -39, 96, -76, -68, 90, -61, -45, 89, -48,
+    118, 75, 79, -72, -74, 56, 75, -73, -76, -68, -92, -22, -3, 27, -114, -79, -97, -62, -79, 104, -34, -93, 35, 110, 69, 34, -35, -27, -55, 69, 69, -6,
+    51, 92, 108, -21, -35, -77, -4, 15, 127, 10, 12, -9, 6, -72, 28, -101, 54, 83, -62, 43, 86, -85, 53, -5, -27, 73, 6, 24, -13, 53, -47, -44,
+    -54, -40, -60, 54, 113, 17, -3, -12, -24, 63, -70, 25, -42, -68, -46, 75, 3, -42, 80, 34, 66, -4, -9, -34, 10, -28, 41, -3, -94, 15, -91, 91,
+    -88, 98, 57, -19, 55, 3, -24, 70, 16, -62, 73, -48, -66, -22, -14, 7, -10, 27, -3, 47, 34, 35, 68, 17, -41, 10, -92, 18, 23, 24, -43, -45,
+    -31, 88, 61, 21, 26, -6, -82, -2, -4, 91, -67, 12, 92, -10, 12, -106, -11, -55, 2, -18, -39, -79, -32, -84, -56, 57, -43, -92, -62, 21, 52, -78,
+    31, -39, 7, 17, -47, 24, 69, -16, 21, -49, -37, 60, 51, -40, -59, -6, 2, -8, 59, 35, 60, -44, 36, 50, -67, 10, -30, 45, -42, 37, -11, 30,
+    22, 45, 3, -27, 18, -31, -24, 43, 73, 3, -9, -40, 62, 12, -10, 58, -60, 82, 35, 56, 14, 60, 75, -11, -10, 21, 38, 26, -89, -59, -20, 48,
+    85, -41, 23, 6, -67, -57, -1, 31, 43, -80, 42, -36, -32, 41, -85, 75, 88, 66, -22, 38, -6, 58, -37, -64, 71, -5, -79, -85, -15, 31, 19, 15,
+    -43, 39, 31, 57, 52, -14, -23, 65, -16, 22, 61, -6, -7, 15, -2, 62, 4, -31, 19, 25, 32, -70, -47, 39, 76, -19, 1, -127, -12, 31, -25, 47,
+    94, -80, 50, -21, -72, -35, -6, 90, 65, -121, -107, 112, 10, 16, -43, 68, 9, 13, -69, 70, -79, -92, 18, 80, -56, -54, -93, 29, 59, -91, 9, 0,
+    -98, 1, -55, -75, 117, -101, -48, 21, -28, -110, 96, -63, -30, 91, 112, 98, -35, 58, 84, -82, 108, -101, 32, -69, -71, -92, 105, -89, 93, -91, -48, -71,
+    107, -102, 83, -54, 97, 46, -63, -1, -86, -23, -115, 30, 21, -55, -127, 102, -93, -42, -120, -39, -24, 5, -46, -68, 66, -59, -45, -8, -63, 48, -96, -49,
+    -26, -60, 78, -41, -24, -16, 74, -73, 67, 95, -65, -85, 64, -44, -75, -111, 19, 91, 87, 13, -17, 112, 24, 107, 39, 43, 43, -89, -68, -110, 103, 114,
+    32, -127, -121, -75, -31, -35, -23, 23, 27, -80, 4, 1, 29, 19, -13, 89, 1, -9, 66, 50, 44, -70, -35, -5, 120, 13, 60, -45, 95, -46, 12, 49,
+    98, 43, -6, -73, 72, 23, 35, -12, 90, 19, 11, -57, 54, 84, 61, 42, 84, 89, 1, -27, 37, 70, 61, -61, -19, 47, 35, -66, 35, -19, 96, -16,
+    -4, 29, -18, 10, -53, -7, -40, 29, 38, -37, 15, 59, -13, -50, 45, -21, 26, 24, 108, 9, -54, 9, -14, -66, 42, 28, -18, 19, -2, 12, 35, 55,
+    41, -50, 34, -64, 77, 14, 17, 75, 36, 94, 105, -67, -28, 76, -27, 60, 111, -38, -44, -26, 6, -12, 30, 62, 62, 15, -43, -65, 97, -24, 78, -5,
+    30, 36, -106, -108, -17, -97, -55, -78, -50, -14, -51, -45, -7, 41, -118, 120, -21, 101, -127, -114, -104, 99, -26, 83, 44, -106, -38, -46, -15, 59, -107, 102,
+    -10, -38, 46, -59, 50, -25, -8, -81, -78, 86, 15, -22, 65, 99, -89, 121, -125, 25, -63, -66, -6, 22, -20, 49, 109, -86, -67, 24, -26, -49, -2, 45,
+    99, 106, 76, -41, 92, 49, -85, 109, -67, 41, 45, 97, 38, 116, -114, -119, -80, 15, -22, -106, -78, 16, -28, 62, -11, 90, 61, -5, -40, -75, -56, -40,
+    -39, -84, -10, -100, 88, 9, -104, -47, -65, -90, -8, -82, -91, 46, -21, 40, -12, -3, -51, -22, -9, -43, 77, -67, -73, -43, 67, 83, 12, -39, 33, 77,
+    -66, 43, 54, -28, -91, 27, -74, -34, 11, 118, -90, -109, 10, 113, -116, 36, -121, 13, -97, 41, -36, 40, -62, -109, -81, -58, -86, -77, 11, -16, 83, -1,
+    10, 54, 90, 22, -119, -10, -120, 27, -111, 10, -90, 91, -104, 41, 52, -58, 24, -44, -62, -62, -124, 44, -110, -78, -106, 78, 8, -8, 21, 79, 32, 3,
+    -48, 4, 125, 18, -6, 99, -114, -112, 74, 113, -115, -122, -125, 20, -93, 16, 42, -124, 95, -63, 14, -37, -40, -25, -127, -18, -60, -36, -86, -42, 51, 124,
+    -78, 94, 29, -102, -124, 98, -68, -101, 40, 53, 101, 0, -48, -47, -76, 35, 113, -106, -29, -38, -107, 24, 124, -57, 58, 103, -59, 107, 64, 37, -78, -57,
+    -102, 101, 79, -106, 8, -73, 68, 19, 114, 58, -102, -33, 19, 105, -33, -80, -55, -64, -88, -40, -64, 3, 101, 116, -87, 18, 44, -89, 8, -77, -35, -45,
+    81, -68, 10, 22, -43, 110, -43, -44, 49, -3, 57, -89, -90, 60, -28, 91, -68, -66, 93, -35, -100, -72, 69, -60, 14, 86, 28, 65, 122, -51, 96, 13,
+    -76, -94, -44, -93, 69, 15, -117, 97, 25, -15, -92, -8, 107, 22, -10, 28, 13, 32, -77, -90, -125, 85, -127, -62, 22, 0, 103, -73, -99, -87, -1, -53,
+    -11, 48, -46, 42, -123, 12, 104, 111, 18, 124, -68, -52, -13, 2, 82, -13, -116, 51, -71, 98, -74, -52, -93, -50, 26, -59, -115, 22, 60, -100, -19, -110,
+    -123, -32, -54, 96, -124, 37, 59, -21, 0, -64, -63, -114, 103, -120, -92, 57, -11, 3, -52, -86, 76, -96, -52, 64, -51, 115, -83, 7, 10, 0, 70, -116,
+    12, 74, -114, 12, -15, -24, 10, 32, 52, 101, 40, 127, 42, -59, -90, -109, -59, -97, 47, 48, 29, -30, -9, -61, 107, -123, -46, 19, -81, 90, -5, -33,
+    -111, -56, 23, -56, -116, 20, -50, 88, 49, 56, 99, 79, -43, 18, -61, -76, -75, -99, -66, -70, 44, -63, -115, -20, -76, 48, -71, 15, -82, -5, 93, -50,
+    7, -16, -109, -122, 87, -41, 47, -22, 86, -78, -4, 12, 75, -120, -35, -6, 23, -91, 11, 49, 59, -70, -15, -51, -29, -35, 113, -124, 114, -119, -107, -75,
+    -23, 117, 97, 127, 30, -37, 18, 55, -24, 78, -51, 13, 13, 76, 64, -37, 11, -42, -2, -35, 6, 15, -60, 7, 24, -42, 34, 20, -55, 59, 23, -7,
+    -37, 66, -22, -5, -16, -39, 17, -8, -1, 78, 16, 12, 5, 2, -17, -25, -36, 24, -39, 45, -9, -18, -27, 12, -19, 38, 46, -26, 52, -33, -1, -43,
+    23, 17, 14, -58, 18, -40, -10, -5, -38, 10, 64, -35, 30, -44, -21, -9, -27, 3, -4, 19, 4, 15, 30, 65, 12, -13, -38, 45, -13, -1, 50, -21,
+    54, -10, -18, -8, 19, -20, 11, -14, 24, -65, -54, -19, 46, -20, -2, -69, 13, 77, -31, -15, 52, 22, 11, -8, -15, -41, 5, 35, -32, -31, 8, -48,
+    -110, 72, -127, 124, 101, 124, 73, -127, -98, -46, -81, -112, 106, 105, 68, -63, 90, 81, -45, -95, -93, -23, 85, -108, -18, -37, 100, -89, 40, -45, 37, 82,
+    83, 88, -53, -57, -96, -62, -97, 72, -116, -79, 74, 69, 121, -30, -116, 79, -55, 70, -123, -119, 25, 47, 16, 8, 25, -94, -111, -38, 12, -64, -82, -14,
+    -23, -59, 109, 113, -116, -5, -67, -42, -120, -107, -119, -96, 38, -108, 99, 77, -59, 49, 115, -98, 15, -9, -48, -54, -106, 38, -77, -20, 109, -39, -47, 110,
+    21, 18, -71, 36, -31, 11, -26, -107, 96, 49, 117, -49, -56, -93, -50, -45, -81, -60, -53, 91, -14, 82, -115, -80, 116, -115, -110, 5, -54, -78, 28, 28,
+    -57, 92, 73, 107, -30, -30, -20, -81, 86, 108, -42, 43, -42, 92, -35, -73, -71, -3, -71, 64, 32, 17, 43, 1, 16, 54, -40, -22, -63, 9, 0, -72,
+    42, -33, 12, -22, 27, 65, -83, 47, -73, -16, 32, -22, 54, -45, -47, 48, 36, 58, -39, -22, -5, 4, -17, 75, 7, -46, -38, -28, 67, -13, -1, 65,
+    -52, 103, -58, -84, -72, 22, -23, 59, -21, 22, -15, 30, 49, -35, 11, 53, 69, -30, -127, 55, 25, 93, 58, 6, 43, -15, 22, 67, 9, 70, -23, -25,
+    30, 8, 63, 12, 0, 45, -11, 70, 20, 58, -118, -77, 26, -47, 32, -74, 42, -17, 14, 64, 68, -66, -19, 9, -65, 13, 65, 68, -41, 24, 67, -33,
+    49, 127, 127, 16, 111, 85, -32, 35, -63, 43, 34, 45, 69, 19, -20, 46, -50, -31, -20, 23, 34, 76, 26, 36, 19, 62, -54, -18, 16, 22, 36, 52,
+    -67, -29, 44, 64, -30, -61, -93, -42, -33, -23, -46, -32, -23, -28, -57, -8, 28, 37, -8, -67, -23, 5, 11, 19, 0, 29, 36, -36, -28, -75, -8, 23,
+    -58, -37, -1, -55, -33, -5, 72, -36, 6, -6, -6, -25, -7, 52, 17, -52, 56, 40, -66, 8, 31, -24, 12, -2, 28, -72, 54, -36, -7, -51, 48, 67,
+    -38, 25, 15, 9, -65, 72, -53, 54, -55, 48, -18, -8, 9, -16, -71, -111, 52, 6, -14, -19, 9, 41, -39, -11, -58, -46, -71, -55, -18, 45, -37, 4,
+    -36, -35, 56, -17, -33, 4, -46, -29, 60, -39, 8, -47, -21, -118, -89, 30, 44, -127, 73, -27, -63, -91, 4, -17, -21, 51, -7, -47, -116, 7, 38, -19,
+    -39, 59, 27, -21, 14, -43, 49, 2, 32, -72, 65, -50, 12, 7, -56, 48, -1, -2, 18, 30, -71, 5, 31, 35, -5, -31, -20, 51, 85, -45, -3, -109,
+    51, -81, 13, 65, -8, 24, -32, 43, -14, 41, 20, -7, 14, -27, 71, -72, 1, 71, -37, 48, -4, 75, -1, 42, 37, 83, -29, 28, -89, -64, -43, 21,
+    -34, 15, -37, -15, 108, -25, -52, 55, 7, 33, -14, 89, 19, 24, -17, 86, -30, -2, 28, -7, -16, 15, -7, -38, 56, -35, 2, -4, 60, -8, 67, -71,
+    38, 82, -89, 45, -75, -124, -38, 32, -60, 98, -127, -52, -40, -52, -52, -120, -64, -71, 33, -34, 31, -26, -38, -72, -60, 70, -31, -52, -85, 85, 38, 40,
+    50, -58, 51, -103, 39, -45, 27, -75, -47, 36, 100, -57, -76, -96, 41, 82, -86, -40, -77, 94, -98, -100, 47, 95, 49, -81, -23, 10, 92, 46, -85, -22,
+    59, 2, 30, 93, 101, 77, -4, -58, -93, -70, 27, 53, 75, 83, -55, -43, -83, 1, 86, 57, -26, -71, 79, 71, 60, -51, -36, 6, 78, -68, -19, -108,
+    -120, -64, 67, 37, 0, -23, -52, 46, -13, -103, 15, 122, -91, 99, -100, -35, 102, 105, -64, 39, 14, -18, 50, 19, -70, -3, 28, 16, 18, 44, -94, -116,
+    -76, 74, 33, 108, 124, -40, 10, 4, 4, 93, 31, -18, 79, 33, 22, -35, 18, -28, 39, -9, 28, 39, -73, 19, -10, 37, -1, -96, 64, 32, 81, 7,
+    26, 69, 16, 96, 3, -47, -22, -1, 23, 7, -6, 62, 42, -46, 9, 20, 39, -80, 2, -48, -7, 46, -97, 28, -15, 114, 34, -64, 67, 68, -32, 25,
+    -54, -28, -13, -41, 54, -15, 14, -21, 20, 59, -9, 68, -50, 23, -11, 35, 43, -86, 61, 41, -15, -66, 39, -11, 78, -91, 4, -25, -23, -21, 16, 71,
+    -37, 51, -40, -127, -68, -17, 56, 0, -51, 54, 37, 6, 37, 12, -76, 22, -53, -34, 64, -50, -27, -34, -90, 13, -41, -91, 13, 33, -46, -30, -45, -54,
+    90, -26, -104, -56, -65, -117, -46, -86, -75, 39, -89, -123, -84, -55, -87, 20, 90, 78, -11, 67, 68, 29, 71, -34, 57, 1, 55, 55, -112, 78, -119, -22,
+    18, 76, -113, 39, -42, -118, -45, 31, -108, 82, -117, -69, -46, -112, 102, 111, 96, -79, 78, -45, -56, 43, -107, -127, 102, -41, 69, -23, -105, -11, -86, -108,
+    -124, -29, -64, -45, 110, 77, 47, -67, 58, 45, 3, -69, -77, -24, -59, 91, -13, 40, 95, 25, -88, -49, 100, -116, -73, 25, 83, 75, 53, 46, -35, -113,
+    29, -110, 69, -95, -122, 119, -87, 16, -113, 114, -124, 42, 81, -55, -126, -119, -113, 59, 3, 94, 29, 19, -78, -73, 114, 108, -20, 69, 50, -59, -79, 58,
+    54, 31, -55, -81, -48, -58, 116, -51, 40, -71, 76, 49, 59, -6, -8, -84, -93, -24, 49, 74, 12, -43, -114, 44, 33, -36, 59, 9, -27, 19, 37, -43,
+    55, 39, -35, -89, -16, -57, -7, 84, 45, -66, 26, -54, -44, -54, 41, 21, -116, 62, 38, -8, -87, -21, 26, 28, -11, 33, 15, -40, -56, -58, 10, -4,
+    -6, 21, 76, -44, 38, 32, 38, 51, 31, 11, -6, 29, 20, 20, -39, 6, 86, 68, 76, 0, -127, 63, -2, 71, 58, 34, -17, -6, -24, 2, -8, 40,
+    33, -3, 8, 38, -9, -67, -72, -22, -31, 74, 126, -107, 30, 10, 28, -18, 54, -101, -39, -76, -31, -29, -25, -22, 25, 27, 10, 14, 9, -4, -3, -16,
+    -68, -43, -69, 10, -111, 11, -23, -126, -57, 121, 20, -112, 20, 52, -94, -25, -73, 11, 83, -67, -92, -92, 29, -110, 7, 79, 68, 44, -125, -17, -66, 4,
+    -89, -93, 116, 98, -103, 84, -111, -41, 127, 113, -8, 52, -30, 89, -47, -75, -91, 34, 15, 103, -91, 78, 114, 63, -99, -89, -106, -43, 66, -91, -13, -117,
+    46, -103, 75, 29, -79, 51, -39, 6, 14, -59, -21, 73, 93, 89, 17, 95, -92, 124, -117, 102, 75, -28, 74, 117, -86, 38, -127, 42, -112, 43, -121, -25,
+    94, -50, 120, -7, -82, 112, -88, 24, 113, 113, 14, -74, 0, -53, -48, -47, -76, -118, 64, -125, 19, -34, 38, 21, -5, 71, 18, 102, 22, 96, 93, 53,
+    -44, -3, -107, 57, 37, 81, -106, -95, 37, 59, -109, -120, -45, -41, -114, -103, -76, -124, -90, -121, -33, 63, 41, 27, -8, -80, -115, -80, 114, 80, 18, 29,
+    63, 82, -66, 77, 38, -57, -54, -84, 12, 120, 74, -85, -97, -56, -86, -91, 59, -47, 17, -47, 124, 24, -92, 71, -54, -11, -54, -3, -49, -46, -87, 117,
+    -75, -55, -23, -98, -69, -24, 21, 9, -34, 45, 63, -60, -66, 32, -23, 84, -125, 11, -39, -73, 94, -72, 74, 90, 119, -98, -88, -106, -46, 104, 37, -88,
+    -101, 64, 31, -127, 22, -79, -53, -102, 125, -11, 30, -76, -32, 38, 63, 104, -64, -66, -25, -49, 82, -33, -32, 1, 16, -37, -125, 60, -98, 90, -65, -62,
+    -5, 83, -40, -15, -30, -103, -60, 85, 91, -68, 83, -127, 39, -124, -31, -32, -27, 92, -47, -124, -104, 45, -98, -115, -83, 96, -27, -91, 23, -41, -2, 101,
+    32, -5, 103, -12, -22, 67, 93, 38, -45, -32, -124, -73, 53, -17, 72, 26, 3, 60, -14, 26, -15, -45, 49, -112, 99, 95, 66, -21, -25, -37, -24, -79,
+    56, 77, -13, 71, -63, 69, 96, 26, 96, 40, 31, -21, -115, -101, 62, -87, 31, -91, 45, 91, 14, -121, 41, -18, 70, -94, -65, 84, 66, 82, -5, 26,
+    85, 25, -108, -91, -127, -102, -123, -42, 13, 71, -35, -91, 80, 83, 98, -122, 7, 18, -7, -86, 85, -3, -120, -49, 41, -84, 49, -82, -30, -61, -98, 77,
+    -41, 65, 100, -56, -127, 6, -68, 96, -86, 57, -122, -59, -78, 90, 25, 41, -107, -49, 101, 29, 66, 0, -76, 106, -61, -85, 38, -106, 68, 54, -30, 4,
+    -3, -109, -108, -38, -127, -81, -35, 33, 4, -84, 67, 76, 42, 48, -63, 87, 22, -83, 47, 33, 18, -7, 69, 59, 23, -111, -69, 123, -25, 34, -95, 18,
+    28, 67, 120, -11, -48, -87, -43, -15, 119, 3, 45, 60, -125, -69, 10, -114, -90, 65, 45, -93, -98, 88, -7, -47, 56, 43, 127, -102, 69, -10, -65, 0,
+    -123, -96, -100, 49, 54, -66, -50, 70, -29, -39, 114, 11, 10, 28, -118, -26, 74, 39, 100, -49, -6, -68, -81, -105, -77, -86, -16, -23, 68, 71, 10, 40,
+    -11, -50, -3, 29, 109, 74, -110, 32, -105, 28, 83, 46, -98, -22, -77, 36, 48, 56, -39, 22, -75, 103, 105, -120, 13, 50, -71, -118, -127, 47, -125, -31,
+    69, -113, 49, -21, -31, -7, -39, 86, 38, -31, -97, -2, 119, 93, -112, -41, -9, -26, -100, -82, 5, 51, 50, 39, 40, -124, -71, -43, -64, -31, -28, -44,
+    -124, 87, 110, 25, -60, -16, 98, 21, 44, 45, 116, 35, -101, -2, 102, -96, -113, -114, -109, -86, 64, 21, 54, 10, -39, 67, -86, -39, -26, 41, 62, 13,
+    23, -57, 19, 82, -18, 59, -1, 0, 23, -92, -74, -85, 6, 39, 49, -74, -45, -90, 34, -23, -60, -71, 107, -7, 118, -48, -74, 50, 99, -87, 87, 18,
+    45, 61, -2, 63, -17, -15, 6, -55, 5, 0, -39, 44, 43, -17, 13, -20, -6, 34, 25, 48, 78, -64, 0, -46, -5, 36, 38, 65, -21, 57, 27, 37,
+    24, 25, -25, 41, -29, 42, -3, 9, 52, 44, 63, -48, 91, 61, 16, -19, -127, 50, 32, 52, -21, 25, 43, -1, 9, -34, -13, 44, -28, -30, -71, 55,
+    -13, 5, 8, 32, -31, 58, -35, -5, -11, -14, -16, 3, -17, 8, -43, 26, 18, -29, 86, -5, 42, 60, 9, 57, -17, 38, -68, -75, 15, -14, 20, -72,
+    61, -48, -2, 42, 36, -40, -28, 19, 21, -1, 63, 3, 29, -47, -42, 75, 25, -19, -118, -68, 22, -8, -10, 32, 9, 23, -22, -97, -21, 46, -16, -21,
+    -9, 127, 76, 3, 31, 5, -65, 71, 75, -15, 10, -13, -14, 15, -38, 38, -4, 26, 45, -1, 1, -25, 20, 28, 8, -37, -74, 51, 6, -27, 37, -59,
+    -3, 13, 35, -14, 56, 73, 54, 12, -36, 82, 21, 27, 23, -33, 31, 26, -50, -28, -47, -31, 72, -31, -5, 48, -63, -31, 28, -34, 28, 28, 10, -52,
+    -56, 30, 53, 21, 20, 7, -24, -1, -82, -19, 61, -28, 49, 40, -21, 43, -28, 51, -49, 20, 73, 44, 10, -18, 14, 0, -67, -11, 47, 2, -45, 41,
+    15, 73, 30, -71, -82, -38, 40, -17, -48, 57, -40, 23, 68, 35, -67, -32, -37, 49, -18, -32, -22, -80, -1, -22, -45, -16, -18, -5, -16, 4, -35, 22,
+    -21, -49, -37, 32, -86, -21, -4, -115, 31, -59, 24, -50, 44, -45, 9, 82, -6, 26, 40, -15, -2, 4, 66, -4, 88, -33, -14, 82, 1, 56, 12, 20,
+    70, -29, -79, 23, 12, 95, -51, 5, -30, -103, 9, -22, -23, 12, -56, -60, 81, -60, -85, 63, -74, -3, -10, 62, 33, 10, -36, -4, -34, 12, -72, 60,
+    54, 8, -18, 47, 64, -1, -44, 38, -116, 12, 98, -19, 49, 39, 78, -85, -30, 70, -90, 74, -38, 20, 80, 27, -7, -24, 39, 80, -25, 19, -3, 54,
+    -10, 43, 89, -2, -18, -50, 17, -9, 76, 13, 33, 55, -7, -15, 68, -1, 20, -38, -56, -17, -127, 21, 5, 27, 101, -8, -115, -13, -93, -51, -43, -29,
+    28, 57, 72, 83, 12, 46, 34, -22, 110, 5, -65, -33, -29, 41, 2, 81, -68, -29, -17, 20, 7, -127, -4, 64, -10, -27, 37, -43, -70, 47, 116, 3,
+    23, 55, -72, -16, 19, 84, -56, -69, 12, 53, 56, -85, 40, 43, 55, 22, -9, 73, -92, -19, -88, -42, 53, 52, -35, 9, -23, 16, 3, -24, -24, 10,
+    61, -20, 50, 68, -85, 26, -25, 43, -33, -36, 6, 23, -85, -81, -34, 108, -13, 72, -42, 50, -24, 58, -24, 19, 2, -36, -18, -83, 27, 77, 63, -85,
+    53, -33, -36, 3, -42, -3, -25, -9, -4, -6, -30, 36, -8, 10, 38, 56, -29, 99, -61, -40, 19, -113, 17, -74, 45, 10, 26, -43, 22, -61, -9, -49,
+    24, 43, -9, 43, -12, 29, 64, 32, 77, -14, 55, 16, -38, 28, 38, 101, 49, -59, 22, 56, 5, -20, -39, -15, -77, 9, 16, 45, -103, 68, 52, -35,
+    54, -20, -127, -10, 49, 95, -51, 18, -66, 16, -81, 8, 57, 21, 14, 38, -86, 25, -74, -76, -48, -6, 40, -15, 8, 62, -6, -28, 3, 36, -58, 25,
+    17, 55, -28, 58, -58, 40, -4, 16, -13, -59, 61, 3, -41, -40, -87, -1, 62, 48, -6, 2, -90, 58, -82, -27, 88, 72, -20, 29, -44, 121, 32, -83,
+    73, -65, 65, -72, 2, -44, -23, 26, 21, -11, 42, 54, -84, -3, -71, 33, 39, -11, 9, -71, 35, -55, -34, -35, -7, 68, 76, -72, 15, -42, 32, -84,
+    55, 60, -39, -61, 67, -47, -30, 34, 10, -39, -52, 89, -37, 31, -21, 84, -11, 110, -15, 20, -23, -74, 51, -52, 4, 74, -60, 21, 42, 34, -62, 30,
+    -18, 45, -57, 47, 13, 104, 90, -60, 29, 40, 18, -12, 1, 25, -11, 31, -2, 28, 33, 79, -17, -89, -20, 61, 10, -105, -73, 20, -113, 84, -81, 80,
+    86, 17, 59, 41, -15, 5, -64, 11, 39, 6, 37, -47, -32, 59, -58, 27, 106, -33, 19, -7, -23, 51, 13, 67, 109, 91, 20, -26, -73, 123, -65, -38,
+    60, -61, -42, 88, 71, 8, 27, 69, 28, 58, 87, -7, -2, 15, 36, -9, -39, 66, -127, -47, 76, -93, 69, -85, 42, 100, 19, -43, 2, 78, -85, -61,
+    24, -86, 44, -31, 41, -8, -44, 22, -36, 36, 61, -121, 4, -34, 82, -70, -29, 45, 65, 77, 19, 28, -25, 17, 50, -7, 15, 3, 80, 40, -43, 1,
+    15, 22, -18, -66, 10, -100, -109, -25, 18, 48, 60, 88, 24, 8, 43, 17, 31, -22, 96, 50, 74, -4, 37, -35, -70, -6, -31, 53, 31, 32, 39, -42,
+    -24, -13, 21, -6, 45, 50, 51, 28, -63, -51, 121, -74, -100, -61, 43, -42, -7, 13, 26, -27, -19, 14, 42, 22, 20, -53, -23, 73, 26, 13, -39, -79,
+    -85, -74, -3, -61, -25, -76, -69, -40, -54, -55, -14, -11, -10, 103, 28, -109, -67, 25, 104, -29, 127, 66, -25, 9, -57, 7, -6, -10, 57, -28, -32, -18,
+    -40, -2, -13, 62, -21, 13, -106, -1, -53, 17, -23, -42, 39, -51, 73, -80, 7, 49, -84, -51, 30, 48, -4, -21, 44, -22, -41, 64, 5, 37, 10, 46,
+    5, -63, 51, -33, -2, -30, -18, -5, 22, -4, -18, 2, 49, 3, 32, 6, 61, -43, 35, 41, 68, 21, 7, 20, 10, -15, -48, 44, 39, -85, -48, -16,
+    -8, 31, 48, -127, -52, 49, -44, -17, 64, 10, 1, 89, -20, -35, 52, 41, -6, -17, -90, -33, -13, 59, -7, -50, -62, 8, -6, 20, 23, 64, 4, -16,
+    33, 15, 13, 3, -24, 29, -69, -5, 5, -18, 28, -81, 20, -50, 3, 38, 32, 53, -1, -71, 76, -29, -49, 26, 27, 5, 43, -48, 45, -43, 65, 60,
+    64, -123, -107, -62, -80, 39, -100, -108, 1, -114, 66, -48, -56, 19, 113, -59, -75, -40, 64, 99, -93, -123, -55, -51, 57, 39, 56, -33, -24, 104, -121, -126,
+    -127, 72, -3, 39, 32, 72, 2, -49, -106, -28, -82, 99, 56, -61, -6, -14, 19, 104, -65, 23, -7, 106, -75, 33, -108, 4, 109, 48, -124, 114, 4, 15,
+    104, 15, -76, -22, 56, -35, -88, -35, -105, -107, -98, -6, -53, -87, 50, 20, 75, -90, 24, -67, -6, -19, 14, 11, 98, 25, -43, 65, -92, 62, 13, -66,
+    58, -103, -121, -62, -8, 26, -51, 14, 114, 119, 48, -55, -12, 71, 91, 107, -35, -47, -47, 65, 109, 11, -21, 32, -28, 10, -84, -105, -31, -63, -94, 109,
+    16, 71, 127, 41, 52, 67, 76, 54, -15, 46, -38, -55, 64, -31, -27, -51, 29, -3, -6, -8, 70, -10, -73, 17, -72, -1, -49, -44, 33, 15, 7, -54,
+    -6, -23, -15, 13, -34, -29, 48, -64, 34, 30, -3, 6, -20, 14, 1, -30, 25, 19, 39, 22, -17, -24, 30, -20, -29, 59, 54, 47, 41, -11, 47, -57,
+    -71, -24, 11, 24, 11, -13, 16, -41, 29, 15, -34, -35, -12, -13, 20, -15, -6, 23, 20, 14, -9, -25, 21, -41, -50, -7, -74, 37, 20, -8, 32, -29,
+    -29, 5, 72, -72, -8, 35, -69, -3, -18, -20, -32, 39, -23, -27, -23, -114, -10, -48, 66, 65, 23, 32, -11, 0, -23, 2, -53, 61, -25, -32, -15, -12,
+    81, 56, -114, 56, 93, 39, 37, -65, 39, -38, 92, 40, -50, 83, 57, -80, -76, -124, 55, -108, -63, 48, -56, -60, -113, -117, 8, -95, 102, -122, -53, -85,
+    87, 51, -102, -116, -108, 48, 50, 24, -12, -18, 14, -102, 62, 57, 34, -70, -75, 106, 98, 50, 59, -19, 81, 37, -24, 36, -109, -34, 73, -14, 4, 6,
+    98, -80, 35, -21, -72, -117, 17, -84, 11, -26, -31, 84, -107, 5, -29, -92, -34, 79, -81, 34, -64, -4, 3, -111, 65, -38, -78, -79, 107, 97, -16, -64,
+    41, -115, 77, -127, -117, -49, -20, -125, -60, 107, 56, -113, 81, -17, 108, -52, -54, 36, -12, -63, -3, 24, -54, 69, 52, 52, 29, -74, 40, -84, -94, -8,
+    -25, -127, -58, -19, -100, -21, -36, 11, 5, -33, -50, 51, 4, 3, 12, 49, -9, 66, -34, 0, -35, -19, 47, 50, 33, -21, 28, 47, 18, -41, 28, 32,
+    39, 62, 20, -85, 37, -2, 2, 76, 23, -6, 11, -71, 82, 19, -41, 10, -28, 72, 24, 21, 40, 72, 28, -30, -12, 48, 54, -9, -4, 20, -27, 72,
+    43, 3, 30, -21, -24, -22, 13, 50, 71, 51, 27, -2, -45, 44, -24, 56, 62, -16, 97, -27, -40, 50, 7, 39, 71, 5, 60, -16, -44, -46, -36, 6,
+    31, 20, -38, 49, 13, 5, 61, 13, 95, 6, 13, 51, 51, -5, 19, 46, -4, -25, 31, 36, -30, 15, 6, 17, -1, 51, -20, -19, 37, 85, 4, 54,
+    2, -74, -25, 21, 2, 63, 5, -34, -2, -1, -124, -47, 12, 46, -22, 55, -5, -37, -67, 68, 98, 52, -74, 45, -4, 98, -127, 62, -14, 82, 21, -126,
+    42, 3, -70, -98, -30, 10, -11, -124, -92, 40, 6, 54, -26, -65, 67, -73, -113, -38, -15, -77, 106, -68, -98, 34, -93, -59, -26, -59, 32, -94, 31, -99,
+    15, 113, 66, 104, 6, -89, -37, 63, -95, 36, -45, 98, -43, -48, -61, 5, 106, 5, 55, 0, -108, 16, 18, 19, -54, -62, -47, -121, -88, -58, -2, 95,
+    44, -2, 48, -18, -117, 40, 45, 34, 82, 64, 76, -115, 118, 16, 17, 23, -62, -54, 88, 21, 108, -76, 16, 19, -119, 27, -34, -23, -83, 18, 39, 90,
+    76, 109, 108, 42, -60, 1, -110, 8, -53, 2, 55, -113, 84, -119, -8, -75, -118, -14, -66, -109, 73, -69, 99, 20, -44, -116, 80, -101, 59, -2, -17, -108,
+    -26, -123, 55, 44, -94, -4, -84, 45, -82, -88, -59, 108, 71, -30, 65, -40, -84, 90, -120, 65, 105, -107, 80, 60, -117, -19, -65, -34, -35, -31, -127, -61,
+    -60, 30, 39, 52, 25, 89, 5, -52, -120, 49, 8, -88, -4, 99, 17, -53, 66, -32, -124, -109, 106, -105, 62, -122, -24, -59, -45, -108, -33, 57, 0, -95,
+    68, 84, -18, -40, -123, -111, -36, -100, 107, 29, -52, 15, -87, 92, -6, 40, -84, -12, 43, -33, -112, -16, 70, -15, 109, 6, 87, -120, 25, -4, -41, 88,
+    -36, 8, -18, 58, 43, -32, -16, -59, -43, 20, 45, 76, 22, 10, 0, 26, -68, 4, 14, -30, 77, -105, 57, -33, -39, 3, 24, 64, -16, 61, 44, 64,
+    -31, -1, -99, -15, -29, -27, 60, -3, -19, -42, -35, -29, 37, 33, -6, 66, -61, 21, 35, 62, -5, 38, -13, 54, 19, -48, 8, 73, -8, 24, 24, 57,
+    78, -70, 26, -35, 3, -34, 24, 80, 34, -83, 20, -38, -5, -11, -67, 2, -17, 32, 9, 52, 36, 17, 20, 65, 10, 71, -9, -92, -34, 47, -64, 28,
+    84, 12, 37, 22, 44, 12, -3, 34, 6, 31, 27, -66, -51, 27, 44, 80, 52, -10, -57, 22, -60, 21, 22, -4, 43, 55, -52, -127, 50, 64, -14, 33,
+    -59, -74, -55, -13, -64, -72, 127, 58, -59, 30, 71, 8, 83, -10, -38, -35, 8, 28, 26, -59, 38, -72, -82, -5, -26, 78, 66, 27, -25, -17, -33, -15,
+    14, 20, -39, 10, -78, -34, -22, 111, -29, -48, 15, -101, 87, 93, 7, -61, 5, 52, 26, 33, 57, 38, -67, 9, 16, 94, -10, -66, 70, -15, 78, 35,
+    62, 23, 97, 71, 20, -5, 4, 7, -14, -24, -47, -24, -51, -11, -90, 34, 1, -30, 41, 66, -89, -74, 38, -46, 115, 28, -61, 1, -108, 99, -74, 79,
+    48, 28, -51, 64, 33, 12, 2, -19, 45, 110, 37, 20, -4, 5, 39, 40, -6, 19, -39, 0, -41, 58, -43, 46, 52, -32, 74, -79, -5, -34, 2, 32,
+    45, 80, -124, 8, -31, 39, 0, -44, -126, -53, -20, -46, -36, 30, -46, 79, -40, -23, -23, 92, 18, 107, -127, 103, -80, 90, -117, 80, 25, 38, -33, -34,
+    -90, -93, 22, -45, -121, -86, -87, -82, -18, 93, 13, 52, -103, 40, 82, 114, 45, 19, 105, -97, 65, 47, 48, -41, -109, -94, 36, -53, 102, -98, 70, -12,
+    -57, -66, -42, -39, -73, -76, 107, -26, 22, 43, -48, 99, -57, -81, -117, -64, -113, 25, 12, -123, 104, 49, 5, 102, 0, -86, 61, 103, -114, -6, -72, 91,
+    -105, 68, -79, 28, 40, 57, -115, -11, -98, -97, -89, -92, 99, 7, -67, -10, -115, -76, 24, 41, 22, 111, 109, 74, -15, 55, -67, 81, -69, 112, -125, 65,
+};
+constexpr int32_t kAeL0Bias[64] = {
+    61038, 72282, -101861, 7759, -78464, -190464, -214227, -33475,
+    46234, 15484, -34869, -18284, -105728, -121216, -22115, 103475,
+    -151886, -84822, -77655, 46725, -119260, -52992, 56233, 54469,
+    -159473, -5781, 103471, -138560, 214401, -170821, -251520, -155648,
+    -266880, 47194, -228224, 86957, -12902, -23014, -125854, 44034,
+    -205409, 1042, -54016, -287872, -109094, -120192, -111872, 85292,
+    44983, 10948, 17198, 18679, 151641, -3538, 7041, -158795,
+    -12539, -184176, 190466, -111719, -232637, 109240, 76672, -144959,
+};
+constexpr int32_t kAeL0Multiplier[64] = {
+    1163266362, 1590069226, 1399360947, 1191562686, 1439277119, 1432190634, 1503518339, 1333067800,
+    1594359498, 1223373035, 1466064979, 1212787464, 1440996623, 1427858954, 1100178129, 1120707812,
+    1541083270, 1549686042, 1500840434, 1127454919, 1537838126, 1439311963, 1409100498, 1150237861,
+    1502787709, 1155990353, 1416354471, 1532453688, 1215647000, 1474993718, 1438018849, 1439385631,
+    1445729448, 1544731777, 1441620901, 1118775287, 1343843201, 1567238331, 1658679034, 1244702732,
+    1486041866, 1401595427, 1435872578, 1441766673, 1582620178, 1432648420, 1488986601, 1683238398,
+    1424076346, 1424763543, 1285106726, 1432547525, 2131167806, 1570086528, 1505125229, 1475147452,
+    1627117192, 1539903633, 1602811343, 1498606831, 1517566799, 1714806274, 1139998295, 1515754789,
+};
+constexpr int8_t kAeL0Shift[64] = {
+    -8, -8, -9, -8, -9, -9, -9, -8, -8, -8, -9, -8, -9, -9, -8, -8, -9, -9, -9, -8, -9, -9, -8, -8, -9, -8, -8, -9, -8, -9, -9, -9,
+    -9, -8, -9, -8, -8, -8, -9, -8, -9, -8, -9, -9, -9, -9, -9, -8, -8, -8, -8, -8, -9, -8, -8, -9, -8, -9, -8, -9, -9, -8, -8, -9,
+};
+
+// Layer 1: 64 -> 24 relu
+constexpr int32_t kAeL1ZeroPoint = -128;
+constexpr int8_t kAeL1Weights[1536] = {
+    9, 40, 1, 77, 24, 16, 51, -127, 47, 4, 23, 63, -12, 3, 48, 0, 45, -55, 7, 17, -12, -48, 46, 18, -14, -44, 38, 30, 21, 36, -27, 14,
+    -4, 27, -10, 20, 103, 29, -16, 47, 16, 1, 17, 18, 30, -38, 20, -7, 62, 37, 34, 35, -33, -85, 50, -51, 85, 22, -33, 18, -39, 16, 34, -55,
+    30, -35, -10, 48, 28, -11, 46, -92, 1, 11, 37, -39, -17, -2, -46, 14, 36, 38, -33, -26, 46, -40, 29, -26, 38, -1, 25, -44, 10, -8, -37, -9,
+    23, 2, 9, -16, 3, -54, 41, 37, -7, -47, -20, 6, -36, 44, -9, -54, -11, 57, -26, -16, 43, 127, -57, -32, 8, -13, 38, 5, 40, 22, 20, -10,
+    -40, -6, 39, 77, 74, -44, 52, -34, 49, -120, 77, 42, -83, -58, -52, -11, 90, 105, 20, -98, 107, 108, -102, 25, 36, 31, 42, -121, -67, -39, 35, -95,
+    -52, -80, -106, -11, -74, -9, -73, 62, -92, 56, 37, -80, -33, -28, -15, 29, -120, -83, 39, -104, 69, -35, -114, 58, -64, 112, 77, 87, 85, -116, -127, -28,
+    -31, -31, 26, 63, 70, 104, 42, 86, -111, -121, -16, 86, -28, -95, -98, -77, 83, -46, 82, 101, 63, 103, -71, -85, -64, -127, 93, -77, 17, -55, 10, -16,
+    54, -78, -51, -94, -49, 75, 107, -123, 81, 50, -102, -82, 83, -74, 96, -4, 107, -5, -100, 17, -26, -111, 71, 93, 106, 29, 6, -78, 108, 43, 33, 42,
+    40, -9, -36, 72, -43, -21, -2, -127, -16, 35, 11, 36, -44, -7, -33, -4, -14, -7, -18, 29, -4, 37, -8, -38, -13, 36, -11, 29, 9, -21, -28, -35,
+    -5, 43, -19, 42, -16, 57, -33, 71, -36, 54, -9, -19, -41, -26, -10, 43, 49, -37, 9, -40, -33, -42, 25, 37, 53, -31, -1, 27, 25, 11, -4, 8,
+    2, 22, 35, 4, -5, -6, 33, -55, 8, 24, -10, 55, 3, -36, -5, -21, -8, -12, -15, 56, 36, 23, 29, 38, 38, -16, 49, -30, -22, 27, -32, 42,
+    39, -15, 12, 45, 24, 37, 6, 28, 8, 51, 41, -38, -23, -45, -38, -17, 48, -11, 26, -5, 52, -127, 33, -11, -23, -38, -15, -28, -43, 53, -19, -43,
+    41, -7, 36, -38, -69, 27, -19, 9, -19, -57, -60, -45, -50, 4, -44, 86, -57, 84, -31, 68, 88, 54, 83, 101, -35, 43, 29, -88, -93, 85, 42, 62,
+    -60, 127, -38, -105, 36, 27, -84, 100, 71, -12, 10, 71, -23, 2, -49, -23, -15, 72, -82, -114, 73, -100, -39, 40, -23, 82, -47, -58, -83, 81, -47, 76,
+    2, 73, -59, 96, 70, 31, -53, -127, 35, -25, 65, -9, -54, -71, 7, -14, -61, -4, 53, -81, 19, -48, 20, -32, -34, -77, 10, -14, 8, -47, 70, -70,
+    -44, 65, -53, -36, 62, 61, 71, 36, 22, -92, 57, 25, 57, -42, -1, 42, -24, 74, 42, 43, -49, 106, 42, -53, -33, 49, -37, -35, -18, 21, -33, -49,
+    25, 83, 42, 109, -53, -36, -31, -35, -67, 70, -53, -21, -7, 122, -42, 35, -42, 74, -28, -119, 6, -40, -58, -61, -122, 57, -2, 33, -3, -29, -10, -6,
+    102, -38, -85, -102, -40, 18, 20, 56, 39, -108, -27, -32, -95, 22, 67, -127, 7, -93, 67, 9, -121, -5, -63, -72, 41, -23, 87, 102, 87, -35, 91, -105,
+    58, -39, 91, -117, 19, -107, -51, 11, -101, 40, 3, -73, 9, -13, -119, 42, 53, 102, 110, -36, 36, 27, -120, 54, -57, -25, 13, 1, -72, 93, -101, 26,
+    -78, 97, 108, 51, 86, 66, 38, 54, 102, -73, 57, -80, -10, -40, 33, 16, 90, 85, -114, -92, -127, 52, -38, 118, -75, 113, 49, 65, 27, 79, -72, 92,
+    89, 43, 28, -75, -2, 16, -33, 20, 111, 63, -21, -9, 17, 84, 38, 70, 55, -68, 19, 127, 62, 77, -70, 69, -39, 93, 83, -17, 38, -4, 81, 10,
+    -77, 9, -88, -55, -18, 78, -79, -36, -37, 30, -10, -85, -80, -48, 42, 99, 29, -103, 89, 86, 83, -94, 30, 2, -55, -80, 33, -40, 87, 77, 90, -81,
+    33, 36, -4, -2, -2, 7, -8, -127, 17, 70, -29, 96, -58, 25, -25, 11, -17, -52, -41, 57, -9, 59, 25, 48, -8, 62, -2, -31, -63, -56, -51, 24,
+    -18, 92, -40, 64, 3, 3, -17, 19, -11, 36, -56, -33, -55, 36, -48, 7, 82, 12, -45, -26, 59, -59, 61, -47, -15, 38, -8, -23, 29, -47, 33, 13,
+    52, 0, 8, 54, 9, -42, 12, -47, 22, 38, 13, 26, -15, -50, -56, -127, -29, -21, -17, 6, 26, 28, 27, 45, 23, 2, -14, -45, -54, 37, -36, 37,
+    -10, -60, 34, -18, 96, 0, 48, 20, -24, 23, 16, 40, 36, 44, 6, -4, -13, 22, -35, -65, -9, 2, 7, 45, 74, 34, 13, 31, 12, 60, 26, -48,
+    -83, 102, 29, -79, 76, -76, 6, -125, -50, -53, -76, 10, -74, 23, -43, 54, 76, 74, 43, 57, -76, 88, 4, -15, 32, -83, -9, -72, 72, 1, -68, 87,
+    15, 33, 56, 42, 20, -57, -89, 11, -71, 15, 72, 75, 63, -57, 84, -89, 88, -35, 105, 100, 12, -83, 20, -34, -1, 14, -127, -10, -69, -35, 78, 81,
+    108, 52, 47, -34, 76, -70, -66, 43, -6, -115, 40, -106, 36, 12, 75, 53, 48, -1, 14, -24, 0, -79, 70, 104, -80, -61, -1, 8, 18, -30, 23, -19,
+    -18, -109, 18, -92, 25, 8, -37, -17, 75, -21, -19, 91, 71, -21, -26, 70, -108, -85, 39, 24, 28, -127, 47, -17, -73, 70, -30, 74, 40, 97, 81, -72,
+    29, -7, -42, -84, -31, -49, -46, 69, 72, 113, 11, 20, -58, -50, 61, 73, 9, 37, 44, 63, -61, 6, 49, 52, 60, 12, 29, -58, 13, 10, 55, 51,
+    -58, -40, -15, 63, -44, 102, 13, 81, -19, 5, -58, 2, 41, 2, 5, 66, 32, -42, 92, 66, -9, -127, 70, 4, -28, -45, 53, 50, -7, 12, 56, 66,
+    -96, 10, -16, -56, 5, 43, -34, -49, 93, 41, -50, -88, -30, 113, 85, -74, 27, -127, 104, 113, -73, -40, -51, -81, 47, -32, -127, -72, 41, 52, -124, 13,
+    36, 35, 39, 72, -42, 90, -15, -113, 39, -40, 35, -33, -1, 14, 53, -52, 44, -69, 75, -69, -110, -118, 25, -45, 19, -49, -16, 95, 109, -117, 115, 1,
+    25, 75, -30, -127, 38, 2, 39, 0, 47, 26, -42, -59, -31, -33, 0, -14, -35, 13, 41, -25, -13, 14, -116, 13, 40, -57, 6, -36, 48, -28, 30, -9,
+    42, -13, -1, -75, -81, -53, 13, 63, 30, 58, -40, -18, 33, 25, 6, -10, -61, -71, -39, -5, -32, -11, -25, 26, -18, 6, 46, -26, 13, -14, 98, -14,
+    -11, 79, 56, 116, 51, -56, 19, -120, 90, -11, -43, 57, 2, 87, 39, 61, -18, -15, 82, 2, -64, 51, -24, -9, 21, 78, -73, 27, -72, 24, 19, 3,
+    -13, 82, 83, -15, 72, 39, -8, -17, 74, 19, 79, -66, 36, 19, 32, 76, -41, 103, -69, -20, 84, -55, 127, 70, 49, -35, -70, -82, 42, 73, -73, 2,
+    82, 36, -21, 112, -20, -48, -1, -39, -30, -4, -111, 24, 21, 54, -69, -117, 50, -36, 22, -61, -39, -61, -2, 35, -68, -50, -13, 49, -35, -112, 5, -12,
+    127, 20, -116, 34, -107, -35, -122, 23, -84, 111, -78, 120, 103, 5, -9, -31, 64, -80, -40, -116, -21, -79, 106, -13, -74, -60, -85, -105, -114, 52, -101, 85,
+    50, 53, -38, -14, 12, 54, -25, 127, 22, -40, 13, -24, 37, 43, -36, 33, -15, 33, -40, 1, -10, 24, -6, 57, -58, -23, 38, -24, 68, -23, 20, -54,
+    50, -91, -11, -15, -83, -30, 0, -7, 57, 42, 27, -36, -34, -59, -49, 36, -81, -50, -4, -36, -11, -45, -43, -38, -102, 50, 63, 34, -28, 65, 63, -11,
+    -58, 58, -115, 9, 88, 99, 102, -17, -127, -44, -55, 10, 54, 115, -48, -38, -99, 80, 0, -71, 1, -4, 64, -68, 2, -21, -108, -87, -76, -16, 13, 59,
+    98, -109, 113, -31, 55, -40, 55, 35, -115, 84, -109, -2, -68, 22, -76, 13, 53, 22, 69, -41, 28, -15, 99, -97, 78, -117, 75, -99, 47, -105, 62, -66,
+    -41, 69, 9, 30, 38, -53, -52, 106, 67, -43, 53, -76, 35, 17, 2, -1, -25, 0, 3, -10, -61, 3, -48, -40, -31, -28, 68, -23, 36, -62, 21, 59,
+    33, 34, -11, 4, 38, 19, 1, 19, -19, 48, -60, 24, -39, -31, -34, 42, -28, 45, 58, 72, 38, -127, 30, -15, -69, -1, 55, 5, -41, 62, 88, 0,
+    -92, 59, 10, 79, 27, 95, -124, 39, 26, 71, -72, 22, -60, 65, -108, -88, 114, 61, -64, -48, -17, -68, -92, 120, -74, 64, 56, 60, -50, -71, 30, 127,
+    -29, -72, 2, -80, -39, 60, -66, -13, 37, -87, -91, 119, 94, 99, 19, 1, -100, -67, -99, 8, -16, -84, -103, 19, -92, -125, -70, 78, 40, 4, -70, -8,
+};
+constexpr int32_t kAeL1Bias[24] = {
+    86717, 10647, -91212, 10375, -7570, 27977, 8158, -6830,
+    -77053, 50398, 99838, 1754, 41452, 8500, 18557, 108985,
+    -54528, -42833, 135519, -138817, -12748, -52642, 36102, -81152,
+};
+constexpr int32_t kAeL1Multiplier[24] = {
+    1534114126, 1865388744, 1509393643, 1451937252, 1932893833, 1945100612, 1846586753, 1211732755,
+    1438941881, 1418465158, 1928226345, 1348552276, 1718334304, 1899468787, 1837872036, 1338896642,
+    1374319547, 1808750029, 1950198913, 1379888713, 1465627203, 1471431701, 1355343716, 1375545934,
+};
+constexpr int8_t kAeL1Shift[24] = {
+    -8, -8, -9, -9, -8, -8, -9, -8, -9, -9, -9, -8, -8, -9, -9, -8, -9, -8, -9, -9, -8, -9, -8, -9,
+};
+
+// Layer 2: 24 -> 8 relu
+constexpr int32_t kAeL2ZeroPoint = -128;
+constexpr int8_t kAeL2Weights[192] = {
+    -127, -45, -5, -106, 21, -15, -116, -91, -3, 103, -115, 16, -56, -29, 109, 34, -56, -12, 125, 95, -19, 8, -11, -91, 88, -48, -45, -63, 97, 87, 63, -20,
+    9, -15, 70, 28, 115, 127, 24, 34, 45, -63, 66, -29, -47, -50, 65, -2, -127, 17, 84, 98, 96, 80, -77, -3, 49, 34, -42, -118, 86, 65, 87, -34,
+    -60, 80, 30, 38, -112, -93, 56, 91, -39, 99, -86, 21, -40, 9, -81, -31, -10, 21, -79, 28, -77, 127, -69, -104, -61, 18, -14, 43, -104, -23, 15, 127,
+    55, -21, -28, -53, 30, 9, -2, 32, -5, 38, -30, -17, 127, -15, 35, -75, 59, -61, 60, 11, -79, -24, 2, 8, -15, -127, 119, -39, 50, 94, 116, -81,
+    96, 3, 24, -70, -93, 13, 85, -34, 111, 42, -124, 105, -109, -68, 1, 108, -40, -22, -51, -45, -20, 13, 20, -66, -7, -9, 55, -19, 25, -36, 47, 17,
+    56, 127, -19, -9, 62, -15, 56, -7, 117, -93, 75, -15, -72, 24, -117, -79, 92, 6, -43, -94, -90, -71, -10, -127, -78, -19, 101, 97, 115, -73, -99, 92,
+};
+constexpr int32_t kAeL2Bias[8] = {
+    -49408, 68768, 40299, -39680, 7808, 24664, 15467, -46208,
+};
+constexpr int32_t kAeL2Multiplier[8] = {
+    2111702383, 1689206371, 1155044690, 2051740384, 1985387094, 1115539043, 1198576161, 2067976033,
+};
+constexpr int8_t kAeL2Shift[8] = {
+    -9, -8, -8, -9, -8, -8, -7, -9,
+};
+
+// Layer 3: 8 -> 24 relu
+constexpr int32_t kAeL3ZeroPoint = -128;
+constexpr int8_t kAeL3Weights[192] = {
+    58, -74, -19, 124, 92, 127, -2, -89, 12, -120, -119, -127, -77, -104, -75, 61, 28, -127, 59, 53, 73, -46, 28, 9, 54, 98, -107, 88, 127, 43, -29, 11,
+    -80, 74, 11, 17, -127, -85, -92, -85, -82, 45, -71, -24, -127, -43, 77, 81, -11, 37, 29, 49, -9, -6, -127, 15, 40, 127, -37, 91, -14, -37, -55, -118,
+    55, -48, 93, -47, -51, 74, -31, 127, 7, 39, -41, -50, -127, 44, -17, 26, 9, 127, 106, -7, -74, -48, -45, -49, 85, 95, 127, -120, -88, 57, 44, 112,
+    98, -127, -105, -32, -43, -94, 86, 3, 29, 54, 19, 91, 127, 10, 54, -7, -19, 47, 16, -22, 127, 9, -83, 42, -1, 97, 80, -77, -127, 34, -30, 65,
+    41, 101, -36, 44, -97, 38, 127, -35, -70, 79, -93, 13, -47, 95, 67, -127, 127, -28, -55, -115, -94, -120, 1, -32, -63, 75, -127, -24, 85, 103, 80, 7,
+    -111, -44, 72, 91, 36, 127, 0, 113, 105, -86, -92, 127, -53, -13, -20, 91, -127, -5, -12, -105, -14, 95, -119, -65, 30, -35, 74, -44, 127, -30, 127, -18,
+};
+constexpr int32_t kAeL3Bias[24] = {
+    27776, -70272, 9632, 36742, -38895, -17809, -1358, -7760,
+    22016, -12798, 6317, 36515, -30424, 45944, 18770, 5901,
+    17593, -9946, -41694, 14617, 35514, 7552, -45260, 38118,
+};
+constexpr int32_t kAeL3Multiplier[24] = {
+    1686038126, 1580646775, 1489682727, 1892653801, 1098883379, 1252149885, 1194310913, 1944529269,
+    1877567218, 1111835874, 1409761801, 1240505570, 2023153357, 2082826812, 1427434567, 1228059254,
+    2082497038, 1877830900, 1854715480, 1601799574, 1513879213, 1885442647, 1883926937, 1740539514,
+};
+constexpr int8_t kAeL3Shift[24] = {
+    -7, -7, -6, -7, -6, -6, -5, -7, -7, -5, -7, -7, -7, -7, -6, -6, -7, -7, -7, -7, -7, -7, -7, -7,
+};
+
+// Layer 4: 24 -> 64 relu
+constexpr int32_t kAeL4ZeroPoint = -128;
+constexpr int8_t kAeL4Weights[1536] = {
+    -21, 59, 9, -87, -29, 58, -98, 54, -40, 31, -81, 13, 57, -112, 91, -85, -127, 42, 3, -120, 32, 2, 103, 73, 114, 7, 88, 63, -69, 53, -62, -24,
+    -127, -122, -3, 84, 74, -123, 13, -58, -111, -61, 54, 108, -122, -63, 75, -21, -9, 25, -57, 33, -19, 29, 26, 27, 10, 17, -39, -4, 127, -24, 16, 9,
+    13, 29, -13, 7, -38, 25, 25, 10, 53, 17, -48, 82, -101, 22, -108, 67, 1, 37, -91, -23, 44, -16, 61, -114, -39, -108, 66, -29, 68, 70, -127, 33,
+    75, 102, -101, -103, -20, 52, -96, 122, 52, -127, 55, -21, -80, 34, 53, 27, -69, -87, -108, -89, -34, -40, -106, 74, -21, -29, -51, 3, 13, -33, -39, -110,
+    -7, 32, 24, 21, 127, -15, 15, -6, -15, 16, 4, 9, -14, 30, 12, 16, 64, 103, -80, -81, 93, 21, 76, -55, 121, -41, 52, 83, 4, -41, -23, -115,
+    -127, 88, 38, -125, 22, -62, 84, -53, -102, 35, -5, 34, 127, -97, -106, 3, -8, -63, -31, -57, -54, 35, 55, 35, 29, 73, -50, -63, 104, 80, 38, 48,
+    4, -5, 28, -15, -127, -3, 9, -14, -13, -12, -8, 12, -9, 14, -7, -8, 9, 0, 10, 12, -1, -6, 13, 7, -40, -98, -31, -16, 91, 59, 3, 119,
+    25, 106, -127, -123, 105, 69, -70, -111, -125, -53, 112, -90, -73, 97, -92, -76, 7, 10, 29, -9, -25, 9, -5, -127, -8, 5, -9, -4, 13, 8, -100, -12,
+    12, 18, -3, -8, -6, 8, -6, 14, -58, 19, -26, -31, -59, -4, 11, 4, -14, -115, 31, -104, -24, 19, 54, 15, -105, 59, -89, -127, 46, 83, 26, 38,
+    38, -108, 31, 69, -2, 55, -8, -103, 94, -76, -77, -96, -40, -25, -78, -88, -13, -127, -2, -102, -95, -99, 90, 82, 99, 62, 1, -7, 46, 26, -118, 11,
+    82, 117, 109, 43, 21, 83, -14, 91, -83, -52, 1, 38, -63, 65, 18, -127, -28, -6, 32, 11, -24, 0, 5, -127, -6, 9, -29, -4, 25, 31, -46, -52,
+    4, 15, 2, 37, -1, 18, 14, 34, -21, -10, -97, -106, -99, -95, -107, -27, -90, 122, -24, -127, 41, 55, 115, -65, -47, 64, 32, 32, 111, 127, -126, -29,
+    108, -117, -37, 55, -104, 13, 102, 8, -121, -103, -31, -127, 44, -64, -38, 60, 49, 65, -76, -46, 33, 0, 75, -29, 30, -20, 11, 18, 39, -37, 99, 34,
+    10, -30, 24, -44, 36, -9, 11, -16, -4, -44, 24, 1, -25, 21, 9, -127, 18, 22, 0, 11, 48, 0, 110, -106, 40, 49, -7, -19, -30, -127, 28, -52,
+    -117, -41, 52, -62, 53, 1, -5, -45, -42, 38, 19, 4, 17, -73, -21, 32, 23, -127, 19, -55, 36, 47, 54, -75, -8, -41, 36, -34, 38, 48, 3, 33,
+    12, 43, -44, 27, 18, -37, 51, -97, -38, 31, 27, -87, 20, -78, -21, -36, -127, -27, -5, -56, 44, -12, -33, 66, 11, 34, 89, -3, -19, 31, 0, 37,
+    -12, 17, 6, 13, -127, 29, -5, -40, 5, -38, 11, 9, -21, -29, -27, 17, 21, 35, -127, -45, 12, 24, 62, -2, -19, 14, 22, -32, 17, 15, 52, -20,
+    -17, -43, -28, 14, -18, 35, -14, 30, -36, 66, -16, -74, -76, -55, -98, 94, 108, 76, -127, 98, 76, 88, 34, -75, -52, -28, -81, -121, 116, -28, 28, -101,
+    95, 67, -123, -80, 65, -118, -127, -102, -95, 73, 75, 19, -52, 76, 36, -117, -83, 52, 18, -28, 8, -69, 23, -96, 17, 11, 0, 19, 2, 4, 37, -3,
+    17, 10, -8, -13, -127, 12, 3, 1, 19, -13, -12, -3, 17, 7, 3, -2, -84, -119, -88, -93, -10, -44, 105, 91, 14, -95, -58, -127, 40, -40, 92, -58,
+    75, -38, 38, -48, 76, -68, -84, -119, -33, 65, -15, 83, 24, -14, 0, -127, 25, -99, -126, -127, -108, 14, -59, -57, -48, 104, -67, -76, -69, -51, -56, 67,
+    52, -12, -127, -44, -30, 36, -23, 114, -11, -12, 38, 51, 60, 0, 17, -4, 61, -33, 52, 15, 11, 20, -27, -29, -77, 84, -46, -122, 76, -65, 72, -45,
+    41, 54, -20, 99, 85, 84, -21, -127, -112, -120, 9, 100, 12, -19, -109, -51, -38, -5, 12, 74, -32, 55, -24, 50, 27, -13, -41, 6, -127, 80, -64, -30,
+    59, 25, -18, 5, -20, 20, 46, -39, 120, -24, -3, -75, -124, -91, -76, -22, -2, 97, -44, 74, -72, -10, -127, 111, -47, 38, 18, -7, -80, 95, -11, -111,
+    -26, 0, 5, -16, -27, 26, 44, -21, 20, -29, 19, 24, -127, 32, 25, -24, 14, 0, -23, -17, -18, 11, 6, 35, -30, -3, 111, -23, 27, 27, 100, -28,
+    -35, 15, 40, 33, 127, -16, -75, -9, -59, -7, 15, -62, -64, 34, 37, 88, 1, -127, -124, 108, 32, -125, -51, -125, 81, 37, 94, 19, -28, 94, -70, 36,
+    -109, -95, 31, -88, 102, 5, 122, 5, 4, 0, -127, -10, 15, 8, 22, -25, -15, 12, -8, 13, 33, -9, 5, 17, -15, 22, 9, -16, -24, 21, 9, 11,
+    -6, -28, -127, -6, -21, 28, 90, -71, -14, 24, 5, 8, 47, 15, -2, -23, 1, -21, 27, -34, -16, 15, -6, 42, 85, 47, -36, -27, -58, -59, -127, -65,
+    51, 0, -56, -56, -83, -121, -106, 17, 101, 38, -40, 5, -95, -109, -114, 7, 4, -17, 127, -18, 13, 5, -23, -15, 2, 11, 12, 5, -23, -26, 22, -15,
+    -12, 15, -23, 14, 9, -6, -12, 0, 73, -67, -57, -16, 50, -36, -38, 88, 8, 49, 23, -2, -15, 20, 58, -96, -67, -80, 70, -54, -14, 3, 100, -127,
+    -81, 95, -11, -34, 114, -101, -124, 104, 82, 10, -60, 71, -88, -19, -84, -24, -127, -10, -12, 124, -31, 8, -90, -56, -33, 58, -42, 13, 54, 42, -127, -54,
+    52, -8, 0, 35, -27, 20, 59, 17, -49, 40, -32, -28, 43, 52, -27, -14, 90, 10, -70, -44, 34, 31, -49, -80, 72, -70, -73, -76, -87, -117, -29, -80,
+    11, -127, -37, 91, -11, 101, -70, 48, -110, 120, 123, 41, -82, 58, 81, 40, 73, -76, 65, -83, 2, -38, -84, -73, 92, -127, -2, -15, -103, -111, -17, -48,
+    -31, -31, 127, 21, 70, -22, -15, 17, -24, -45, 22, -17, -26, -17, 51, -53, 50, 18, 42, 13, 27, 49, -40, -39, 10, -3, 3, -39, 102, 6, 49, -127,
+    -32, 18, 73, -75, 1, -64, 6, 51, -99, -69, -39, -60, 1, -13, 58, -54, -27, 10, 8, 30, 22, -77, 127, 4, -25, 16, 48, 19, -25, -17, 55, 41,
+    -66, -43, 9, -46, -46, -26, 3, -80, 55, 15, 23, -8, 55, 23, 29, 81, -89, -120, -6, -25, 95, -57, 28, 32, -73, -127, -19, -82, -72, -9, -75, 4,
+    21, -5, 61, -57, 49, 82, -10, -127, -31, 76, 32, -4, -71, 49, -79, -18, 90, 4, -27, -71, 77, 34, -73, -65, 8, -8, 3, 1, -2, 5, -15, -1,
+    7, 2, 1, 2, -127, -1, 5, 0, -6, 8, -2, -3, -6, 8, 4, 2, -15, 17, 127, -4, 14, 19, -5, -14, 1, 19, -13, -22, -31, 11, 19, -4,
+    -13, -8, -15, -6, 0, 2, -18, 21, 6, 3, -44, -71, 2, -6, 6, 20, -19, -34, -116, -3, 89, 4, 2, -127, 1, -6, -17, 14, 13, 5, -11, 6,
+    -7, 6, -127, -2, 6, 15, -24, 31, -11, 3, -9, 17, 59, -16, 2, -15, -1, 16, -14, 4, 0, 20, -4, 5, 26, 82, 97, 41, -41, 26, 80, 88,
+    36, -12, -114, -105, 40, -29, 48, 6, -28, -81, 95, -63, 36, -109, 127, -95, 0, 28, 118, 15, -6, 40, -7, -37, 4, 18, 12, -29, -127, -42, 31, -15,
+    38, -11, -40, -47, -15, -22, 41, 22, -33, -59, -107, -112, 36, -127, 49, -42, 45, 7, -118, 48, 93, -112, 95, 55, 10, 30, -112, -84, 101, 90, -70, -4,
+    -32, -65, 52, 24, -94, 4, -101, -87, -18, -119, -4, 16, -67, 17, -96, -91, -29, -127, 54, 55, -103, 62, 14, 66, 32, 42, -127, 30, 26, 38, -20, 20,
+    19, -18, -10, -46, 70, 19, -3, 36, -33, -33, 25, 44, -13, -11, -45, -23, 29, 34, 117, 29, -6, 16, 75, -41, 10, 30, -17, -9, 127, -19, -34, -15,
+    23, 1, 4, 11, -12, 11, -3, -30, 2, 0, 5, 27, -41, 7, -14, 28, -5, 12, -2, -12, 127, 7, -16, -21, 25, -28, 1, 9, -27, -23, -13, 17,
+    -63, 45, 111, 37, -46, 1, -40, -26, 12, -27, 31, 10, 127, 75, 62, -6, -48, -4, 75, 77, -64, 29, -83, -51, -34, -107, 40, 0, -30, 93, -38, -67,
+    -57, -127, 59, 39, -22, 84, -45, -76, -124, -86, -13, -45, -15, -119, -126, 47, -21, 71, 79, -38, -10, 47, -91, 76, -33, -74, -8, 22, 69, 63, -115, -83,
+    -59, -127, -13, -30, 6, -37, -65, 4, -122, -127, 68, -85, -94, -70, 21, -72, 45, 39, -27, 118, 71, -100, -75, -108, 58, -85, -13, -112, 104, 68, 45, 55,
+};
+constexpr int32_t kAeL4Bias[64] = {
+    -26550, -33786, 23850, -23424, -57839, 2064, 1317, 9094,
+    -15610, -43392, -24476, -50711, -87040, 51603, -7019, -47488,
+    -37437, -4999, -19622, -3121, -39109, -16, 1460, -23552,
+    -61824, -1140, -84550, -100397, 13217, -31737, -8346, -48351,
+    -9238, 44439, -27070, -6085, -4707, -104652, 7910, -17668,
+    -44032, 6639, -72745, -36763, 21080, -31222, -15141, -43581,
+    -7204, -13825, 11158, -39137, -6582, 19328, -2071, -45916,
+    -89156, 5374, 43571, 11186, 32220, -98432, -50356, -50944,
+};
+constexpr int32_t kAeL4Multiplier[64] = {
+    1679894533, 1154005612, 2083267847, 1269659595, 1415871722, 1274136405, 1407453568, 1654606937,
+    1542700479, 1196326870, 1520417688, 1770331147, 1339939555, 1709708825, 1446674060, 1363584545,
+    1432444425, 1205522539, 1579099693, 1735627730, 1624415151, 1153829514, 2072462253, 1360493107,
+    1308721474, 1243458725, 1418636566, 1263319244, 1600790880, 1276498258, 1433901693, 1195269226,
+    1331631238, 1109423932, 1188194514, 1770640498, 1292454738, 1339955935, 1732239860, 1544974318,
+    1357651917, 1422283997, 1356794570, 1313213581, 1374619591, 1224669460, 1851774900, 1502288403,
+    1972385870, 1226005099, 1807417892, 1935841275, 1089823780, 1272814877, 1921404197, 1408682109,
+    1676352209, 1655250087, 1215470272, 1128474550, 2064127961, 1311891453, 1410060826, 1263689908,
+};
+constexpr int8_t kAeL4Shift[64] = {
+    -8, -8, -7, -8, -8, -6, -8, -8, -5, -8, -5, -8, -8, -8, -6, -8, -8, -6, -7, -7, -7, -6, -7, -8, -8, -5, -8, -8, -7, -8, -7, -8,
+    -6, -7, -8, -6, -6, -8, -6, -8, -8, -7, -8, -8, -7, -7, -7, -8, -8, -4, -6, -6, -5, -8, -7, -8, -8, -7, -6, -6, -8, -8, -8, -8,
+};
+
+// Layer 5: 64 -> 128
+constexpr int32_t kAeL5ZeroPoint = -126;
+constexpr int8_t kAeL5Weights[8192] = {
+    -15, -35, -47, -10, 46, -15, -34, 43, -61, -23, -26, -26, -22, 16, -2, 34, 49, -26, -44, -83, 64, 87, 110, -41, -34, 0, -8, 35, 29, -14, -22, 36,
+    70, 127, -10, 80, 17, -54, 57, 33, -7, 76, 29, -34, 107, -38, -5, 51, 26, 47, 66, -49, 69, -42, 88, -7, 9, 68, 45, 69, 43, 30, -56, 7,
+    8, -42, 10, -46, -9, 103, -27, 44, 35, -16, 38, 53, -35, 118, -127, -24, -9, 22, -34, 42, -20, 36, 70, 18, 27, 74, -36, 3, -66, -29, 75, -4,
+    46, -33, -20, 25, 53, 18, -5, -45, -17, 51, 42, -34, 82, 59, -34, -39, 11, -42, 54, -87, 12, -43, 51, -38, -16, 65, 22, 8, -35, -14, 13, -7,
+    39, 21, -6, 43, 44, -37, -61, 30, 37, 14, 5, 41, 17, 22, -36, 47, 39, -82, 127, 57, -25, 35, 99, 51, -18, 22, -54, 37, -29, 38, 74, -42,
+    -34, 90, -24, 51, -59, 2, 70, -29, 27, 5, -48, 41, 27, -17, 26, 28, 4, 14, 64, 19, 78, -35, -32, 4, 1, 2, -34, -37, 57, -1, 2, -45,
+    55, -32, -14, 36, 3, -102, 19, 50, 9, -32, -31, -56, 16, 80, 20, 57, -15, -127, -73, -7, 69, 57, 76, 24, -25, -44, 10, 41, -42, 66, 31, 30,
+    3, 12, -43, 10, -27, -28, -11, -6, 34, 11, 36, -13, 7, -13, 104, 37, 26, 39, 85, -15, 45, -27, 1, -5, 17, 39, 48, 20, 19, -27, 10, -28,
+    41, -31, -5, -32, -33, -69, -34, 3, -101, 47, 22, -9, 48, -9, 1, 6, -32, 58, 88, -127, 65, 5, 99, 56, -51, 61, 17, -3, 63, 50, -19, -10,
+    -10, 28, 45, 31, -9, -27, 64, -35, -52, 41, -55, 46, 21, -72, -46, -12, 26, 38, 26, -35, -1, 46, -20, 0, -51, -28, 47, 21, 68, -40, -4, -46,
+    23, -51, 8, -2, 5, -1, -13, 58, -92, -15, 127, -12, -55, 20, -87, -8, -45, 35, 107, 43, -121, 31, 39, 28, 15, -44, 2, 65, 3, -40, -71, -6,
+    -6, -20, -29, 70, -16, 8, -15, -58, -22, -15, 50, 4, 13, 66, 22, -34, -6, 74, 62, -62, 35, 61, -53, -44, 31, 68, 41, 47, -24, -62, 31, 19,
+    -44, 28, 85, -37, 12, 34, 14, -48, -54, -24, 24, -23, -38, 19, -91, 54, 43, -102, 68, 67, 32, 48, -5, 37, -3, -38, 29, -1, 81, -43, -24, -35,
+    33, 76, 57, -1, 23, -42, -14, 54, -24, -32, -8, 32, 30, -127, 90, 40, -57, 49, 28, -74, 2, 11, 15, -8, -7, 21, -40, 89, -21, -35, -18, 40,
+    -5, 21, 12, 31, -7, 64, -7, 1, 73, 18, -65, 19, 0, 37, 58, 28, 1, -29, -127, -33, 29, 4, -9, -30, 19, 9, -4, 1, 7, -14, -15, -24,
+    7, -19, 33, -27, -2, 3, -1, -29, 4, 21, 21, 21, 18, 46, 56, 1, -3, 35, -20, -21, -6, 6, 23, -28, 8, 4, -16, 20, 14, -24, -25, -1,
+    47, 36, 31, -11, 48, 22, -38, 26, 91, 39, -100, 27, 37, 61, 73, 30, -12, 47, -127, -119, 37, 39, 15, 22, -40, 10, 32, 44, 15, 39, 25, -49,
+    14, -10, 26, 71, 29, 22, -2, 12, -16, 3, 27, -31, -6, 19, -2, -45, 32, 12, 51, 106, -22, 19, -2, -20, -26, 19, -56, -43, 4, 1, 28, -29,
+    -16, -1, 18, 17, -33, 69, 40, -22, -97, -14, 17, -24, 3, 23, -7, 26, 22, -68, -107, -127, 57, 49, 3, 7, -19, 8, 20, 20, -2, 29, -16, -32,
+    48, 13, 0, 23, -6, 41, -24, 12, -33, 1, 8, 17, 29, 92, 17, 9, 10, -16, 0, 6, 5, -30, -28, -5, -9, 11, -10, -27, 29, -42, -43, -43,
+    36, -15, 33, -20, -10, -31, 50, 39, 39, 20, -27, 10, 16, -50, -9, -22, 29, 33, 10, -127, 50, 17, 58, 29, 34, -15, 1, 32, 79, 43, -1, -50,
+    -33, 67, -4, 11, -16, 14, 52, 16, -28, 31, -15, -14, -66, -99, 54, 38, -10, 53, 9, -61, 27, -35, -34, 23, 48, -39, -17, 54, 13, 47, -12, 30,
+    22, 26, 20, -21, -14, 39, -43, 20, 88, -17, -82, 38, -41, -10, 85, 22, 41, -127, 19, -112, 37, 3, 19, -9, -14, 25, -26, -11, 66, -1, -2, -47,
+    35, 13, 39, -9, -21, 29, 12, -22, -12, 31, 21, -22, 1, -97, 35, -28, 57, 7, -2, -22, -16, 25, -32, -28, 38, -9, -53, -31, 36, -34, 39, -13,
+    10, 16, 26, 3, -25, -45, 2, 26, 60, -22, -51, 21, -31, -22, 21, 4, 14, -16, -111, -26, 127, 10, -10, 26, -7, 13, -20, 7, -34, -20, -3, -27,
+    10, 18, 28, -17, 6, 30, 0, -27, 19, -10, 14, 2, 17, -41, 13, -16, 40, -1, 36, 21, 36, -8, -13, 18, -16, 28, 13, -12, -26, 14, 17, -29,
+    32, 31, 18, 39, 47, -58, 44, 66, -53, -38, -24, 26, -13, 20, 33, -27, 32, -34, 23, -127, -7, -4, -23, -10, -35, 71, 28, 8, -17, -23, -70, 42,
+    70, 8, -12, 44, 33, 1, 16, -18, -23, -2, -26, 37, 5, 20, -25, 48, 49, -26, 39, 123, 10, -4, 28, 18, 7, 4, -42, 18, 12, -47, -39, 37,
+    12, -10, 40, 47, -8, 69, 3, 24, 90, 40, -127, 40, -44, 45, 124, -44, -15, -107, -103, -32, 60, -9, -41, 33, -22, -25, 29, 27, -35, -38, -4, 47,
+    -36, -27, 8, -2, 19, -41, 1, 50, -6, 25, -44, 16, 57, 45, 80, -50, -65, 61, -24, -98, 12, -49, 21, 22, 34, 31, 4, 36, 1, 13, 27, -22,
+    31, -3, 34, 2, 36, -62, -31, -26, -39, 35, -11, 5, -38, 5, 3, -20, 3, 127, -72, -33, 45, 8, 14, 15, -33, 70, 9, 36, -29, -32, -10, 28,
+    -26, 61, 41, 3, 17, -4, 51, 12, -31, 5, -13, -27, -17, 11, -53, -9, 7, 11, -1, -66, 21, -19, 16, -19, 12, -31, 5, 39, 0, 18, -16, -8,
+    -2, 72, -4, 47, -63, -11, -64, 4, 89, 27, -114, 42, 80, 56, 66, -66, 51, -66, 32, -108, -72, 35, 38, -69, -64, 19, -17, 74, -91, 13, -14, 75,
+    127, 80, 26, 44, -87, 45, 54, -43, 5, -73, -61, -11, 31, 72, -48, 9, 32, 14, 46, 95, -13, 25, -63, 38, -3, 34, 35, -4, 4, 72, 53, -19,
+    -16, 38, -27, -25, 36, -27, 38, -37, -17, -15, -41, -26, -14, -42, 7, -28, 18, -43, -60, 127, -71, -32, 43, 3, -25, 11, -36, -9, 69, 12, 74, -51,
+    10, 14, -10, 50, 25, 22, 36, -15, -14, -57, -19, 14, 20, -2, -44, -50, -39, 53, 64, 81, -27, -1, 2, 32, -50, 45, 18, 29, 31, -12, 50, -4,
+    -38, -29, -14, 25, -18, -63, -23, 60, 34, 22, -127, 2, -14, 30, 111, 26, 33, -51, -77, 1, -3, 59, -13, 28, 37, -32, 22, 17, 14, -4, 20, -6,
+    -8, 79, 45, -42, -38, 11, 42, -14, -34, 19, -27, 17, 30, 32, 62, 2, -16, -55, 13, 124, 9, 28, 79, -19, -29, -39, -26, 24, 10, 15, -32, -1,
+    -12, -40, 34, 22, 17, 36, -40, -18, -114, 26, 53, 31, -15, 42, -112, -9, -3, -52, -17, -68, 0, -13, 6, 46, 53, 37, -15, -35, -76, -38, 76, 24,
+    32, 27, -12, -22, 127, -25, -5, 54, -16, 33, -10, 44, 55, -68, -82, 18, -44, -84, 23, 18, 14, 39, 41, 32, -16, 57, -11, -9, 27, 33, 22, 47,
+    -29, -33, 66, -19, -13, 5, 0, -2, -127, 34, 4, -13, -23, 52, 13, 32, -2, -30, -13, -65, 26, 7, 28, -15, 21, 4, 23, 18, -66, -24, -45, 1,
+    49, -27, 30, -17, -26, 31, 20, -19, -14, 23, 13, 10, -10, 20, 16, -3, -6, 9, 24, 45, 50, 19, 38, -29, 16, -26, -29, 36, 22, 12, 21, 14,
+    30, 10, -2, 47, -15, -1, -1, 15, 59, 43, 7, -29, 3, -3, -22, -20, -14, 49, -96, 1, 56, 16, 20, -12, 10, 65, 27, 33, -48, -16, 5, -31,
+    -6, -25, -34, 34, 35, 42, 32, 34, 23, -31, -33, 32, 32, -18, -60, -22, 49, 7, -6, 127, 11, 37, 5, -12, 37, -24, 7, -43, 2, 41, -18, -43,
+    -29, 33, -35, -10, 29, -4, -18, -28, -35, -9, 22, -24, -6, 14, -34, -22, 10, -119, -127, 34, 90, 11, -13, -16, 10, -7, -20, -13, -21, -3, -36, -16,
+    0, -5, -29, -16, 7, -22, -2, 37, -19, -22, -16, 3, 28, -9, 48, -35, 57, 10, 21, 21, 23, 23, -20, -22, -12, 30, 17, 34, -23, -13, 17, -4,
+    -13, 48, -90, 28, -32, -19, -21, 40, 1, 37, 5, -37, -10, 14, 29, 3, 1, 76, 127, 23, -6, -22, -49, 25, 39, -27, -44, -11, 21, -2, 31, 9,
+    0, 59, 27, 38, 10, -12, -68, -30, -3, 19, 33, -32, 1, 3, 19, 36, -7, 29, 10, -34, -4, 1, -61, -10, -41, 53, 14, -22, 18, -7, 1, 36,
+    1, -7, -22, -14, -24, 50, 0, 39, -61, 28, 90, -28, -10, 12, -44, 8, -9, -58, -73, 127, 56, 6, -14, 29, 6, -14, -14, -22, 29, -12, 46, -3,
+    -36, 34, 6, 5, -1, -13, -35, 13, 17, 19, 15, 18, 10, -24, 51, -33, 7, 14, 11, 33, -29, 6, 5, -1, -15, -5, 13, -21, -24, 19, -31, -25,
+    -14, -42, 1, 33, -39, -42, -54, 0, 76, -47, -63, 2, 12, 1, -6, 48, -34, 92, -51, 127, -90, 44, -15, -28, 5, 30, -14, 36, -42, 58, -18, -52,
+    45, 46, -47, 76, 27, 1, -43, 30, -33, -4, -18, 59, 2, 56, -108, 31, -28, 17, 30, -108, 43, 42, -12, 1, 43, 51, 107, -28, 25, 1, -12, -24,
+    -16, 37, 6, -33, 23, 31, -11, -23, -18, 22, -97, -55, -44, 70, 54, -28, -53, -53, 22, -51, -119, 12, 79, -31, 45, 33, -24, 30, -23, -34, 15, 8,
+    70, 6, 47, 21, -12, 44, -2, -24, -53, -58, -44, -27, 17, 94, -105, 3, -33, -27, -7, 127, -33, -21, 7, 15, -17, 28, -24, 61, 5, 9, -17, -5,
+    -29, -12, -9, 14, 21, 72, 32, 9, 67, 35, 15, 3, 12, -6, -4, -6, 20, -27, 127, 11, -53, 21, -7, 33, -18, -10, 29, -3, 38, 6, 33, 15,
+    0, -23, -2, 24, -33, 20, 41, 22, 17, 8, -29, 35, -4, -83, 59, 33, -36, 38, 24, -24, -12, -23, 37, -10, 22, 50, 8, -12, -36, -5, 25, 23,
+    16, -76, 59, -55, -53, 115, -72, 6, -49, -23, 5, 42, -33, 31, -39, -39, -22, -56, -11, -29, -127, 115, 39, -1, 36, -10, -32, 63, 46, 48, -53, 34,
+    30, -59, -57, 40, 70, -63, 97, -29, 54, -41, -74, 57, 74, 114, 21, -64, 22, 0, 60, -123, 21, 33, -20, -19, 59, -39, -48, -6, 51, -29, 49, 63,
+    -25, -11, 37, 0, 25, 30, 32, 29, 8, 38, 2, 9, 31, 24, 23, -47, -30, 109, 127, 104, -33, -25, 48, -12, -32, 89, -40, -2, -22, 15, 63, 5,
+    -22, -2, 17, 30, 49, 15, -30, 22, 0, 23, -30, -13, -7, -19, -92, 45, 28, 72, 19, 31, -59, 50, -43, 23, 15, -3, 11, -42, -43, 5, 7, -39,
+    -43, -46, 36, 25, 39, 67, 24, -21, -36, 7, -27, -5, -38, 71, 62, 24, -34, -57, 53, -45, -46, 0, 14, -28, -41, 9, -45, -4, 44, -12, -47, 30,
+    18, -41, 21, -24, -5, 42, 9, -8, -20, 55, 16, 41, -23, 37, 43, -38, -1, 16, 7, -127, -44, -20, 56, -36, -30, 22, -18, 33, 14, 24, 13, -5,
+    24, -15, 27, 22, -42, -30, 18, 18, -76, 18, 31, -34, 9, 21, -12, -51, 52, -76, 98, -14, -75, 17, -25, -53, -1, -7, -35, -47, -127, 27, 62, -26,
+    7, 24, -46, -2, 25, 25, 42, 24, 50, 43, -40, -48, 46, 15, -5, 52, -1, -56, -18, -66, 5, 28, 7, 32, -38, 84, 69, 4, 10, -31, 1, 43,
+    -1, -9, -26, -4, -4, 20, 12, 7, 30, 23, -10, -1, 1, 31, 14, 18, 9, -67, 127, 76, -84, -7, 18, 4, -2, 29, -25, 21, 0, -15, 40, -12,
+    -14, 7, 28, 29, 16, 6, 3, -18, -6, -11, -20, -8, -31, -70, -1, 2, -5, -11, 17, 52, 3, 8, 13, -17, 14, -3, -34, -19, -2, -5, 20, 26,
+    60, -2, 0, 14, -53, -11, 40, 22, -55, 18, 6, -18, 50, 7, 41, -26, 48, 127, 19, -26, 63, 51, 21, 30, -46, 34, 49, -44, 31, -10, -27, 7,
+    -16, 23, -53, 53, 1, -54, 21, -39, -37, 31, -56, 60, 31, -3, -70, 65, -10, -5, 9, -46, -16, -29, -28, 52, -42, 8, 9, 31, 14, -52, 19, 44,
+    42, -31, 66, 1, 30, 127, -39, -44, -41, -31, 63, 5, 1, 14, -116, 17, -40, 28, 120, 35, -22, 35, -3, 16, 3, 56, -36, -40, 4, 16, -76, -19,
+    32, -53, -20, 34, 61, 31, 38, 41, -9, -9, 5, -9, -21, -84, -37, 4, 37, 1, -3, -52, -12, 26, -14, -34, -17, 21, 33, 16, 18, 41, 29, -5,
+    2, -56, -104, -7, -20, -13, -56, 57, 31, -38, -95, 9, 23, 81, 120, -56, -35, -115, 63, -15, -16, 24, -36, -54, -53, -13, -11, 6, 16, 23, 15, 15,
+    -3, 14, -28, 25, 24, -60, -7, -28, -14, 44, 24, -1, 2, -45, 106, 43, -1, -56, 52, 127, 60, -13, 7, -18, -23, -21, -121, -15, 3, -54, -12, 36,
+    26, -34, -26, 12, 12, 7, -17, 0, -48, 6, -8, 38, 35, -31, -29, -27, -46, -34, 112, -127, 28, -53, 59, -3, -1, 23, -18, 4, 22, -23, 45, 35,
+    -28, 3, -16, 2, 37, -33, -11, 34, -7, -26, 4, 8, 12, -118, 2, -41, 6, 41, 27, -82, 9, 12, 22, -40, 27, 3, 42, 40, 18, 21, 23, -3,
+    -19, 5, 35, -7, 2, 39, 22, 38, 19, -36, -18, 27, 38, -23, 18, 36, -27, 2, -127, 30, 37, -5, 18, 6, 25, 22, 1, 0, 55, -32, 21, -29,
+    2, 2, 28, 8, 4, -16, 22, 32, -16, 14, -32, 9, 19, 25, -53, 0, 59, -59, 10, -54, -57, 36, 8, 2, 2, 6, 31, -44, -28, -12, 12, 8,
+    48, 22, -25, -35, 0, -70, -2, -6, -15, -41, -2, -23, -10, -3, -57, -28, 1, -60, 11, -52, -35, 61, 13, -20, 34, 5, 20, 25, -2, 5, -10, -44,
+    44, 60, -9, -31, 10, -43, 27, 17, 42, 3, -32, -26, 7, 3, -18, 28, 15, -108, 12, 127, 44, -36, 67, 1, 18, 9, -4, -1, 9, 38, 36, 35,
+    -14, 17, -8, -10, 15, -12, 13, 12, -7, 16, 20, -14, -18, -17, 7, -9, 23, -16, 63, 3, -3, -6, -7, 17, 19, -9, 15, -2, 10, -8, 10, -14,
+    -29, 16, -2, 3, 1, -19, 16, -7, 20, 7, 15, -8, 12, -36, 41, 19, 4, 41, 17, -127, 27, -16, -18, -16, -21, 10, 23, 6, 24, 15, 6, -5,
+    -37, 52, -23, 46, -19, -1, 4, 62, 127, -56, 54, -25, -20, -31, -68, 1, 51, 64, 34, 31, 97, 27, -41, 23, -20, 30, -14, -29, 59, 38, -4, 0,
+    -7, 39, -6, 0, 25, 13, 17, -7, -24, 78, 2, -39, -3, -104, 4, -32, 23, -14, 27, -122, -39, 37, -16, 13, -37, -16, 45, 3, 5, -52, 0, -38,
+    -22, 25, -15, -17, 19, 9, 24, -30, 22, -6, 14, -22, -26, 12, -38, -23, -4, 37, -15, 84, 90, 7, 42, 26, 35, 16, 33, 34, -22, -6, 28, -1,
+    -31, 18, 23, 25, 46, 12, -10, -32, -8, -1, -9, 33, 23, -127, -15, -20, -22, 39, -30, 31, 11, -8, -17, 7, 31, -26, -26, 5, -23, 15, 24, 22,
+    -9, -16, 4, -25, 5, -16, -1, 31, -57, -27, 69, 17, -26, -10, -50, -20, -5, -61, -40, -67, 127, -40, 1, -10, -16, -33, -22, -6, -28, -7, 16, 21,
+    3, 3, -17, 29, 2, 16, 6, 28, -7, 20, -24, -18, -13, -109, 54, 8, 43, 24, 9, 54, 16, 23, -21, 4, 8, 27, 7, -7, 25, -17, -11, 4,
+    54, -20, -92, -43, 56, -47, 28, -48, 24, 10, 15, 20, -9, -4, -41, -4, -20, -42, 47, -83, -49, -1, -39, 32, -39, 3, -55, -55, -2, 11, 12, 50,
+    18, 49, 39, 14, 33, 49, 52, -34, 2, 41, 1, 2, -9, -35, 40, -16, -89, -6, 74, -127, 52, -36, -33, 55, -25, 49, 17, 19, 49, -28, 36, 39,
+    -5, -18, 6, -17, -6, -23, 19, -9, 0, 8, -24, 5, 11, 27, -3, -8, -7, 9, 62, 27, 32, 8, 12, 8, -17, -1, -14, 17, -26, -12, 22, 7,
+    5, 22, 7, -4, 29, 23, 23, -1, 23, 24, -3, 17, -13, -127, 10, 15, 11, -15, 5, 8, 17, 22, -6, 11, 7, -9, 23, -8, -6, 24, 2, 8,
+    9, 27, 13, -29, -36, -56, 20, 0, 96, 13, -46, 18, 35, 5, 11, 14, -15, 14, -23, -51, 120, -25, -3, 2, -27, 9, -19, 39, -26, 29, -12, -19,
+    5, 20, -30, -13, 42, -17, 44, 0, 0, -11, 28, -6, 0, -127, -15, 22, -11, 58, 6, -83, 9, -3, 32, 26, 41, 35, 19, 18, 53, -22, -5, -30,
+    -5, 7, -2, 13, -46, -82, 25, 33, -39, -42, 27, 4, -2, -3, 8, 37, 31, 39, 73, -8, 127, 39, 39, 44, -21, -9, 33, 15, -45, 54, 17, -58,
+    33, 67, 63, 57, -57, -45, 96, 49, -10, 4, 35, 20, -18, -122, -24, -7, 43, -81, -9, 5, -9, 21, 20, 38, 3, 60, 60, -10, 16, -23, -4, -19,
+    -85, -35, 12, -73, -72, 83, 11, 26, 3, -59, -82, -65, 77, 17, 91, -1, -79, 13, 71, -95, -86, 27, -41, -68, 72, -32, 66, 67, 5, 32, -28, 0,
+    16, 52, 48, 11, -85, -52, -7, 21, -39, 3, -9, 15, 44, 67, 116, -1, -16, 105, 42, -127, 79, 43, 51, -43, 31, 58, -15, 54, 6, 74, -84, -23,
+    -33, -4, -45, -32, 14, 62, -24, -25, -53, 31, -4, -39, -33, 35, -17, 15, 8, 90, -8, 48, -61, 15, 68, 21, 3, 16, 25, 17, 73, 45, -1, 28,
+    66, 22, 16, 12, -31, 19, 44, 32, -1, -44, -5, 27, -36, 17, -63, -30, -13, -53, -7, 127, -29, 20, 39, 37, -35, 12, -21, 4, -14, 18, 20, 26,
+    -19, -35, 26, 19, -5, 77, 0, 34, 48, 10, 79, -37, 25, -13, -123, -16, -6, 109, 127, -14, -106, 42, 9, 10, 16, 79, -17, -13, 43, 36, 12, 49,
+    -2, 40, 53, 7, 13, 44, -11, -30, 13, -9, -18, -32, -22, 17, -64, 31, 13, 43, 10, -44, -85, 28, -19, -31, -32, -30, 53, 31, 0, -17, -39, 3,
+    -36, -17, -48, 2, -18, 5, -46, 24, 40, -1, 0, -23, 37, 79, 5, -28, -7, -20, 41, -118, 42, 57, 5, 20, 10, -7, 25, -4, -127, -39, 76, -19,
+    -4, -27, -17, -25, -10, -7, 13, -19, -29, 13, 4, -9, -28, 8, 53, -11, -33, 6, 23, 37, 17, 13, -13, -44, 15, 21, -18, 42, 47, 5, 17, -13,
+    43, 45, -22, -25, 6, -23, 30, 3, 30, 26, -10, -31, 22, 1, -7, -37, 1, -127, -27, 92, 26, 41, 37, -41, 21, 9, 24, -23, 17, 21, -20, 2,
+    -19, 10, -35, -24, -20, 43, 51, -16, 27, 22, 41, 20, 4, -48, 40, 9, 6, 3, 31, -61, 38, 1, -18, -13, 23, -40, 33, 41, -43, 31, 30, 20,
+    -5, -12, -18, 27, 15, 23, 11, -36, -10, -41, -25, 10, 5, 12, 46, 37, -6, -77, 127, -4, -127, 8, 34, -43, -18, -30, -14, -30, 99, -4, -75, -37,
+    38, 33, 32, -6, -81, 31, 1, -40, -13, 30, -12, -7, 5, 75, 58, 14, 91, 0, 51, 75, 13, -26, 2, -38, -7, -40, 10, -31, 42, -8, -14, 17,
+    18, 13, -36, 3, -5, 35, -8, 44, 19, -21, -47, -29, 37, 64, 54, -14, -29, -68, 65, -41, 78, 13, 5, 22, -1, 6, -11, 6, -86, 33, 62, -15,
+    -17, -40, -20, 17, 0, 17, -2, 23, -7, 0, 7, 20, -19, -127, 50, 34, -26, -13, 13, 66, 2, -7, 15, 24, 20, 21, 1, 42, -14, 5, -17, 31,
+    -37, -8, -36, -34, -14, 24, -32, -1, -37, -3, 5, 34, -19, -27, -22, 36, 35, -127, -9, -44, 71, 25, -5, 37, -12, 0, -32, 34, 113, -31, -39, -28,
+    -4, 55, -20, -67, -1, 14, 17, 39, -31, -17, -36, 30, -2, -82, 72, 19, 11, 32, -4, -55, -6, -1, 4, -8, 11, 15, 6, 40, -7, -5, -23, 10,
+    20, -24, 9, 17, -17, 5, 3, -32, -68, -33, 1, 6, -35, -18, -1, 10, 19, 103, 127, 28, -69, -6, -2, -6, 24, 39, 23, -29, 32, 2, -6, -1,
+    18, 39, -18, -13, 15, -26, -21, -22, -27, 19, 9, -10, 32, 21, -82, 21, 0, 5, 4, -9, -9, 16, -7, -16, 24, 36, 8, 4, -3, -7, 27, 2,
+    -14, -29, -1, -10, 27, 15, -4, -14, 29, -25, 46, -27, 4, -13, -61, 26, -25, -12, 127, -37, -84, -13, -10, -16, 28, 22, 25, 5, 12, 19, 14, 10,
+    9, 22, -16, 20, 15, 24, 36, 6, -21, -1, 0, -12, -33, -42, 5, 1, -2, 9, 22, 2, 3, -18, -12, 15, -17, 23, -16, -8, 13, -29, -23, 5,
+    27, 1, -6, -36, 33, 11, 39, -14, 123, -44, 65, -13, 6, 14, -127, -21, 51, 126, -103, -49, 73, 8, -19, -27, 54, 63, -23, 47, 29, 35, -14, -9,
+    30, 9, 60, 41, 83, 26, -2, 16, 11, -1, -36, -50, -11, -126, -70, 2, -26, 43, -17, 123, -54, -16, 64, -13, 35, 14, 32, -19, -14, -51, 34, 17,
+    18, -28, -6, 1, 16, -16, 28, 11, 127, 35, -20, -7, 26, -29, -7, 3, 34, -40, -2, -64, -13, -4, 31, 0, 5, 18, -34, 29, -51, 40, -3, -15,
+    0, 19, 25, 42, -35, -14, -39, 33, 13, -3, 30, 19, -3, 9, -26, 18, 9, 38, -25, -84, -10, 19, -19, 27, 0, 18, 20, 39, 14, -16, -24, 5,
+    5, 6, -18, -19, 26, -4, 11, -16, -22, 2, -5, -17, -21, -21, 4, 8, -11, -25, -127, -33, 29, -18, 16, -14, -11, -15, 16, 4, 25, 17, -4, -25,
+    48, 25, 8, 11, -32, -14, -11, 10, -13, 9, -12, -6, 23, 61, 19, 12, 7, 42, -9, 46, 9, -21, -2, -17, -2, 18, 12, 6, 3, 2, -17, -17,
+    -22, -14, 24, -44, -26, -7, -15, -20, 18, -55, -111, 29, 49, 71, 127, 10, 50, -6, 8, -69, 45, 14, -17, -14, 14, -26, 0, 42, -73, 43, 20, -6,
+    -31, -9, -10, 61, 22, 30, 8, 49, 54, -18, 35, -27, -16, 18, 43, -48, -45, 33, 20, -5, 6, 26, 27, -38, 39, 78, -61, 38, 55, 53, 18, -23,
+    22, -16, -58, -48, -40, -30, 16, 4, -66, 11, 27, -12, 11, 60, 51, 5, 47, -127, -28, -18, 103, -26, 62, 7, -42, -34, 14, 18, -57, 2, 5, 29,
+    19, 12, -7, 25, -111, 19, 21, 28, -25, -13, -25, -5, 11, -52, 56, 8, 27, 32, 33, 79, 21, -44, -5, -7, -14, -8, -33, 53, -19, -46, -6, -13,
+    -19, 13, 0, 18, 7, 21, -10, -7, 17, 16, 13, 8, -25, 44, -15, -13, 25, 87, -84, 9, 127, -8, 34, -19, 15, -9, -13, -5, -57, 27, 9, 10,
+    3, -26, -25, 0, 10, 14, 2, 2, 4, -6, -8, 22, 42, -59, -35, 23, 17, -17, -5, -22, 6, 2, 37, 2, -1, 25, -3, 19, -14, 22, -21, -18,
+    5, 16, -53, 25, -2, -87, -12, 21, -1, 14, -38, -12, 10, -28, 52, -8, 35, -82, -127, -98, 3, -5, 0, 17, 30, -18, 0, -14, 28, 47, -26, -3,
+    -11, 0, -2, 24, 13, -14, -17, -16, 13, 51, -24, 18, -6, 102, 46, -38, 38, 6, -9, 94, 26, -9, 10, 13, -38, 59, 10, 19, 15, 40, -36, -42,
+    9, 19, -52, 39, -7, -17, 25, -15, 64, -8, -31, -15, 10, -13, -1, -2, -53, 114, 2, 105, 127, -22, 18, 41, -52, 58, -20, -40, -12, -13, 10, 48,
+    8, 62, 57, -19, -23, 17, -49, 6, 40, 47, 44, 3, -32, -23, -65, 14, -22, 14, -16, -7, 12, 36, -14, -7, -16, 31, 68, 41, -56, -40, 40, -21,
+    27, -68, -40, -38, 24, -62, 55, 31, 109, -4, -23, 0, 20, 1, -13, -6, 44, 32, 52, 26, -113, 21, -3, -36, 53, -28, 46, -22, 120, -18, 45, -48,
+    -83, 81, 37, -36, 127, 65, 25, -28, 26, 9, 23, 49, 72, -86, 14, -52, -2, 79, 53, -108, -82, -28, -61, -21, -53, -29, -46, 16, -28, -63, 36, 37,
+    27, 18, 1, 9, 2, -35, -10, -24, -14, -11, -4, 28, 17, 0, 5, 23, -16, -44, -85, 55, 127, 5, 10, 17, 28, -32, 18, -1, 16, 7, -5, -4,
+    -7, 18, 32, 6, 10, 1, 30, -19, 6, 6, 23, -8, 5, -95, 47, -25, -22, 31, -5, 5, 25, -15, -4, 11, 9, 35, -46, 33, -23, -16, -29, 0,
+    -41, -36, 14, 13, -34, -46, -6, 24, -22, 2, 5, -13, -4, 7, -65, -38, -43, 116, -127, 21, 56, 44, 20, -15, 30, 34, -38, -7, 33, -22, -45, -12,
+    16, 43, -26, 22, 71, 22, -39, 41, 1, -35, -27, 4, -38, 10, -90, 31, -18, 53, -12, 45, -15, 7, -20, -34, 44, -29, 43, 16, -5, -31, -9, -13,
+    23, 56, -7, -55, 54, -17, -10, 33, 19, 5, -127, 37, -30, 70, 64, -31, 16, 43, 55, 42, -45, 6, -2, 48, 9, 23, -3, -18, -58, 31, 53, 48,
+    43, 52, -27, 1, 93, 27, -12, -47, -26, -43, -50, -25, 32, -27, -122, 35, -124, 21, 28, -89, -5, -49, 9, -14, 41, 1, 67, -21, 42, 57, -49, 41,
+    -5, -1, -21, -8, 27, -3, -20, 29, -63, 2, 38, -1, -22, 34, -13, 10, 25, -127, -38, -6, 86, 35, -12, 18, 14, -30, 18, -4, -2, 7, -25, 3,
+    14, -10, 7, 5, -21, 6, -1, 24, 20, 24, -14, -19, -10, -31, 86, -20, 6, 2, 38, -14, 21, 16, 4, 15, 4, -8, 17, 35, -11, -9, 3, -22,
+    -18, -67, -65, -3, 66, -116, -35, 36, 66, -57, 15, -54, -38, -27, -21, -3, -32, -6, -51, 0, 127, 52, 2, 7, -61, 60, 13, -31, -100, 34, 26, -9,
+    -113, 69, -60, -49, 118, 62, 57, -39, 48, -42, -47, -4, 32, -81, -64, 0, -46, 83, -60, -89, 3, -3, -75, 36, -16, 77, 21, 53, 94, 35, -44, -62,
+    15, 64, 0, 28, 25, 81, -13, -13, -38, 56, 16, 7, 19, 31, -52, -34, 57, 72, -79, -100, 94, 25, 6, 44, -19, 17, 33, 66, 8, -35, -35, -19,
+    75, 44, 41, -21, -41, -22, 0, 25, 41, 13, 63, 62, 94, 77, -89, 34, 127, -86, 15, 20, -41, 40, -17, -5, -25, -2, 55, 18, 38, 10, 33, 28,
+    -40, -15, -65, -29, -4, 54, -26, -12, 41, -36, 73, -37, -39, 12, -34, 10, -21, 127, 19, 87, -91, 23, 12, -19, -7, -5, 37, -20, 26, 26, 59, -27,
+    -25, 16, 32, 50, -34, -25, -21, 13, 29, 15, 39, 7, 19, 116, -22, -3, -20, 33, -12, -60, -67, -43, 3, 25, -27, 34, 53, 21, 4, -43, -24, 28,
+    5, -57, -35, -25, -18, 23, 17, 64, 32, -30, -11, 17, 77, 21, 99, 32, -54, 41, 112, -100, -105, 50, -27, 35, 34, 13, 55, -48, 12, 47, 17, -46,
+    -12, 46, 9, 55, -39, 46, 56, 17, 28, 14, -32, -40, 40, 50, -44, -21, 68, -39, -42, 44, -127, -36, 12, -38, -27, 68, -46, -18, 102, -67, -15, 49,
+    19, 8, 48, -22, -28, -37, 25, -33, -57, -27, -73, 19, 22, 60, 36, 24, 30, -84, -127, 26, 125, 9, 7, 10, -10, -44, 31, 3, -64, 23, 30, -7,
+    19, -15, 17, 20, 48, -15, -1, 12, -4, 20, 18, -3, 0, -8, 58, -29, -15, 3, 3, 56, 19, -21, 7, 5, -13, -7, -10, 20, 0, 0, 27, -21,
+    -4, 29, -28, -16, -12, 25, 16, 35, 31, -42, -73, 28, -11, -15, 82, -34, 28, -36, 7, 32, -127, 33, -29, 35, 45, 1, -19, 36, 45, -40, 25, 48,
+    -34, 46, 18, 25, -29, 44, 7, -33, 30, -6, -44, 3, 43, 53, 11, 34, -69, -6, -6, -125, -11, 30, 25, 7, 36, -5, 29, 36, 5, 43, -14, -30,
+    -6, 32, 1, -15, 0, -36, -33, 32, 122, 31, -30, 18, -37, 7, 21, -12, -26, -109, -31, -46, -114, 41, 35, 19, -12, -21, -36, 7, -21, 6, -49, 31,
+    2, 2, 42, -32, -23, -26, 4, 38, 14, 3, -32, 36, -4, 127, 37, -34, 68, 44, -12, -58, -33, -25, 14, -27, 6, 44, 31, 9, 28, -13, -20, -7,
+    64, 6, -56, -31, -7, 22, -21, 12, 43, 27, 98, -1, 45, -74, -70, 45, 28, 21, 32, -9, 65, -10, 48, -8, 44, 32, 39, 33, -59, 13, 98, -47,
+    -28, 60, -44, 46, -52, 60, -34, -29, -24, -66, -18, -41, 56, -127, -75, 48, 28, -11, 29, 68, 52, -11, 10, 66, 4, 91, -39, -57, 36, 39, -51, -39,
+    -50, -58, -52, -1, 10, 84, 42, 0, 14, 33, 47, -50, -49, -5, -44, -31, 23, 16, 107, -127, -28, -9, 22, -53, 9, 40, -44, 34, 45, 26, -42, 29,
+    65, -17, 7, -2, -34, -61, -23, 38, 45, 80, 31, 61, 71, 11, -23, -43, 28, -68, 38, 9, -44, 18, 30, 16, 16, -25, 30, 25, -1, 41, 29, 20,
+    -12, -48, -57, 53, -5, -39, -29, 41, -89, -8, -17, -34, -54, 40, 88, -27, 35, -17, -41, -73, -52, -14, -3, 21, 43, -18, -68, 13, -2, -31, 73, 36,
+    60, 29, -29, 20, 11, -70, 40, 25, -27, 127, -5, -36, 88, 91, 30, 64, 28, -32, 23, 42, 13, -57, -11, 50, -10, -5, 16, -45, 0, 50, 48, 44,
+    -31, 11, 19, 13, -12, 114, 33, 18, -57, 1, -27, 1, 30, -1, 54, 22, 13, -23, -127, 81, 23, 41, -16, 0, -20, 32, -13, 4, 0, 2, 19, 16,
+    42, -14, -12, 66, -101, -25, 5, -8, 19, -16, -28, 9, -35, 97, 26, 10, -34, -8, -11, -37, 33, 5, 2, 32, -12, 28, 41, 1, -11, -23, 4, -38,
+    44, 3, -32, 42, 33, 62, 41, 60, 48, -7, -33, 8, 14, 46, 37, 11, 0, 23, 48, -42, 9, -20, -10, -43, 20, 2, 2, 35, 5, -16, 75, 13,
+    17, -29, 1, 24, 24, 17, 10, -6, 32, 0, -25, -41, -29, -127, 21, 17, -38, 11, 37, 43, -12, -42, 50, 36, -39, 54, -13, -23, 13, -4, -4, -16,
+    8, -40, 18, 20, 17, 35, -16, 45, 10, 12, 6, -14, 13, -13, 29, 28, 4, -127, -43, -24, 85, 40, -10, -37, -6, 17, -25, -26, -23, -7, -31, 8,
+    -17, -28, 7, 36, -32, -21, 2, -35, -35, 18, -19, 9, -1, -59, 45, 27, 3, 22, 30, -10, 41, -5, -9, -10, 11, -9, -3, 7, 29, -41, 28, 35,
+    -19, 25, 41, -14, -20, -19, -13, -24, -25, -7, 37, -4, -2, 50, -80, 0, 24, 3, 127, -74, -18, 39, -2, -22, -16, -15, 13, -19, 22, -16, -112, -10,
+    108, 9, 37, 5, 18, -28, 12, 29, 41, 13, -34, -13, -37, -6, 9, -10, -21, 61, 30, -60, 23, 45, 7, -36, 34, 20, 10, 49, 4, -33, 43, 35,
+    -30, 15, 18, 3, 0, -37, -45, 48, 2, -2, -124, -21, 11, -37, 127, -40, -11, -49, 56, -48, -69, -22, -12, 15, -37, 54, 1, 17, -31, 10, -7, 13,
+    21, -1, 0, 4, 2, -14, 35, 19, -12, 35, -22, -7, 0, 68, -30, 7, -16, 21, 25, -42, 48, -11, -38, -20, -19, 30, 6, -17, 10, 25, 19, -37,
+    8, 34, 8, -21, 27, -13, 34, 35, -127, -5, 70, 29, 26, 6, -24, 16, -15, -106, 15, -43, -13, -16, -30, -11, 14, -26, 36, 8, -45, -15, 21, -29,
+    -31, 9, -30, -28, -2, 27, 20, 6, -30, 4, 12, 0, 36, -7, 81, -23, 25, 5, 52, -63, 23, 34, 24, 38, 35, -7, 23, 20, 22, -35, 14, -39,
+    -38, 25, -82, 6, 36, -116, -9, 27, -12, 11, -15, 2, 30, -22, 8, 18, -12, -23, 42, -57, 109, 42, -2, 19, -26, -13, 21, 17, 0, 49, -58, 23,
+    -18, 39, -38, -40, 36, 23, -23, -35, -35, 21, -2, 31, 2, -127, 35, 20, -7, 64, -8, -19, 44, -38, -24, -19, -23, 28, 34, 56, 18, 12, 6, 13,
+    12, 40, 10, -45, 24, 4, 27, 10, 91, 1, -80, 6, 4, 52, 49, 27, -36, 89, 112, 24, -127, 50, -35, 0, 36, 8, 9, 0, -72, 10, 52, 23,
+    10, 5, -30, 4, 47, 36, 18, 44, -2, 64, 18, -45, 5, 71, -2, 30, -23, -19, -4, 21, 25, 6, -23, -6, -38, -12, -7, -41, 38, 26, -40, -40,
+    -49, 42, 28, -39, 53, -43, 42, -5, 127, 28, -18, -3, -50, -43, -29, -6, -53, -27, -48, -118, -25, -1, 12, 30, 4, -11, -51, -54, 120, -37, -80, -37,
+    18, -7, 22, 5, 79, -26, 12, 44, -1, 43, -6, -51, -16, -62, 20, 24, 67, 30, 79, -85, -2, 11, 27, -50, 46, 68, -19, -17, 54, -9, 3, 40,
+    7, -23, 20, 23, 27, 78, -26, 35, -14, -17, 32, -27, 11, 28, -18, 11, -22, -38, -127, 6, 52, 1, -29, 9, 9, 4, -4, -14, -17, 32, 37, -1,
+    20, -20, 33, 17, 10, 1, 7, 9, 21, -5, 13, 14, 35, -6, 34, -8, 24, -15, 13, 6, -11, -21, 21, 13, 24, 27, -14, -15, -27, -27, 15, -13,
+    13, -4, -43, -11, -29, 60, -14, -1, 29, -18, 22, -33, 18, 24, 14, -22, -28, -60, 127, 40, -102, 14, 12, 34, 6, 16, -24, 35, -38, -2, 8, 26,
+    -26, 0, 24, -25, -35, 26, -5, 23, 27, 10, -13, -21, -7, 49, 29, -16, -17, 13, -23, -13, 29, 19, 21, -9, -9, 31, 1, -2, -2, 16, -8, 22,
+    -21, -37, -75, -30, -24, -16, 12, -19, 95, 24, -18, -15, -2, 51, -12, 34, 7, 127, 89, -11, -48, 31, -14, 12, 37, 28, -14, -20, -18, -24, 33, 12,
+    -24, 10, 37, 11, 61, -25, -3, -33, -24, -32, -26, 4, -19, 5, -33, 29, -37, -3, 38, -20, 9, -36, 11, 2, 10, 38, -30, 0, 14, -24, 32, -26,
+    -10, 25, -18, 29, 32, -75, -12, -11, -53, 4, 41, -16, -36, -23, -31, 4, 50, -4, 12, 45, 0, 25, -11, 42, -29, -33, -24, 47, 13, -8, -72, -10,
+    6, 82, 53, -36, -43, -30, -29, 39, -22, 35, -21, -39, -26, 7, 50, 14, 36, -19, 61, -127, 47, 35, 20, 32, 43, 28, 2, 32, 21, 19, -10, 39,
+    -18, -13, -33, 22, 9, -15, 8, -24, -126, 7, 105, 24, 56, 61, -119, 7, -44, -14, 72, -8, -127, 9, -7, -50, 27, -22, 52, 48, -29, 74, 43, -51,
+    -42, 20, 26, 66, 97, -51, 10, -36, 27, -2, 13, -48, -25, -115, 50, 7, -1, 39, 38, -59, -7, 29, -15, 1, -48, 61, -1, 78, -5, 35, 1, -57,
+    -19, 8, 38, -46, 1, -8, -30, -15, -11, 25, 8, 43, 35, -8, -12, -19, -52, 17, -42, -97, 127, -41, 46, -11, -28, 23, 2, 12, -62, 45, 52, -44,
+    15, 8, -23, 55, -22, 24, 24, -39, 26, 18, -51, 49, -37, -120, -30, -3, 22, -22, 49, -18, 4, -52, -24, -48, -42, 44, -43, 2, -7, -38, 5, 43,
+    35, -35, 54, 34, -23, -25, -12, 40, -44, 4, 32, -14, -5, -4, -29, 8, -15, 23, -45, -48, 23, -8, 26, -40, -36, 6, 24, -26, -127, 23, 15, 27,
+    -19, -32, -11, 57, 47, 22, 4, -27, 12, 2, -35, 34, 43, -16, -39, 9, 14, 24, -23, -18, 34, 34, 41, -19, 12, 27, -1, 33, 36, 1, -14, -9,
+    -48, 50, 58, 30, 56, 69, 13, -7, 95, 31, -88, 0, 15, 3, 11, -17, -48, -55, -3, -127, 11, 69, 22, 22, -8, 30, 44, 51, -35, 30, -25, -3,
+    56, -60, -27, 17, 29, -37, 55, 34, 30, 19, 11, -39, -10, -21, -27, -12, 26, -26, -14, 4, 37, 3, 8, 18, -40, 48, 23, -30, 60, 40, 1, -35,
+    51, 35, 13, 14, 24, 88, 9, -17, -103, -28, 127, -40, 10, 7, -109, 27, 3, 20, -50, 16, 68, 58, -23, 30, 25, 48, 29, -38, 38, -9, -89, -26,
+    11, 17, -4, 44, 25, 25, 0, 3, -33, 39, -13, 23, 33, -59, -19, 39, -17, 9, -32, -73, 9, 41, 15, -39, 35, -15, -30, 23, -41, -31, -32, -10,
+    43, -40, -29, -21, -7, -39, 33, -9, 127, -5, -120, 44, -8, -44, 109, -24, -20, -81, -75, -9, -30, -9, 16, -13, -11, -37, -9, -15, 96, 43, 0, -31,
+    12, 22, 44, 4, -54, 28, 28, -34, 34, -36, 37, 48, -5, 32, 71, -2, -14, 98, 17, -9, 8, 27, -18, 31, -19, 19, 13, -19, 27, -39, -34, -11,
+    33, -15, 16, -9, -9, 9, -18, 23, -116, 12, 14, 48, 21, 20, -39, -7, -27, 110, 42, -69, -98, -20, -27, -2, -43, 21, -26, -39, -52, -36, 78, -7,
+    6, 6, 19, 33, 127, -47, -57, -54, -6, 31, 2, 41, 49, 90, -103, 19, -35, -30, 29, -75, -19, -23, 3, 43, 25, 90, -7, 25, 32, -7, -20, -32,
+    -15, -28, -21, 10, 35, 100, 10, 10, 25, -38, 115, 2, -35, 5, -56, -16, -36, -21, -127, -22, 92, 27, 34, -1, 28, -16, -28, 18, 11, 25, 44, 39,
+    -7, -21, 20, 52, -75, -19, 23, -15, -27, 27, -16, -30, 15, 5, 19, -15, 32, -28, 7, -29, -48, -14, 34, -29, -31, -1, -1, -22, 18, -36, 22, 17,
+    35, -23, -13, 35, 32, 46, 29, 39, 39, -2, -18, 10, 18, 40, 14, -1, -18, 107, 67, -65, -127, 7, 18, 5, -2, 22, -29, -9, -66, 12, 73, -32,
+    8, -6, 39, -4, 14, -33, 14, -30, 8, 19, 16, 1, 22, 77, -54, 22, 7, -41, 3, 28, -20, 21, 10, 9, 29, -14, 13, -26, 23, -28, -18, 3,
+    -28, 27, -7, 32, 14, -51, -20, 22, -20, -27, -12, -25, 6, 18, 13, -31, 29, -42, -127, -57, 4, 44, -27, 33, 8, -32, -6, 11, 7, -9, -46, -11,
+    11, 24, 16, -21, 9, -4, 31, 9, 10, -18, 24, 22, -5, 107, 39, -15, 3, -2, -13, 51, 40, -20, 34, 5, 0, 34, -25, 7, 26, -25, -3, 32,
+    -19, 49, -16, 44, -57, -117, 50, 42, -7, -3, -64, 24, -39, 15, 69, 20, -29, 15, -52, -73, 62, 46, 24, -37, 35, 12, -19, 10, -94, -32, 44, 33,
+    -47, 10, 8, -12, 18, 1, 68, 3, 41, 55, -39, 1, -19, -47, 12, 15, 12, -5, -26, 127, 48, 19, 44, -38, -42, -3, 41, 9, 23, 5, -24, 7,
+    -3, 25, 39, -20, -21, 4, 26, 37, -33, -28, -42, 31, 6, 27, 11, -7, -24, 104, 63, -2, -127, 32, 15, -11, -26, 2, 30, 30, -1, 34, 2, 3,
+    -5, 24, 12, -17, 25, -22, 24, 3, 21, -35, 13, 29, -27, 81, -24, 17, -15, 2, -2, -79, 42, -36, 25, 36, 27, -19, -8, 25, 32, -6, 22, -36,
+    -12, 39, 32, 48, 42, 54, 48, 10, -123, 9, 51, 11, -31, 57, -6, 28, -54, 88, 9, -127, -47, 30, 35, -24, -48, 54, -22, -27, -40, -9, -79, -34,
+    66, -15, -28, -18, -82, -2, -7, -11, 49, 25, 27, -19, -15, 122, -64, 1, 52, -17, 30, 51, -34, 30, 58, 22, -47, -9, 19, 58, 79, -32, 45, -10,
+    12, 13, -46, 5, -2, -59, 24, 9, -47, 0, 5, 8, -13, 39, -11, 11, -25, 41, 83, -66, 13, 12, 33, -4, -15, -12, 13, -4, 57, 12, -60, 13,
+    61, 20, -2, -4, 35, -7, 4, 30, 25, -3, 10, 11, -25, -59, -10, -37, 25, 36, -24, 127, 23, 12, -23, 27, 6, -23, -49, 16, 22, -36, 31, 24,
+    -18, 6, 2, 7, -17, 25, 13, 14, -41, -8, 13, 12, 8, 27, -23, -5, 14, -127, -18, -1, 19, 8, 19, 13, 0, -28, 5, -6, -15, 18, 62, 2,
+    -31, -2, 1, 28, 35, -10, 36, 4, 14, 0, -15, 24, -25, -94, 103, 22, -40, 30, -5, 3, 16, 10, 30, 20, -10, -23, -7, 25, -32, -26, 12, 7,
+    22, 17, 4, 22, -26, 56, -13, -8, 33, -11, 19, 6, 18, 15, 31, 25, 1, -127, 35, 6, -36, -16, -9, -5, -13, 2, 23, -4, -24, -7, 14, 27,
+    -28, -15, -4, -14, -20, -6, 5, -10, -22, 22, -8, -23, 1, 31, 88, -18, 16, 45, -22, -64, 3, 12, 10, -2, -14, 26, -22, -11, 9, 0, -5, -7,
+    52, 19, -54, 8, 15, 42, -6, 14, 93, 28, -46, -55, 17, -33, 8, 7, -43, -17, 80, 47, -55, 43, 25, 36, 25, -32, -34, -19, 127, -51, 7, 52,
+    -22, 22, 53, 3, 8, -57, 32, 17, 16, -52, 13, 33, 6, 59, 71, 26, -11, 39, 27, 88, 46, 45, 55, -32, -10, 25, 4, -45, 24, -39, 55, 19,
+    36, -15, 24, -15, -32, -11, 33, 27, -62, 4, 39, -11, 18, -9, -76, 5, -7, -22, -127, 19, 64, -2, -34, 14, -4, 7, -36, 20, 9, 29, -47, -27,
+    18, -17, 28, 24, 80, 11, 2, 10, -34, -22, -19, 2, 19, -24, 14, -31, 2, 14, -1, 0, 26, -13, 15, 22, -10, -12, -16, 45, -40, 24, 33, -6,
+    -34, 17, 34, -6, -15, -69, 22, 4, -73, 21, -63, -27, -29, 24, 21, -32, 36, -3, 8, 42, 85, 25, 37, -15, 28, 14, 27, 1, -25, 17, -3, -22,
+    60, -22, -36, -1, 64, -23, 3, -14, 23, 22, -37, -7, -14, -78, -29, -16, 22, 5, 21, 127, 18, -29, 5, -31, 23, -23, 25, -7, -39, 22, 25, 3,
+    25, 20, 42, -76, -35, 73, 76, 54, 23, -48, -91, 64, -39, -43, 93, 2, 51, -115, 1, 127, -114, 11, 6, -35, -46, 17, 46, -32, 64, 51, 52, -47,
+    -64, 32, 40, -31, 12, 28, 25, 3, -44, 37, -59, 4, -34, 64, 98, -55, 7, 36, -41, -115, -16, 13, 31, -1, 64, 40, 2, 19, -34, -36, 61, -67,
+    -8, -27, 22, -27, 4, 2, 24, -18, -70, 20, 54, -3, 25, -1, -45, 20, 19, 42, -127, -30, 85, 16, 12, -5, 5, -14, 27, -8, 21, 21, -18, -12,
+    -2, 4, 30, -5, 25, -26, 18, 1, 6, 11, 30, 8, 33, 16, -10, 26, 23, 19, 28, -57, -11, 6, -14, -21, -12, -10, 29, -7, -6, 3, -15, -22,
+    1, -8, -58, 17, -36, 33, 44, 14, -22, -13, 58, -11, -45, 8, -26, 35, 36, -3, -90, 3, 48, -5, 62, -2, -48, 35, -40, 41, -29, 1, 81, 8,
+    -3, 24, 25, 62, 10, -18, -8, -48, 21, 21, 12, -19, -9, 16, -63, -10, 8, -33, -8, 127, -34, 51, 3, -35, -22, 32, -49, -29, 72, 30, 11, 0,
+    0, -23, -30, 33, 17, -28, 28, 3, 26, 33, -48, 31, -36, 35, 42, 20, 44, -2, -12, -115, 9, 23, 14, 2, 27, 54, 44, 27, -47, -50, -45, 8,
+    14, 0, 40, 0, 36, -13, 24, -33, 48, 13, 46, -23, 24, 127, -82, -40, 41, -35, -16, 39, -7, -4, -56, -17, -30, 17, -38, 40, 54, 38, 22, 47,
+    45, 58, -108, 38, -20, 86, -52, -14, -6, -38, 73, -11, 18, -58, -8, 55, 30, -127, -41, -96, 93, -21, -22, 65, 27, 33, 33, 47, 117, -22, 85, 4,
+    -49, 32, -47, 60, -28, -30, 54, -11, -4, 56, -63, -24, 66, -60, 114, 60, 86, 5, -30, 22, -55, -43, 7, -32, 27, -8, 60, -42, -2, 47, -37, -61,
+    40, -15, -8, -34, 27, 73, -20, 1, -87, 8, 66, 33, -11, -43, -45, -20, -38, -127, 34, -20, 20, 22, 38, -27, 34, -11, -28, -25, 1, 2, 22, 29,
+    16, -6, 43, 10, -74, 6, -7, -16, 10, 3, 15, -16, -20, -68, 36, 26, 27, -54, 43, 17, -23, 0, 13, 1, -39, 45, -8, 30, 27, 37, -18, 18,
+    -26, 54, -56, -59, -2, -53, -12, 63, 8, -35, -83, 58, 2, 26, 116, -36, 50, -45, -127, 24, 84, 27, 81, 24, -48, -52, 46, 31, 16, 5, -14, -53,
+    20, 21, -24, -44, -45, -45, 43, 25, -1, 68, -34, 52, 71, -5, 18, 46, 51, 11, -14, 48, -24, 44, 7, -2, 24, -32, 39, 0, -24, -8, 11, -10,
+    -23, -37, 66, 25, 5, 0, -41, 47, -127, -5, 55, -16, -33, 48, -61, 9, -30, 64, 28, -6, -31, 40, 10, -20, -20, -12, 35, 14, -63, 47, 3, 24,
+    42, 16, 19, -9, 27, -24, 21, -8, 18, 13, -19, -39, 17, 19, -65, -31, 13, -71, 11, -27, -4, 24, 63, -39, -28, 37, 42, 1, -15, 42, -15, -38,
+    -44, -37, 41, -9, -21, 63, -24, 4, -67, -52, 55, 46, -14, 99, -70, 8, -48, 26, 16, 32, -127, 41, -20, 49, 1, -32, 29, -3, -30, -9, -31, 1,
+    12, -42, -35, -22, 60, -33, -13, -2, -20, 10, 27, 22, -40, 119, 44, 7, -53, 32, 38, -34, 30, -36, 1, -5, 11, -8, -12, 40, 1, -31, -45, -12,
+    -15, 74, -45, 49, 58, 95, 73, -1, 3, 52, 56, 58, -31, -60, -48, -22, -54, -47, -1, 127, 71, 79, 64, -63, -74, 62, 71, 73, -72, 84, 56, 31,
+    -56, 60, 92, 52, -32, 33, -75, -22, -43, -48, 30, 0, 78, -62, -57, -73, -2, 34, -75, -116, 47, 22, -65, 45, 65, 45, -2, 23, -57, 28, -48, 24,
+    -26, -16, 125, -21, 38, 67, 25, -70, -83, 52, 22, -23, 55, 42, -5, 28, 27, 3, -120, -127, 47, 36, 8, 27, -51, -17, -9, -8, -73, -40, -104, 68,
+    -27, 35, 20, -9, 0, -18, -19, -35, 66, 39, 1, -1, -26, 18, 62, 34, -2, 67, -62, -70, 68, -2, 35, -20, -49, 21, -55, 16, 40, 45, -65, 20,
+    14, -4, -70, -17, -10, 64, 25, -1, 58, 39, 30, -13, -17, -10, -9, -8, -37, -127, -46, 27, -62, 23, -28, 40, 14, -10, -22, -6, 64, 36, -57, 51,
+    -20, 70, -39, 26, -68, -41, -48, -25, 43, 10, -18, -19, 21, 81, 106, 15, -22, 53, -28, 33, 41, 0, 19, 38, 27, -27, -45, 15, 29, 48, -4, 13,
+    -19, 14, 32, 41, 42, 34, -37, 13, 62, -20, -127, 39, 22, 24, 126, 36, 23, -118, -4, -88, 45, 22, 48, -41, -48, 33, 28, 12, -76, -12, 57, -34,
+    -40, 19, 13, -36, 4, 37, 42, -23, 28, 13, -32, 9, 19, 14, 39, 48, 26, 11, -9, -103, 36, 25, -45, -41, 23, -1, -4, 4, 18, 39, -3, -47,
+    41, 24, -25, 33, -42, -64, 19, 67, -49, 43, -75, -39, -50, -127, 46, -50, -32, 53, 4, -41, -47, -42, 68, -7, -26, 16, 24, 2, 55, -25, 78, -23,
+    -4, 2, 31, 64, -12, 39, 22, 54, 39, 30, -22, 56, -30, 18, -74, -7, -48, 7, 46, -55, 20, -33, 20, -19, -13, 39, 110, 15, 13, -21, 41, 9,
+    14, 26, 18, 13, -25, 78, 10, 1, -31, -1, 44, -17, 11, -16, -28, 29, 16, 25, 24, -19, -109, -1, 1, 20, 26, 9, 15, 19, 24, 32, -32, -22,
+    18, 1, 19, 17, -57, -14, -26, 25, -23, 14, -18, 22, -14, 127, 18, 28, -9, 20, -1, -68, -2, 9, 9, -21, 15, 1, 7, 30, 1, 25, 4, -13,
+    -9, -14, -10, 11, 3, -31, 7, 6, -25, 26, 41, -10, -21, -7, -61, -21, 25, 12, 22, 54, -127, 11, 47, 32, -23, 9, -18, 0, -47, 27, 68, -24,
+    -23, 27, -8, 31, 27, -12, 40, -9, -27, -17, 29, -23, -7, -5, -44, -33, -26, -31, 12, 12, -7, -27, 15, -21, 24, 16, -32, 39, 4, -35, 25, -5,
+};
+constexpr int32_t kAeL5Bias[128] = {
+    135079, 44717, 105652, 68823, 22223, 28358, 33085, 21863,
+    71834, -10615, 53572, -3088, 12014, 44150, 21419, 6900,
+    71601, 16111, 41355, 22307, 15716, 54157, -30640, 40998,
+    15539, 26266, -17036, 74443, 11545, 70830, -5919, 1286,
+    25235, 46171, 27479, -27719, -5743, 20508, 15323, 12392,
+    28439, 38659, -15056, 5393, 30936, 22533, 76618, 23632,
+    60243, 45566, -1950, 43529, 20009, 37395, -18110, 21327,
+    1964, 58060, 28449, -5541, 55835, -5956, 29421, 8488,
+    66808, 23627, 22257, -16678, 28954, 14587, -39368, 123540,
+    28371, 44943, 18135, 31809, -1275, 57370, 46292, 34735,
+    28326, 56448, -2755, 26705, -16365, 11178, 11532, 66708,
+    -741, 25331, 27296, 17874, 34349, 3850, -31356, 6418,
+    49656, 20439, 23726, -6456, 2325, 47181, 13238, 29456,
+    39409, 36996, 41142, 10420, 3377, 108916, -2379, 15963,
+    25054, 14388, 34443, 51805, 45326, 4016, 44779, -2153,
+    -10495, 80180, 2638, 34299, 24495, 24503, 40520, -11723,
+};
+constexpr int32_t kAeL5Multiplier[128] = {
+    1992844034, 2111404871, 1745455193, 1716851378, 1931352562, 1693877058, 1886015941, 1800359107,
+    2097166107, 1223850803, 1994732661, 1078689458, 1727985566, 1128033650, 2127342759, 1458589333,
+    1355766896, 1992589777, 1161847037, 2071959711, 1479811205, 1161797831, 1542520907, 1131492268,
+    1603178538, 1885028746, 1911245013, 1441516653, 1435424371, 1105299711, 1141485036, 2046180740,
+    2108128937, 1705856468, 1311840893, 1975207257, 1205460815, 1471424704, 1192269967, 1211481105,
+    1943358611, 1612671898, 2006749273, 1939274228, 1143438740, 1380034412, 1720887817, 1170002480,
+    1352707331, 1075472338, 1214082506, 1176090183, 1248866554, 1496019046, 1386678769, 1569732733,
+    1832051442, 2053067241, 1540697772, 1859474102, 2000447948, 1151096359, 1741391386, 1312656866,
+    1960070340, 1567498812, 1864354829, 1327243637, 1923276171, 2020332659, 1455479955, 1631602551,
+    1247561383, 1374794977, 1765280589, 1180941803, 1350049388, 1646048333, 1759953611, 1562325061,
+    1430721899, 1189299728, 1277088813, 1200428709, 1163269196, 1411294567, 1258553675, 1167638477,
+    2011486177, 1801540552, 1581357298, 1459126651, 1100230866, 1750053230, 2124677140, 1219814033,
+    1976592055, 2132663973, 1189685899, 1954267177, 1429288921, 1521564554, 1679436246, 1955594647,
+    1488768013, 1959493128, 1499297280, 1702392169, 2053296835, 1857130162, 1464547492, 1257158551,
+    1467188834, 1804208627, 2103744470, 1145382527, 1658671764, 1268587879, 1732488706, 1305358763,
+    2091032581, 1249823226, 1674425135, 2138323704, 1091444615, 2014256743, 1919558992, 1555850581,
+};
+constexpr int8_t kAeL5Shift[128] = {
+    -8, -8, -8, -8, -8, -8, -8, -7, -8, -7, -8, -7, -7, -7, -8, -7, -8, -8, -7, -8, -7, -7, -7, -7, -7, -8, -8, -7, -8, -7, -7, -8,
+    -7, -8, -7, -8, -7, -7, -7, -6, -8, -7, -7, -8, -6, -7, -8, -8, -7, -7, -7, -7, -7, -7, -7, -7, -7, -8, -7, -7, -8, -7, -7, -7,
+    -8, -8, -7, -7, -8, -7, -8, -8, -7, -8, -7, -7, -7, -8, -8, -8, -7, -7, -7, -7, -7, -7, -7, -7, -8, -7, -7, -7, -7, -8, -8, -7,
+    -8, -8, -7, -8, -7, -7, -7, -8, -7, -8, -7, -7, -7, -8, -7, -7, -8, -7, -8, -7, -8, -7, -8, -7, -8, -8, -8, -8, -7, -8, -7, -7,
+};
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "adc.hpp"
+#include "config.hpp"
+#include "telemetry.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+// Multi-band sweep over NodeConfig::bands. Retunes are driven from the capture
+// side: band_plan_next_window is installed as the ADC window scheduler, so at
+// the boundary where band k's dwell ends the tuner is pointed at band k+1 and
+// capture continues (after retune_settle_us of discarded samples) while
+// FFTTflmTask is still scoring band k's queued windows. Every window carries
+// its band index, and feature/noise-floor state is kept per band.
+
+// Points the RF front end at `band`. Runs in the capture context (the ADC DMA
+// callback on target): start the synthesizer/gain update and return, the
+// settle skip covers the lock time. Returns false if the retune failed.
+using BandTuneFn = bool (*)(const BandConfig& band, void* ctx);
+
+// Per-band detector state, updated by band_plan_record from FFTTflmTask.
+struct BandState {
+    RfFeatures last_features;
+    float last_score;
+    float noise_floor_dbm;     // EWMA of avg_dbm over windows below threshold
+    uint32_t last_timestamp_ms;
+    uint32_t windows;
+    uint32_t anomalies;        // windows scoring above the band's threshold
+};
+
+// The band that stood out most since the last band_plan_take_report: the
+// highest score relative to its own threshold, so a band that crossed its
+// threshold always beats one that did not.
+struct BandReport {
+    uint8_t band;
+    RfFeatures features;
+    float score;
+    bool anomaly;
+    uint32_t timestamp_ms;
+};
+
+struct BandPlanStats {
+    uint32_t retunes;
+    uint32_t retune_failures;
+    uint32_t sweeps;           // completed passes over the whole plan
+};
+
+// Validates and resolves cfg.bands[0..band_count): fft_size rounds up to a
+// power of two and is clamped to 64..cfg.fft_size, zero thresholds inherit
+// cfg.anomaly_threshold, and a dwell always spans at least one window.
+// Returns false (and leaves the plan inactive) when band_count is 0, exceeds
+// kMaxBands, or a band has no center frequency. Resets all band state.
+bool band_plan_init(const NodeConfig& cfg);
+bool band_plan_active();
+std::size_t band_plan_count();
+// Resolved band (fft_size/threshold filled in); nullptr past the end.
+const BandConfig* band_plan_band(std::size_t index);
+
+// nullptr leaves retunes as bookkeeping only (host builds without a front end).
+void band_plan_set_tuner(BandTuneFn fn, void* ctx);
+
+// AdcWindowScheduler for adc_capture_start (ctx unused).
+AdcWindowPlan band_plan_next_window(uint64_t sample_index, void* ctx);
+
+// Folds one scored window into its band's state and returns true if it
+// crossed that band's threshold. Call from the consumer only.
+bool band_plan_record(uint8_t band, const RfFeatures& features, float score, uint32_t timestamp_ms);
+const BandState* band_state(std::size_t index);
+// Hands out the report period's worst band and starts a new period; false if
+// nothing was recorded since the last take.
+bool band_plan_take_report(BandReport& out);
+
+BandPlanStats band_plan_stats();
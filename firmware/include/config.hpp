@@ -3,14 +3,52 @@
 #include <string>
 #include <cstdint>
 #include <array>
+#include <cstddef>
+
+// One entry of a multi-band sweep. Zero fields fall back to the node-wide
+// value (fft_size, anomaly_threshold, feature backend).
+struct BandConfig {
+    uint32_t center_freq_hz;
+    uint16_t dwell_ms;         // time on band per sweep, rounded up to whole windows
+    uint16_t fft_size;         // window length on this band, <= NodeConfig::fft_size
+    int8_t gain_db;            // front-end gain passed to the tuner
+    float anomaly_threshold;
+    std::array<uint16_t, 8> watch_bins; // Goertzel bins of this band's fft_size-point spectrum
+    uint8_t watch_bin_count;
+    uint8_t feature_backend;            // 1 + RfFeatureBackend (model_inference.hpp); 0 = GoertzelBank
+                                        // if watch_bin_count, else the node-wide backend
+};
+
+constexpr std::size_t kMaxBands = 8;
+
+// Energy pre-screen ahead of FFTTflmTask (prescreen.hpp).
+struct PrescreenConfig {
+    bool enabled;
+    float trigger_db;            // escalate above floor + trigger_db
+    float release_db;            // ... until below floor + release_db for hold_windows
+    uint16_t hold_windows;
+    uint16_t full_scan_every;    // forced full scan after this many skipped windows; 0 = never
+};
 
 struct NodeConfig {
     std::string node_id;
     uint32_t report_interval_ms;
     uint32_t rf_center_freq_hz;
-    uint16_t fft_size;
+    uint16_t fft_size;            // capture window / FFT length, power of two in 64..4096
+    uint32_t adc_sample_rate_hz;  // continuous capture rate; windows are fft_size samples long
+    uint8_t decimation;           // CIC/FIR factor ahead of the windows (decimator.hpp); 1 = off
+    uint16_t stft_hop_size;   // samples between STFT frames; 0 = fft_size / 2 (50% overlap)
+    uint8_t stft_window;      // WindowFunction (stft.hpp)
+    std::array<uint16_t, 8> watch_bins;  // fft_size-point bin indices for the Goertzel bank
+    uint8_t watch_bin_count;             // 0 = full-spectrum FFT
     float anomaly_threshold;
+    PrescreenConfig prescreen;
+    std::array<BandConfig, kMaxBands> bands; // sweep plan (band_plan.hpp)
+    uint8_t band_count;                      // 0 = single band at rf_center_freq_hz
+    uint16_t retune_settle_us;               // discarded after each retune; should cover the decimator's delay
     uint32_t heartbeat_interval_ms;
+    uint8_t mesh_schema_version;  // header.version of sent frames: 1 = float32 fields, 2 = quantised (mesh_schema.hpp)
+    uint16_t telemetry_keyframe_interval; // telemetry frames per keyframe, deltas in between; 0 or 1 = no deltas
     std::array<uint8_t, 32> mesh_key;
 };
 
@@ -16,6 +16,7 @@ struct AesGcmResult {
 };
 
 // Encrypts `plaintext` into `ciphertext`, writes tag into `auth_tag`.
+// `ciphertext` may be `plaintext` itself to encrypt in place.
 // Note: this is a software fallback that provides basic confidentiality +
 // integrity for host tests. On target hardware, replace with platform AES-GCM.
 AesGcmResult aes_gcm_encrypt(const uint8_t* plaintext,
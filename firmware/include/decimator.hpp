@@ -0,0 +1,51 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+constexpr std::size_t kMaxCicOrder = 5;
+constexpr uint8_t kDefaultCicOrder = 3;
+constexpr std::size_t kDecimFirTaps = 32;
+constexpr std::size_t kMaxFirPhases = 2;
+
+// Integer-factor decimator between capture and the FFT: an N-stage CIC
+// (integrators at the input rate, combs at its output rate, modular uint32
+// arithmetic) followed by a 32-tap compensating FIR in polyphase form. Even
+// factors split as CIC x factor/2 then FIR x 2; odd factors use the CIC for the
+// whole factor and the FIR only flattens its droop. The FIR is designed at init
+// (inverse-sinc^N passband to 40% of its output rate, Hamming window) and
+// quantized to Q14 or coarser with the CIC's power-of-two gain correction
+// folded in, so process() is integer-only (int32 accumulators) and the output
+// keeps input scale. Runs from the
+// ADC producer context; process() never allocates.
+struct Decimator {
+    uint16_t factor = 1;
+    uint16_t cic_factor = 1;
+    uint8_t fir_factor = 1;
+    uint8_t cic_order = 0;
+    uint8_t cic_shift = 0;
+    uint8_t coeff_shift = 0;    // coefficient fractional bits (Q14, fewer for large boosts)
+    std::size_t taps_per_phase = 0;
+    // Phase-major, each phase reversed so a branch is one forward dot product
+    // over its delay line.
+    std::array<std::array<int16_t, kDecimFirTaps>, kMaxFirPhases> coeffs{};
+    // Per-phase delay lines, mirrored (each sample stored at i and i + taps).
+    std::array<std::array<int16_t, 2 * kDecimFirTaps>, kMaxFirPhases> history{};
+    std::size_t history_pos = 0;
+    std::array<uint32_t, kMaxCicOrder> integrators{};
+    std::array<uint32_t, kMaxCicOrder> comb_delay{};
+    uint16_t cic_phase = 0;
+    uint8_t fir_phase = 0;
+};
+
+// factor 1 is a passthrough. Fails for factor 0 or > 255, cic_order outside
+// 1..kMaxCicOrder, or when the CIC register growth (order * log2(cic_factor))
+// would exceed 16 bits.
+bool decimator_init(Decimator& dec, uint16_t factor, uint8_t cic_order = kDefaultCicOrder);
+// Clears filter state (e.g. after a retune); coefficients are kept.
+void decimator_reset(Decimator& dec);
+// Consumes `count` input samples and writes the completed outputs to `out`
+// (room for count / factor + 1). Returns the number written. State carries
+// across calls, so any chunking gives the same output stream.
+std::size_t decimator_process(Decimator& dec, const int16_t* in, std::size_t count, int16_t* out);
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+
+// Vector kernels for the post-transform feature tail. The ISA is picked once at
+// runtime (AVX2 > SSE2 on x86, NEON on AArch64, scalar elsewhere, including
+// ESP32-S3 until a PIE kernel lands).
+//
+// Tolerance vs the scalar kernels: per-element magnitudes are identical on x86
+// (within 1 ulp where the scalar build contracts to FMA); max is exact; sum
+// differs only by reassociation (relative error <= count * 2^-24);
+// dsp_log10 has absolute error < 5e-6 against std::log10 for positive normal
+// inputs, i.e. under 1e-4 dB after the 20*log10 scaling used by RfFeatures.
+enum class DspIsa : uint8_t {
+    Scalar = 0,
+    Sse2,
+    Avx2,
+    Neon,
+};
+
+struct MagnitudeStats {
+    float max;
+    float sum;
+};
+
+DspIsa dsp_detect_isa();
+DspIsa dsp_active_isa();
+// Forces a kernel set (tests/benchmarks). Returns false if the CPU lacks the ISA.
+bool dsp_select_isa(DspIsa isa);
+const char* dsp_isa_name(DspIsa isa);
+
+// out[k] = re^2 + im^2
+void dsp_magnitude_squared(const std::complex<float>* bins, std::size_t count, float* out);
+
+// mags_out[k] = |bins[k]| * scale, with max and sum fused into the same pass.
+MagnitudeStats dsp_magnitude_stats(const std::complex<float>* bins, std::size_t count, float scale,
+                                   float* mags_out);
+
+// Fast log10 (exponent split + atanh series). Non-positive inputs clamp to FLT_MIN.
+void dsp_log10(const float* in, std::size_t count, float* out);
+float dsp_log10(float x);
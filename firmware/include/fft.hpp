@@ -0,0 +1,48 @@
+#pragma once
+
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+constexpr std::size_t kMaxFftSize = 4096;
+
+// Precomputed tables for an in-place iterative radix-2 FFT.
+// A plan built for N also serves every smaller power-of-two length by striding
+// through the twiddle table and shifting the bit-reversal entries.
+struct FftPlan {
+    std::size_t size = 0;
+    uint8_t log2_size = 0;
+    std::vector<std::complex<float>> twiddles; // exp(-2*pi*i*k/N), k < N/2
+    std::vector<uint16_t> bitrev;              // log2(N)-bit reversal of each index
+};
+
+bool fft_is_pow2(std::size_t n);
+std::size_t fft_next_pow2(std::size_t n);
+
+// Builds tables for length `n` (power of two, 2..kMaxFftSize). Reuses existing capacity.
+bool fft_plan_init(FftPlan& plan, std::size_t n);
+
+// Forward complex FFT of `n` points in place; `n` must be a power of two <= plan.size.
+bool fft_complex(const FftPlan& plan, std::complex<float>* data, std::size_t n);
+
+// Forward FFT of real samples: packs sample pairs into an n/2-point complex FFT
+// and splits the result with one post-twiddle pass. `count` samples are read
+// (zero-padded up to `n`); `out` receives the n/2 + 1 non-redundant bins.
+bool fft_real(const FftPlan& plan, const int16_t* samples, std::size_t count, std::size_t n,
+              std::complex<float>* out);
+
+// Same as fft_real over exactly `n` samples, multiplying by `window[i]` while
+// packing so callers can window a frame in place without a staging copy.
+bool fft_real_windowed(const FftPlan& plan, const int16_t* samples, const float* window, std::size_t n,
+                       std::complex<float>* out);
+
+// Batch-major variants: element (point p, window b) lives at data[p * batch + b],
+// so every twiddle is loaded once per butterfly column and applied across all
+// windows in a contiguous inner loop.
+bool fft_complex_batch(const FftPlan& plan, std::complex<float>* data, std::size_t n, std::size_t batch);
+
+// Real-input batch. On entry data[m * batch + b] = {x_b[2m], x_b[2m+1]} for
+// m < n/2; on return data[k * batch + b] = X_b[k] for k <= n/2, so `data` needs
+// (n/2 + 1) * batch slots.
+bool fft_real_batch(const FftPlan& plan, std::complex<float>* data, std::size_t n, std::size_t batch);
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Fixed-point FFT for FPU-less targets (RP2040-class). Data is interleaved
+// re/im int16 with block floating point: real value = stored * 2^exponent.
+// Every operation is integer-only so results are bit-exact across hosts.
+struct FftPlanQ15 {
+    std::size_t size = 0;
+    uint8_t log2_size = 0;
+    std::vector<int16_t> twiddles; // interleaved Q15 exp(-2*pi*i*k/N), k < N/2
+    std::vector<uint16_t> bitrev;
+};
+
+bool fft_plan_init_q15(FftPlanQ15& plan, std::size_t n);
+
+// In-place complex FFT of `n` points (power of two <= plan.size). Rescales the
+// block before any stage that could overflow and adds the shifts to `exponent`.
+bool fft_complex_q15(const FftPlanQ15& plan, int16_t* data, std::size_t n, int& exponent);
+
+// Real-input FFT straight from int16 ADC samples (`count` read, zero-padded to
+// `n`). Writes n/2 + 1 interleaved bins to `out` and sets the block `exponent`.
+bool fft_real_q15(const FftPlanQ15& plan, const int16_t* samples, std::size_t count, std::size_t n,
+                  int16_t* out, int& exponent);
+
+// log2(x) in Q16.16 via leading-bit position + 32-segment interpolated table.
+// Max error ~2e-4 (about 1e-3 dB). Returns INT32_MIN for x == 0.
+int32_t log2_q16(uint64_t x);
+
+// floor(sqrt(x)), bit-by-bit.
+uint32_t isqrt_u64(uint64_t x);
@@ -0,0 +1,28 @@
+#pragma once
+
+#include "dsp_kernels.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+constexpr std::size_t kMaxGoertzelBins = 16;
+
+// Coefficients for evaluating a sparse set of DFT bins with the Goertzel
+// recurrence. Each bin costs one multiply-add per sample (O(N) per bin), so a
+// bank of 4-8 watched channels is cheaper than a full N-point FFT for the
+// window sizes used here.
+struct GoertzelBank {
+    std::size_t n = 0;                          // window length the bins refer to
+    std::size_t bin_count = 0;
+    std::array<uint16_t, kMaxGoertzelBins> bins{};
+    std::array<float, kMaxGoertzelBins> coeff{}; // 2*cos(2*pi*k/n)
+};
+
+// Precomputes coefficients for DFT bins `bins[0..count)` of an `n`-point window.
+// Fails if count is 0 or exceeds kMaxGoertzelBins, n < 2, or any bin > n/2.
+bool goertzel_bank_init(GoertzelBank& bank, const uint16_t* bins, std::size_t count, std::size_t n);
+
+// mags_out[i] = |X[bins[i]]| * scale over samples[0..count) (zero-padded to
+// bank.n, at no cost), with max and sum over the watched bins.
+MagnitudeStats goertzel_bank_run(const GoertzelBank& bank, const int16_t* samples, std::size_t count, float scale,
+                                 float* mags_out);
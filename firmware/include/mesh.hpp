@@ -3,12 +3,26 @@
 #include "telemetry.hpp"
 #include "mesh_encode.hpp"
 #include "crypto.hpp"
+#include "mesh_fragment.hpp"
 
 void init_mesh();
 void set_mesh_node_id(const char* node_id);
-using MeshSendHandler = bool(*)(const EncryptedFrame&);
+// Receives each link packet (one fragment, mesh_fragment.hpp) to transmit.
+using MeshSendHandler = bool(*)(const LinkPacket&);
 void set_mesh_send_handler(MeshSendHandler handler);
 bool send_mesh_frame(const MeshFrame& frame);
+// send_mesh_frame in two steps, so a transport can keep the sealed bytes and
+// retry without re-encoding. seal_mesh_frame applies the TTL check and
+// encrypts into `out`, failing if the frame does not fit; send_sealed_frame
+// splits the frame into link packets and hands each to the send handler or radio.
+// A non-null `keyframe` seals a delta frame against it (encode_mesh_delta).
+bool seal_mesh_frame(const MeshFrame& frame, EncryptedFrame& out, const MeshFrame* keyframe = nullptr);
+bool send_sealed_frame(const EncryptedFrame& frame);
+// Decodes a clear body for local use, rebuilding delta frames. Telemetry
+// keyframes are cached per source (the last few sources heard); a delta is
+// decoded on top of its cached keyframe. Fails, counting a delta miss, when
+// that keyframe is not cached. `out` is reset first.
+bool receive_mesh_frame(const EncodedFrame& clear, MeshFrame& out);
 void add_route_entry(const RouteEntry& entry);
 MeshRoutingPayload current_routing_payload();
 
@@ -18,6 +32,9 @@ RouteEntry select_best_parent();
 void blacklist_route(const char* neighbor_id);
 bool is_route_blacklisted(const char* neighbor_id);
 bool should_forward_frame(MeshFrame& frame);
+// Same decision read from the header fields of a view, without decoding the
+// frame. The buffer is not modified; a relay that forwards sends hop_count + 1.
+bool should_forward_view(MeshFrameView& view);
 
 struct MeshMetrics {
     uint32_t parent_changes;
@@ -26,6 +43,7 @@ struct MeshMetrics {
     uint32_t fragments_sent;
     uint32_t fragments_dropped;
     uint32_t retry_drops;
+    uint32_t delta_misses;
 };
 
 MeshMetrics mesh_metrics();
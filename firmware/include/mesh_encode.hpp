@@ -4,6 +4,7 @@
 #include <array>
 #include <cstddef>
 #include "crypto.hpp"
+#include "mesh_schema.hpp"
 
 constexpr std::size_t kMaxMeshFrameLen = 256;
 constexpr std::size_t kMaxCipherLen = kMaxMeshFrameLen + 32;
@@ -19,5 +20,52 @@ struct EncryptedFrame {
 };
 
 EncodedFrame encode_mesh_frame(const MeshFrame& frame);
+// Delta telemetry: the header is written in full, and every other map carries
+// only the rows that moved past their deadband (mesh_schema.hpp) since
+// `keyframe`, or is left out when none did. frame.header.ref_seq_no should
+// name the keyframe so receivers can rebuild the frame on top of it.
+EncodedFrame encode_mesh_delta(const MeshFrame& frame, const MeshFrame& keyframe);
+// Decodes the clear CBOR body; fields absent from the frame are left untouched.
+bool decode_mesh_frame_clear(const EncodedFrame& enc, MeshFrame& out);
 EncryptedFrame encrypt_mesh_frame(const MeshFrame& frame, const AesGcmKey& key);
+// Same output as encrypt_mesh_frame, built in `out` alone: the body is encoded
+// at the ciphertext offset and encrypted in place. On failure out.len is 0.
+// A non-null `keyframe` encodes the body as encode_mesh_delta does.
+bool encrypt_mesh_frame_into(const MeshFrame& frame, const AesGcmKey& key, EncryptedFrame& out,
+                             const MeshFrame* keyframe = nullptr);
 bool decode_mesh_frame(const EncryptedFrame& enc, const AesGcmKey& key, MeshFrame& out);
+// Authenticates and decrypts into the clear CBOR body without decoding it or
+// touching the replay window.
+bool decrypt_mesh_frame(const EncryptedFrame& enc, const AesGcmKey& key, EncodedFrame& clear);
+
+// Read-only view over a clear CBOR body for callers that need a few fields
+// (relay decisions, gateway filtering) rather than a whole MeshFrame. Opening
+// validates the header and records where each header field sits; the other
+// top-level maps are indexed in one pass the first time one is asked for.
+// Accessors decode single fields straight from the buffer, which must outlive
+// the view.
+struct MeshFrameView {
+    const uint8_t* data = nullptr;
+    std::size_t len = 0;
+    // Offset of each map's CBOR head by MeshMapKey; 0 when the frame does not
+    // carry it. Same layout rules as decode_mesh_frame_clear.
+    std::array<uint16_t, kMeshMapCount + 1> maps{};
+    // Offset of each header field's value by MeshHeaderKey; 0 when absent.
+    std::array<uint16_t, 9> header{};
+    uint16_t layout = 0;     // maps carried by the header's msg_type
+    uint8_t version = 0;     // header.version, which selects the schema
+    uint16_t tail = 0;       // first top-level entry not yet indexed; 0 once indexed
+    uint16_t tail_count = 0; // top-level entries left to index
+};
+
+bool mesh_frame_view_open(const uint8_t* data, std::size_t len, MeshFrameView& view);
+// False when the frame does not carry `map` or it is malformed.
+bool mesh_frame_view_has(MeshFrameView& view, MeshMapKey map);
+// Field `key` of `map`; false when absent or not of the requested type.
+bool mesh_frame_view_uint(MeshFrameView& view, MeshMapKey map, uint8_t key, uint32_t& out);
+// Floats are read in whichever form the frame's schema uses (float32, half or scaled int).
+bool mesh_frame_view_float(MeshFrameView& view, MeshMapKey map, uint8_t key, float& out);
+// Points `out` at the text inside the buffer; it is not NUL-terminated.
+bool mesh_frame_view_text(MeshFrameView& view, MeshMapKey map, uint8_t key, const char*& out, std::size_t& len);
+// Decodes one whole map into its member of `out` (Rf into telemetry.rf_event, ...).
+bool mesh_frame_view_decode(MeshFrameView& view, MeshMapKey map, MeshFrame& out);
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "mesh_encode.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+// Link-layer fragmentation below the sealed mesh frame. Every radio packet
+// starts with a 5-byte header: the sender's short id (2 bytes), the frame tag
+// (2 bytes) and index << 4 | (count - 1). All fragments but the last carry
+// kFragmentPayload bytes. The tag is derived from the frame's nonce, so a
+// retried frame reuses it and its fragments fill the same reassembly slot.
+constexpr std::size_t kLinkMtu = 200;
+constexpr std::size_t kFragmentHeaderLen = 5;
+constexpr std::size_t kFragmentPayload = kLinkMtu - kFragmentHeaderLen;
+constexpr std::size_t kMaxFragments = 3;
+static_assert(kMaxCipherLen <= kMaxFragments * kFragmentPayload, "largest sealed frame fits in kMaxFragments");
+
+struct LinkPacket {
+    std::array<uint8_t, kLinkMtu> bytes;
+    std::size_t len;
+};
+
+// 16-bit id of a node on the link (FNV-1a of its node id, folded).
+uint16_t mesh_link_id(const char* node_id);
+// Fragments needed for a sealed frame of `len` bytes; 0 for an empty frame.
+std::size_t mesh_fragment_count(std::size_t len);
+// Builds fragment `index` of `frame` into `out`; false if out of range.
+bool mesh_fragment_build(const EncryptedFrame& frame, uint16_t link_id, std::size_t index, LinkPacket& out);
+
+// Receive side: a fixed pool of reassembly slots, each tracking its fragments
+// in a bitmap. A slot is freed when its frame completes, when it is older than
+// kReassemblyTimeoutMs, or when a new frame needs it and it is the oldest.
+constexpr std::size_t kReassemblySlots = 4;
+constexpr uint32_t kReassemblyTimeoutMs = 2000;
+
+struct FragmentStats {
+    uint32_t reassembled; // frames completed from more than one fragment
+    uint32_t timeouts;    // partial frames dropped after kReassemblyTimeoutMs
+    uint32_t evictions;   // partial frames dropped to make room
+    uint32_t invalid;     // packets with a bad header or length
+};
+
+void mesh_fragment_reset();
+// Feeds one received packet. True when it completes a frame, which is then in
+// `out`; duplicates of fragments already held are ignored.
+bool mesh_fragment_receive(const uint8_t* data, std::size_t len, uint32_t now_ms, EncryptedFrame& out);
+FragmentStats mesh_fragment_stats();
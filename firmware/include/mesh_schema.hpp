@@ -0,0 +1,276 @@
+#pragma once
+
+#include "telemetry.hpp"
+#include <cstddef>
+#include <cstdint>
+
+// Field-table form of the CBOR schema in docs/packet-schema.md.
+// Every map is a constexpr list of rows in ascending key order starting at 1;
+// mesh_encode.cpp expands the rows at compile time into straight-line
+// encoders (one room check per map, none per field) and key-indexed decoders.
+// A new field is one row here plus one line in the doc.
+//
+// header.version picks the schema per frame. v2 replaces the float32 rows of
+// the RF, GPS and health maps with half-floats and scaled integers; all other
+// maps are shared. Any version other than 2 is read and written as v1.
+constexpr uint8_t kMeshSchemaV1 = 1;
+constexpr uint8_t kMeshSchemaV2 = 2;
+
+enum class CborField : uint8_t {
+    U8,         // uint8_t or uint8_t-backed enum, as uint
+    U32,        // uint32_t, as uint
+    I8,         // int8_t, as the uint of its two's-complement byte
+    Bool,       // bool, as uint 0/1
+    F32,        // float, as simple(26) (F8 1A) + 4 raw little-endian bytes
+    F16,        // float, as a CBOR half-float (F9 + 2 big-endian bytes)
+    Scaled,     // float, as the int round(value * scale)
+    Text,       // NUL-terminated char[size], as tstr
+    Bytes,      // uint8_t[size], as bstr
+    Routes,     // MeshRoutingPayload::entries, as an array of kSchemaRouteEntry maps
+    RouteCount, // MeshRoutingPayload::entry_count, as uint
+};
+
+struct CborFieldDesc {
+    uint8_t key;
+    CborField kind;
+    uint16_t offset; // byte offset within the map's struct
+    uint8_t size;    // capacity of Text/Bytes fields
+    bool omit_zero;  // left out of the map when zero (fields added after v1)
+    float scale = 0; // Scaled fields: wire units per unit of the member
+    // Delta frames send the row when it has moved more than this from the
+    // keyframe (0: any change). kDeltaWithMap rows never trigger on their own
+    // and go out whenever another row of their map does.
+    float deadband = 0;
+};
+
+constexpr float kDeltaWithMap = -1.0f;
+
+// Top-level map keys.
+enum class MeshMapKey : uint8_t {
+    Header = 1,
+    Security = 2,
+    Counters = 3,
+    Rf = 4,
+    Gps = 5,
+    Health = 6,
+    Routing = 7,
+    Fault = 8,
+    Ota = 9,
+};
+constexpr std::size_t kMeshMapCount = 9;
+
+constexpr uint16_t mesh_map_bit(MeshMapKey key) {
+    return static_cast<uint16_t>(1u << static_cast<uint8_t>(key));
+}
+
+// Header, security and counters lead every frame so receivers can dispatch on
+// msg_type and run the replay check.
+constexpr uint16_t kMeshEnvelopeMaps =
+    mesh_map_bit(MeshMapKey::Header) | mesh_map_bit(MeshMapKey::Security) | mesh_map_bit(MeshMapKey::Counters);
+
+// Top-level maps carried by each message type, as mesh_map_bit flags. Control
+// has no payload of its own yet; unknown types get the envelope only.
+constexpr uint16_t mesh_layout(MeshMsgType type) {
+    switch (type) {
+        case MeshMsgType::Telemetry:
+            return kMeshEnvelopeMaps | mesh_map_bit(MeshMapKey::Rf) | mesh_map_bit(MeshMapKey::Gps) |
+                   mesh_map_bit(MeshMapKey::Health) | mesh_map_bit(MeshMapKey::Fault);
+        case MeshMsgType::Routing:
+            return kMeshEnvelopeMaps | mesh_map_bit(MeshMapKey::Routing);
+        case MeshMsgType::Control:
+            return kMeshEnvelopeMaps;
+        case MeshMsgType::Ota:
+            return kMeshEnvelopeMaps | mesh_map_bit(MeshMapKey::Ota);
+    }
+    return kMeshEnvelopeMaps;
+}
+
+constexpr std::size_t mesh_layout_count(uint16_t layout) {
+    std::size_t n = 0;
+    for (; layout != 0; layout &= static_cast<uint16_t>(layout - 1)) {
+        ++n;
+    }
+    return n;
+}
+
+inline constexpr CborFieldDesc kSchemaHeader[] = {
+    {1, CborField::U8, offsetof(MeshFrameHeader, version), 0, false},
+    {2, CborField::U8, offsetof(MeshFrameHeader, msg_type), 0, false},
+    {3, CborField::U8, offsetof(MeshFrameHeader, ttl), 0, false},
+    {4, CborField::U8, offsetof(MeshFrameHeader, hop_count), 0, false},
+    {5, CborField::U32, offsetof(MeshFrameHeader, seq_no), 0, false},
+    {6, CborField::Text, offsetof(MeshFrameHeader, src_node_id), kMaxNodeIdLength, false},
+    {7, CborField::Text, offsetof(MeshFrameHeader, dest_node_id), kMaxNodeIdLength, false},
+    {8, CborField::U32, offsetof(MeshFrameHeader, ref_seq_no), 0, true},
+};
+
+// Header row keys, for reading single fields through MeshFrameView.
+enum class MeshHeaderKey : uint8_t {
+    Version = 1,
+    MsgType = 2,
+    Ttl = 3,
+    HopCount = 4,
+    SeqNo = 5,
+    SrcNodeId = 6,
+    DestNodeId = 7,
+    RefSeqNo = 8,
+};
+static_assert(kSchemaHeader[static_cast<uint8_t>(MeshHeaderKey::Ttl) - 1].offset == offsetof(MeshFrameHeader, ttl) &&
+                  kSchemaHeader[static_cast<uint8_t>(MeshHeaderKey::HopCount) - 1].offset ==
+                      offsetof(MeshFrameHeader, hop_count) &&
+                  kSchemaHeader[static_cast<uint8_t>(MeshHeaderKey::SeqNo) - 1].offset ==
+                      offsetof(MeshFrameHeader, seq_no) &&
+                  kSchemaHeader[static_cast<uint8_t>(MeshHeaderKey::SrcNodeId) - 1].offset ==
+                      offsetof(MeshFrameHeader, src_node_id) &&
+                  kSchemaHeader[static_cast<uint8_t>(MeshHeaderKey::RefSeqNo) - 1].offset ==
+                      offsetof(MeshFrameHeader, ref_seq_no),
+              "MeshHeaderKey out of sync with kSchemaHeader");
+
+inline constexpr CborFieldDesc kSchemaSecurity[] = {
+    {1, CborField::Bool, offsetof(MeshSecurity, encrypted), 0, false},
+    {2, CborField::Bytes, offsetof(MeshSecurity, nonce), kNonceLength, false},
+    {3, CborField::Bytes, offsetof(MeshSecurity, auth_tag), kAuthTagLength, false},
+};
+
+inline constexpr CborFieldDesc kSchemaCounters[] = {
+    {1, CborField::U32, offsetof(MeshCounters, tx_counter), 0, false},
+    {2, CborField::U32, offsetof(MeshCounters, replay_window), 0, false},
+};
+
+inline constexpr CborFieldDesc kSchemaRf[] = {
+    {1, CborField::U32, offsetof(RFEvent, timestamp_ms), 0, false, 0, kDeltaWithMap},
+    {2, CborField::U32, offsetof(RFEvent, center_freq_hz), 0, false},
+    {3, CborField::F32, offsetof(RFEvent, features) + offsetof(RfFeatures, avg_dbm), 0, false, 0, 0.5f},
+    {4, CborField::F32, offsetof(RFEvent, features) + offsetof(RfFeatures, peak_dbm), 0, false, 0, 0.5f},
+    {5, CborField::F32, offsetof(RFEvent, anomaly_score), 0, false, 0, 0.02f},
+    {6, CborField::U8, offsetof(RFEvent, model_version), 0, false},
+    // Band index is only sent for multi-band nodes, keeping single-band frames unchanged.
+    {7, CborField::U8, offsetof(RFEvent, band), 0, true},
+};
+
+inline constexpr CborFieldDesc kSchemaGps[] = {
+    {1, CborField::U32, offsetof(GpsStatus, timestamp_ms), 0, false, 0, kDeltaWithMap},
+    {2, CborField::F32, offsetof(GpsStatus, latitude_deg), 0, false, 0, 1e-5f},
+    {3, CborField::F32, offsetof(GpsStatus, longitude_deg), 0, false, 0, 1e-5f},
+    {4, CborField::F32, offsetof(GpsStatus, altitude_m), 0, false, 0, 1.0f},
+    {5, CborField::U8, offsetof(GpsStatus, num_sats), 0, false},
+    {6, CborField::F32, offsetof(GpsStatus, hdop), 0, false, 0, 0.2f},
+    {7, CborField::Bool, offsetof(GpsStatus, valid_fix), 0, false},
+    {8, CborField::Bool, offsetof(GpsStatus, jamming_detected), 0, false},
+    {9, CborField::Bool, offsetof(GpsStatus, spoof_detected), 0, false},
+    {10, CborField::F32, offsetof(GpsStatus, cn0_db_hz_avg), 0, false, 0, 1.0f},
+};
+
+inline constexpr CborFieldDesc kSchemaHealth[] = {
+    {1, CborField::U32, offsetof(HealthStatus, timestamp_ms), 0, false, 0, kDeltaWithMap},
+    {2, CborField::F32, offsetof(HealthStatus, battery_v), 0, false, 0, 0.02f},
+    {3, CborField::F32, offsetof(HealthStatus, temp_c), 0, false, 0, 0.5f},
+    {4, CborField::F32, offsetof(HealthStatus, imu_tilt_deg), 0, false, 0, 1.0f},
+    {5, CborField::Bool, offsetof(HealthStatus, tamper_flag), 0, false},
+};
+
+// Schema v2 maps: same keys as v1, with floats quantised to what the values
+// need (0.5 dB, microdegrees, decimetres, millivolts, 0.1 degrees).
+inline constexpr CborFieldDesc kSchemaRfV2[] = {
+    {1, CborField::U32, offsetof(RFEvent, timestamp_ms), 0, false, 0, kDeltaWithMap},
+    {2, CborField::U32, offsetof(RFEvent, center_freq_hz), 0, false},
+    {3, CborField::Scaled, offsetof(RFEvent, features) + offsetof(RfFeatures, avg_dbm), 0, false, 2.0f, 0.5f},
+    {4, CborField::Scaled, offsetof(RFEvent, features) + offsetof(RfFeatures, peak_dbm), 0, false, 2.0f, 0.5f},
+    {5, CborField::F16, offsetof(RFEvent, anomaly_score), 0, false, 0, 0.02f},
+    {6, CborField::U8, offsetof(RFEvent, model_version), 0, false},
+    {7, CborField::U8, offsetof(RFEvent, band), 0, true},
+};
+
+inline constexpr CborFieldDesc kSchemaGpsV2[] = {
+    {1, CborField::U32, offsetof(GpsStatus, timestamp_ms), 0, false, 0, kDeltaWithMap},
+    {2, CborField::Scaled, offsetof(GpsStatus, latitude_deg), 0, false, 1e6f, 1e-5f},
+    {3, CborField::Scaled, offsetof(GpsStatus, longitude_deg), 0, false, 1e6f, 1e-5f},
+    {4, CborField::Scaled, offsetof(GpsStatus, altitude_m), 0, false, 10.0f, 1.0f},
+    {5, CborField::U8, offsetof(GpsStatus, num_sats), 0, false},
+    {6, CborField::Scaled, offsetof(GpsStatus, hdop), 0, false, 10.0f, 0.2f},
+    {7, CborField::Bool, offsetof(GpsStatus, valid_fix), 0, false},
+    {8, CborField::Bool, offsetof(GpsStatus, jamming_detected), 0, false},
+    {9, CborField::Bool, offsetof(GpsStatus, spoof_detected), 0, false},
+    {10, CborField::F16, offsetof(GpsStatus, cn0_db_hz_avg), 0, false, 0, 1.0f},
+};
+
+inline constexpr CborFieldDesc kSchemaHealthV2[] = {
+    {1, CborField::U32, offsetof(HealthStatus, timestamp_ms), 0, false, 0, kDeltaWithMap},
+    {2, CborField::Scaled, offsetof(HealthStatus, battery_v), 0, false, 1000.0f, 0.02f},
+    {3, CborField::Scaled, offsetof(HealthStatus, temp_c), 0, false, 10.0f, 0.5f},
+    {4, CborField::Scaled, offsetof(HealthStatus, imu_tilt_deg), 0, false, 10.0f, 1.0f},
+    {5, CborField::Bool, offsetof(HealthStatus, tamper_flag), 0, false},
+};
+
+inline constexpr CborFieldDesc kSchemaRouteEntry[] = {
+    {1, CborField::Text, offsetof(RouteEntry, neighbor_id), kMaxNodeIdLength, false},
+    {2, CborField::I8, offsetof(RouteEntry, rssi_dbm), 0, false},
+    {3, CborField::U8, offsetof(RouteEntry, link_quality), 0, false},
+    {4, CborField::U8, offsetof(RouteEntry, cost), 0, false},
+};
+
+inline constexpr CborFieldDesc kSchemaRouting[] = {
+    {1, CborField::U32, offsetof(MeshRoutingPayload, epoch_ms), 0, false},
+    {2, CborField::U32, offsetof(MeshRoutingPayload, version), 0, false},
+    {3, CborField::Routes, offsetof(MeshRoutingPayload, entries), 0, false},
+    {4, CborField::RouteCount, offsetof(MeshRoutingPayload, entry_count), 0, false},
+};
+
+inline constexpr CborFieldDesc kSchemaFault[] = {
+    {1, CborField::Bool, offsetof(FaultStatus, fault_active), 0, false},
+    {2, CborField::U32, offsetof(FaultStatus, counters) + offsetof(FaultCounters, watchdog_resets), 0, false},
+    {3, CborField::U32, offsetof(FaultStatus, counters) + offsetof(FaultCounters, ota_failures), 0, false},
+    {4, CborField::U32, offsetof(FaultStatus, counters) + offsetof(FaultCounters, tamper_events), 0, false},
+};
+
+inline constexpr CborFieldDesc kSchemaOta[] = {
+    {1, CborField::U8, offsetof(OtaStatus, state), 0, false},
+    {2, CborField::U32, offsetof(OtaStatus, current_offset), 0, false},
+    {3, CborField::U32, offsetof(OtaStatus, total_size), 0, false},
+    {4, CborField::Bool, offsetof(OtaStatus, signature_valid), 0, false},
+};
+
+// Largest encoding of one field (key byte included) and of a whole map
+// (head included). Routes counts no entries; callers add
+// kSchemaRouteEntryMaxLen per entry.
+constexpr std::size_t cbor_field_max_len(const CborFieldDesc& f) {
+    switch (f.kind) {
+        case CborField::U8:
+        case CborField::I8: return 1 + 2;
+        case CborField::U32:
+        case CborField::RouteCount: return 1 + 5;
+        case CborField::Bool: return 1 + 1;
+        case CborField::F32: return 1 + 2 + 4;
+        case CborField::F16: return 1 + 3;
+        case CborField::Scaled: return 1 + 5;
+        case CborField::Text:
+        case CborField::Bytes: return 1 + (f.size < 24 ? 1 : 2) + f.size;
+        case CborField::Routes: return 1 + 1;
+    }
+    return 0;
+}
+
+template <std::size_t N>
+constexpr std::size_t cbor_map_max_len(const CborFieldDesc (&fields)[N]) {
+    std::size_t len = 1;
+    for (std::size_t i = 0; i < N; ++i) {
+        len += cbor_field_max_len(fields[i]);
+    }
+    return len;
+}
+
+// Rows must be numbered 1..N in order so a decoded key indexes its row
+// directly, and exactly the Scaled rows carry a scale.
+template <std::size_t N>
+constexpr bool cbor_keys_dense(const CborFieldDesc (&fields)[N]) {
+    for (std::size_t i = 0; i < N; ++i) {
+        if (fields[i].key != i + 1 || fields[i].key >= 24 ||
+            (fields[i].kind == CborField::Scaled) != (fields[i].scale > 0)) {
+            return false;
+        }
+    }
+    return N < 24;
+}
+
+constexpr std::size_t kSchemaRouteEntryMaxLen = cbor_map_max_len(kSchemaRouteEntry);
+static_assert(kMaxRoutes < 24, "route array head is a single byte");
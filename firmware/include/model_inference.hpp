@@ -1,7 +1,73 @@
 #pragma once
 
+#include "config.hpp"
+#include "dsp_kernels.hpp"
 #include "telemetry.hpp"
+#include <array>
+#include <complex>
+#include <cstddef>
+
+// Transform used by extract_rf_features. RealFft exploits the real int16 ADC
+// samples (half-size complex FFT + split); ComplexFft is kept for IQ input.
+// FixedQ15 is integer-only for FPU-less targets and the default under
+// OL_FIXED_POINT_DSP. GoertzelBank only evaluates the bins configured with
+// set_goertzel_bins and is meant for nodes watching a few known channels.
+enum class RfFeatureBackend : uint8_t {
+    RealFft = 0,
+    ComplexFft,
+    FixedQ15,
+    GoertzelBank,
+};
+
+// Model input contract (ai/scripts/extract_features.py defaults): the first
+// 128 bins of a 256-point FFT, |X| + 1e-6 -> log1p -> divided by the per-window
+// max (+ 1e-6). ADC counts are scaled to full scale first so magnitudes sit in
+// the same range as the training IQ.
+constexpr std::size_t kFeatureBins = 128;
+constexpr std::size_t kFeatureFftSize = 2 * kFeatureBins;
+constexpr float kAdcFullScale = 2048.0f; // 12-bit ADC centred on 0
+
+struct RfFeatureVector {
+    std::array<float, kFeatureBins> bins;
+};
 
 void init_model_inference();
+// Selects the capture window profile for cfg.fft_size (window_profile.hpp) and
+// sizes FFT tables to it. A non-empty cfg.watch_bins list selects the
+// GoertzelBank backend. Returns false if the profile could not be selected; the
+// tables then follow the window length still in use.
+bool init_model_inference(const NodeConfig& cfg);
+void set_rf_feature_backend(RfFeatureBackend backend);
+RfFeatureBackend rf_feature_backend();
+// Watched bins (indices into the fft_size-point spectrum) for GoertzelBank.
+// Coefficients are computed here, not per window. Swept bands use
+// set_band_feature_backend instead.
+bool set_goertzel_bins(const uint16_t* bins, std::size_t count);
+// Per-band feature backend for band sweeps, from a resolved band entry
+// (band_plan_band): a Goertzel band gets its own bank over its fft_size-point
+// spectrum, other choices have their tables prepared here so switching bands
+// costs nothing. False (and the node-wide backend on that band) if the
+// backend is unknown or the bins are invalid.
+bool set_band_feature_backend(uint8_t band, const BandConfig& cfg);
+// Band of the windows that follow (kMaxBands: none). rf_feature_backend()
+// and extract_rf_features follow that band's backend.
+void select_rf_feature_band(uint8_t band);
 RfFeatures extract_rf_features(const RFSampleWindow& window);
+// Same over raw samples (pool windows). A RealFft call over exactly
+// window_profile().samples uses that profile's fixed-size specialization.
+RfFeatures extract_rf_features(const int16_t* samples, std::size_t count);
+// dB features from an already-normalized magnitude spectrum (used by the STFT stage).
+RfFeatures features_from_magnitude_stats(const MagnitudeStats& stats, std::size_t bin_count);
+// Writes the model input for `window` into `out` (zero-padded/truncated to
+// kFeatureFftSize samples). No allocation after init_model_inference.
+bool extract_rf_feature_vector(const RFSampleWindow& window, RfFeatureVector& out);
+bool extract_rf_feature_vector(const int16_t* samples, std::size_t count, RfFeatureVector& out);
+// Same normalization from an unscaled FFT spectrum. Bin k is read from
+// spectrum[k * stride], so batch-major spectra work without a gather.
+void feature_vector_from_spectrum(const std::complex<float>* spectrum, std::size_t stride, RfFeatureVector& out);
+// Scalar fallback score from peak/avg spread (fixed-point and Goertzel backends).
 float run_model_inference(const RfFeatures& features);
+// Int8 autoencoder score (autoencoder.hpp) over a kAutoencoderInputs-long
+// normalized feature vector; 0 if `count` does not match the model.
+float run_model_inference(const float* features, std::size_t count);
+float run_model_inference(const RfFeatureVector& features);
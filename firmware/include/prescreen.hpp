@@ -0,0 +1,42 @@
+#pragma once
+
+#include "config.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+// Energy pre-screen ahead of the FFT. Each window's AC energy (mean square
+// after removing its mean, in ADC counts^2) is compared to a tracked noise
+// floor; only excursions, and a forced full scan every
+// PrescreenConfig::full_scan_every windows, escalate to the transform and
+// model. Hysteresis: escalation starts above trigger_db over the floor and
+// ends once the energy has stayed below release_db for hold_windows windows.
+// The floor follows quiet windows only, so a sustained emitter does not
+// raise it while escalated.
+enum class PrescreenDecision : uint8_t {
+    Skip = 0,
+    Escalate,    // energy excursion (or still within its hold)
+    ForcedScan,  // periodic full scan of a quiet band
+};
+
+struct PrescreenState {
+    float noise_floor = 0.0f;    // counts^2
+    bool seeded = false;
+    bool escalated = false;
+    uint16_t hold_left = 0;
+    uint16_t since_full_scan = 0;
+};
+
+struct PrescreenStats {
+    uint32_t windows;
+    uint32_t skipped;
+    uint32_t escalated;          // windows passed on because of an excursion
+    uint32_t forced_scans;
+    uint32_t triggers;           // quiet -> escalated transitions
+};
+
+// Mean-removed mean square of `samples` (integer sums, exact for any window length used here).
+float window_ac_energy(const int16_t* samples, std::size_t count);
+
+PrescreenDecision prescreen_update(PrescreenState& st, const PrescreenConfig& cfg, float energy,
+                                   PrescreenStats* stats = nullptr);
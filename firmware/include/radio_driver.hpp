@@ -1,6 +1,6 @@
 #pragma once
 
-#include "mesh_encode.hpp"
+#include "mesh_fragment.hpp"
 
 enum class RadioTransport {
     EspNow,
@@ -13,4 +13,4 @@ enum class RadioTransport {
 void init_radio_driver();
 void set_radio_transport(RadioTransport mode);
 RadioTransport current_radio_transport();
-bool radio_driver_send(const EncryptedFrame& frame);
+bool radio_driver_send(const LinkPacket& packet);
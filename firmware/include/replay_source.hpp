@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Host-only capture source that replays recorded arrays from ai/data through
+// the ADC capture path. Files are memory-mapped and decoded in place: a .npy
+// file directly, or one member of an .npz archive when that member is stored
+// uncompressed (np.savez). Members of np.savez_compressed archives are
+// deflated and cannot be mapped; open fails with ReplayError::CompressedMember
+// (unzip the member to a .npy first).
+
+enum class NpyDtype : uint8_t {
+    Int8,
+    UInt8,
+    Int16,
+    Int32,
+    Float32,
+    Float64,
+};
+
+struct NpyInfo {
+    NpyDtype dtype;
+    std::size_t count;        // product of the shape; C-order arrays are read flat
+    std::size_t header_bytes; // magic + header; data starts here
+};
+
+enum class ReplayError : uint8_t {
+    None = 0,
+    OpenFailed,
+    NotNpy,
+    UnsupportedDtype,
+    FortranOrder,
+    Truncated,
+    NotZip,
+    MemberNotFound,
+    CompressedMember,
+};
+
+// Parses a .npy header (format versions 1-3, little-endian or single-byte dtypes).
+ReplayError npy_parse_header(const uint8_t* data, std::size_t len, NpyInfo& out);
+
+struct ReplaySource {
+    const uint8_t* map = nullptr;   // whole mapped file
+    std::size_t map_len = 0;
+    const uint8_t* data = nullptr;  // first element
+    NpyInfo info{};
+    std::size_t pos = 0;            // next element
+    float scale = 2048.0f;          // float samples -> ADC counts (full scale = 1.0)
+    bool loop = false;
+    uint32_t passes = 0;            // completed passes over the array
+};
+
+// `member` selects an .npz entry ("iq_real" or "iq_real.npy"); ignored for .npy files.
+ReplayError replay_open(ReplaySource& src, const char* path, const char* member = nullptr);
+void replay_close(ReplaySource& src);
+void replay_rewind(ReplaySource& src);
+
+// Converts up to `count` elements to int16 ADC counts (floats scaled by
+// `scale`, everything saturated). Wraps at the end when `loop` is set; returns
+// fewer than `count` (0 at the end) otherwise.
+std::size_t replay_read(ReplaySource& src, int16_t* out, std::size_t count);
+
+// AdcSampleSource adapter: `ctx` is a ReplaySource*.
+std::size_t replay_source_read(int16_t* out, std::size_t count, void* ctx);
+
+const char* replay_error_name(ReplayError err);
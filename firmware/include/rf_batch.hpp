@@ -0,0 +1,36 @@
+#pragma once
+
+#include "fft.hpp"
+#include "model_inference.hpp"
+#include "telemetry.hpp"
+#include <complex>
+#include <cstddef>
+#include <vector>
+
+// Caller-owned state for batch scoring. Everything is sized by rf_batch_init;
+// rf_batch_score touches no globals, so one workspace per thread makes the
+// batch path reentrant (gateway rescoring, historical captures).
+struct RfBatchWorkspace {
+    FftPlan plan;
+    std::size_t fft_size = 0;
+    std::size_t max_batch = 0;
+    std::vector<std::complex<float>> spectra; // (fft_size/2 + 1) * max_batch, batch-major
+    std::vector<std::complex<float>> column;  // one window's bins, gathered for the magnitude kernel
+    std::vector<float> mags;
+    std::vector<std::complex<float>> feature_spectra; // (kFeatureBins + 1) * max_batch, batch-major; empty when
+                                                      // fft_size == kFeatureFftSize (spectra are reused)
+    std::vector<RfFeatureVector> features;            // max_batch model inputs
+    std::vector<int8_t> model_scratch;                // autoencoder activations
+    std::vector<float> mse;
+};
+
+// `fft_size` is rounded up to a power of two (<= kMaxFftSize).
+bool rf_batch_init(RfBatchWorkspace& ws, std::size_t fft_size, std::size_t max_batch);
+
+// Scores windows[0..count) into events[0..count), max_batch windows per FFT
+// pass. sample_count is clamped to the window's sample array, as in
+// extract_rf_features. Every window is zero-padded (or truncated) to ws.fft_size; for windows
+// whose padded length equals fft_size the features match extract_rf_features
+// with the RealFft backend. anomaly_score is the autoencoder score of the
+// window's RfFeatureVector, as on the node. Returns the number of events written.
+std::size_t rf_batch_score(RfBatchWorkspace& ws, const RFSampleWindow* windows, std::size_t count, RFEvent* events);
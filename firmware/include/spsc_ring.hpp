@@ -0,0 +1,97 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+struct SpscRingStats {
+    uint32_t pushed;
+    uint32_t popped;
+    uint32_t overruns;   // producer found the ring full; the item was dropped
+    uint32_t underruns;  // consumer polled an empty ring
+};
+
+// Bounded lock-free single-producer/single-consumer ring. Slots are filled and
+// read in place: the producer reserves the tail slot, writes it, then commits;
+// the consumer reads the head slot, then pops. Each side owns one index, so
+// neither ever waits for the other. N must be a power of two.
+template <typename T, std::size_t N>
+class SpscRing {
+    static_assert(N >= 2 && (N & (N - 1)) == 0, "SpscRing capacity must be a power of two");
+
+public:
+    static constexpr std::size_t capacity() { return N; }
+
+    // Producer: slot to fill, or nullptr (counted as an overrun) when full.
+    T* try_reserve() {
+        const std::size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - head_.load(std::memory_order_acquire) >= N) {
+            overruns_.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        return &slots_[tail & (N - 1)];
+    }
+
+    // Producer: publishes the slot returned by the last try_reserve().
+    void commit() {
+        tail_.store(tail_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        pushed_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    bool try_push(const T& item) {
+        T* slot = try_reserve();
+        if (slot == nullptr) {
+            return false;
+        }
+        *slot = item;
+        commit();
+        return true;
+    }
+
+    // Consumer: oldest unread slot, or nullptr (counted as an underrun) when empty.
+    // The slot stays valid until pop().
+    T* front() {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_.load(std::memory_order_acquire)) {
+            underruns_.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        return &slots_[head & (N - 1)];
+    }
+
+    // Consumer: releases the slot returned by front() back to the producer.
+    void pop() {
+        head_.store(head_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+        popped_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    bool try_pop(T& out) {
+        T* slot = front();
+        if (slot == nullptr) {
+            return false;
+        }
+        out = *slot;
+        pop();
+        return true;
+    }
+
+    std::size_t size() const {
+        return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+    }
+
+    SpscRingStats stats() const {
+        return {pushed_.load(std::memory_order_relaxed), popped_.load(std::memory_order_relaxed),
+                overruns_.load(std::memory_order_relaxed), underruns_.load(std::memory_order_relaxed)};
+    }
+
+private:
+    std::array<T, N> slots_{};
+    // Kept on separate cache lines so the two sides do not false-share.
+    alignas(64) std::atomic<std::size_t> head_{0};
+    alignas(64) std::atomic<std::size_t> tail_{0};
+    std::atomic<uint32_t> pushed_{0};
+    std::atomic<uint32_t> popped_{0};
+    std::atomic<uint32_t> overruns_{0};
+    std::atomic<uint32_t> underruns_{0};
+};
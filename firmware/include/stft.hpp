@@ -0,0 +1,59 @@
+#pragma once
+
+#include "dsp_kernels.hpp"
+#include "fft.hpp"
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+enum class WindowFunction : uint8_t {
+    Rectangular = 0,
+    Hann,
+    Hamming,
+    Blackman,
+};
+
+struct StftConfig {
+    std::size_t frame_size;    // power of two, 2..kMaxFftSize
+    std::size_t hop_size;      // samples between frame starts; < frame_size overlaps
+    WindowFunction window;
+};
+
+// One emitted frame. `magnitudes` points into engine storage and is only valid
+// for the duration of the handler call.
+struct StftFrame {
+    uint32_t index;
+    uint32_t timestamp_ms;
+    const float* magnitudes;   // frame_size/2 + 1 bins, amplitude-normalized by the window gain
+    std::size_t bin_count;
+    MagnitudeStats stats;
+};
+
+using StftFrameHandler = void(*)(const StftFrame& frame, void* ctx);
+
+// Streaming STFT. Samples land in a mirrored ring (each sample is stored at i
+// and i + frame_size) so the newest frame is always contiguous and overlapping
+// frames are windowed straight out of the ring. All storage is sized in
+// stft_init; stft_push never allocates.
+struct StftState {
+    StftConfig cfg{};
+    FftPlan plan;
+    std::vector<float> window;
+    float window_gain = 0.0f;              // sum(window): amplitude normalization
+    std::vector<int16_t> ring;             // 2 * frame_size
+    std::size_t write_pos = 0;
+    std::size_t until_next_frame = 0;
+    uint32_t frames_emitted = 0;
+    std::vector<std::complex<float>> spectrum;
+    std::vector<float> magnitudes;
+};
+
+// Periodic (DFT-even) window of length n.
+void build_window_table(WindowFunction fn, float* out, std::size_t n);
+
+bool stft_init(StftState& st, const StftConfig& cfg);
+void stft_reset(StftState& st);
+// Appends samples and calls `handler` for every completed frame. Returns the number of frames emitted.
+std::size_t stft_push(StftState& st, const int16_t* samples, std::size_t count, uint32_t timestamp_ms,
+                      StftFrameHandler handler, void* ctx);
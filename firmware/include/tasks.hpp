@@ -5,6 +5,9 @@
 #include "telemetry.hpp"
 #include "fault.hpp"
 #include "ota.hpp"
+#include "prescreen.hpp"
+#include "spsc_ring.hpp"
+#include "window_pool.hpp"
 #include <cstddef>
 
 struct TaskConfig {
@@ -33,3 +36,15 @@ constexpr std::size_t kTaskCount = 8;
 const std::array<TaskConfig, kTaskCount>& task_plan();
 TaskStatus run_firmware_cycle(const NodeConfig& cfg, uint32_t now_ms);
 void start_freertos_tasks(const NodeConfig& cfg);
+
+// Counters for the RFScanTask -> FFTTflmTask window queue.
+SpscRingStats rf_window_queue_stats();
+
+// FFTTflmTask energy pre-screen counters: windows seen, skipped without an
+// FFT, escalated on an excursion, and forced periodic scans.
+PrescreenStats prescreen_stats();
+
+// Most recent window FFTTflmTask processed, with a reference added for the
+// caller (window_pool_release when done), or kNoWindow. Lets snapshot readers
+// inspect raw samples without copying them.
+WindowHandle acquire_latest_rf_window();
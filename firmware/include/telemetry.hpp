@@ -36,6 +36,7 @@ struct RFEvent {
     RfFeatures features;
     float anomaly_score;
     uint8_t model_version;
+    uint8_t band;             // band plan index; 0 without a plan
 };
 
 struct GpsStatus {
@@ -67,6 +68,7 @@ struct MeshFrameHeader {
     uint32_t seq_no;
     char src_node_id[kMaxNodeIdLength];
     char dest_node_id[kMaxNodeIdLength];
+    uint32_t ref_seq_no; // delta frames: seq_no of the keyframe they build on; 0 otherwise
 };
 
 struct MeshSecurity {
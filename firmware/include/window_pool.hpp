@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Fixed pool of RF sample windows shared by capture, feature extraction and
+// snapshot readers. Stages pass small handles instead of copying windows; each
+// holder owns one reference and releases it when done, and the window returns
+// to the pool when the count reaches zero. Acquire/retain/release are
+// lock-free and safe from the ADC ISR. Sample storage belongs to the active
+// window profile (window_profile.hpp), so window length follows fft_size.
+using WindowHandle = uint8_t;
+
+constexpr WindowHandle kNoWindow = 0xFF;
+// ADC fill + handoff, 4 queued, 1 in FFT/snapshot, plus spare for readers.
+constexpr std::size_t kWindowPoolSize = 8;
+
+struct RfWindow {
+    int16_t* samples;          // window_profile().samples long
+    std::size_t sample_count;  // valid samples, <= window_profile().samples
+    uint32_t timestamp_ms;
+    uint32_t center_freq_hz;
+    uint8_t band;              // band plan index the samples were captured on
+    uint64_t first_sample;     // capture sample index of samples[0] (after decimation)
+};
+
+struct WindowPoolStats {
+    uint32_t in_use;
+    uint32_t high_water;
+    uint32_t exhausted;  // acquire calls that found no free window
+};
+
+// Claims a free window with one reference, or kNoWindow if all are held.
+// Contents are left as the previous owner wrote them.
+WindowHandle window_pool_acquire();
+void window_pool_retain(WindowHandle h);
+void window_pool_release(WindowHandle h);
+
+// Valid while the caller holds a reference; nullptr for kNoWindow. Read-only
+// on the pool itself: `samples` was resolved when the window was acquired.
+RfWindow* window_pool_get(WindowHandle h);
+uint32_t window_pool_refcount(WindowHandle h);
+
+WindowPoolStats window_pool_stats();
@@ -0,0 +1,38 @@
+#pragma once
+
+#include "dsp_kernels.hpp"
+#include "fft.hpp"
+#include <cstddef>
+#include <cstdint>
+
+// Capture window geometry, fixed once at startup from NodeConfig::fft_size.
+// Every supported length (64..4096, powers of two) is a compiled
+// specialization with its own fixed-size buffers: the sample storage behind
+// the window pool plus the spectrum/magnitude scratch and FFT tables for one
+// full window. Only the selected specialization is allocated, so a node
+// running 128-point windows holds ~4 KB instead of the ~115 KB a 4096-point
+// node needs.
+constexpr std::size_t kMinWindowSamples = 64;
+constexpr std::size_t kMaxWindowSamples = kMaxFftSize;
+constexpr std::size_t kDefaultWindowSamples = 128;
+
+struct WindowProfile {
+    std::size_t samples; // window length == FFT size
+    std::size_t bins;    // samples / 2 + 1
+    std::size_t bytes;   // RAM held by the selected specialization
+};
+
+// Rounds `fft_size` up to a power of two, clamps to 64..4096 and allocates the
+// matching specialization (a no-op if it is already active). Fails while any
+// pool window is still referenced, since their storage would move.
+bool window_profile_select(std::size_t fft_size);
+
+// Active profile; selects kDefaultWindowSamples on first use if nothing has.
+const WindowProfile& window_profile();
+
+// Sample storage of pool window `index` (< kWindowPoolSize), window_profile().samples long.
+int16_t* window_profile_samples(std::size_t index);
+
+// Real FFT magnitudes of one full window through the active specialization,
+// scaled by 1/samples; `mags_out`, if given, points at the bins until the next call.
+MagnitudeStats window_profile_spectrum(const int16_t* samples, const float** mags_out = nullptr);
@@ -1,19 +1,38 @@
 #include "adc.hpp"
+#include "decimator.hpp"
+#include "window_profile.hpp"
 #include <algorithm>
+#include <atomic>
+#include <cstring>
 
 #ifdef ESP_PLATFORM
+#include "esp_adc/adc_continuous.h"
 #include "esp_adc/adc_oneshot.h"
 #include "esp_err.h"
 #include "esp_log.h"
+#include "soc/soc_caps.h"
+#else
+#include <chrono>
+#include <thread>
 #endif
 
 namespace {
 #ifdef ESP_PLATFORM
 adc_oneshot_unit_handle_t g_adc_unit = nullptr;
+adc_continuous_handle_t g_adc_stream = nullptr;
 constexpr adc_unit_t kAdcUnit = ADC_UNIT_1;
 constexpr adc_channel_t kAdcChannel = ADC_CHANNEL_0; // adjust per board (GPIO36 on ESP32-class)
+constexpr uint32_t kConvFrameBytes = 64 * SOC_ADC_DIGI_RESULT_BYTES;
 bool g_adc_ready = false;
 
+#if CONFIG_IDF_TARGET_ESP32 || CONFIG_IDF_TARGET_ESP32S2
+constexpr adc_digi_output_format_t kOutputFormat = ADC_DIGI_OUTPUT_FORMAT_TYPE1;
+inline uint32_t result_data(const adc_digi_output_data_t* p) { return p->type1.data; }
+#else
+constexpr adc_digi_output_format_t kOutputFormat = ADC_DIGI_OUTPUT_FORMAT_TYPE2;
+inline uint32_t result_data(const adc_digi_output_data_t* p) { return p->type2.data; }
+#endif
+
 bool check_esp(esp_err_t err, const char* msg) {
     if (err != ESP_OK) {
         ESP_LOGE("ADC", "%s failed: %s", msg, esp_err_to_name(err));
@@ -22,6 +41,163 @@ bool check_esp(esp_err_t err, const char* msg) {
     return true;
 }
 #endif
+
+// The producer fills a pool window in place; on completion the handle moves
+// into the handoff slot and the consumer takes ownership of it by exchange, so
+// neither side waits and no samples are copied after the DMA callback.
+constexpr uint32_t kFreshBit = 0x100;
+constexpr uint32_t kHandleMask = 0xFF;
+
+std::atomic<uint32_t> g_handoff{kNoWindow};
+WindowHandle g_fill = kNoWindow; // producer-owned
+std::size_t g_fill_pos = 0;      // producer-owned
+std::size_t g_window_samples = kDefaultWindowSamples; // profile length, fixed while capture runs
+uint64_t g_sample_index = 0;     // producer-owned: absolute index of the next (decimated) sample
+Decimator g_decimator;           // producer-owned
+// Producer-owned layout of the window being filled (AdcWindowScheduler).
+AdcWindowScheduler g_scheduler = nullptr;
+void* g_scheduler_ctx = nullptr;
+std::size_t g_fill_len = kDefaultWindowSamples;
+std::size_t g_skip = 0;
+uint32_t g_fill_freq_hz = 0;
+uint8_t g_fill_band = 0;
+
+std::atomic<bool> g_capture_running{false};
+uint32_t g_sample_rate_hz = 0;
+std::atomic<uint32_t> g_windows_completed{0};
+std::atomic<uint32_t> g_windows_taken{0};
+std::atomic<uint32_t> g_windows_dropped{0};
+std::atomic<uint32_t> g_dma_overflows{0};
+std::atomic<uint32_t> g_samples_skipped{0};
+std::atomic<uint32_t> g_windows_filtered{0};
+std::atomic<uint32_t> g_want_band{kAdcAnyBand};
+
+std::atomic<uint32_t> g_frontend_freq_hz{0};
+std::atomic<int32_t> g_frontend_gain_db{0};
+std::atomic<uint32_t> g_frontend_tunes{0};
+
+void release_capture_windows() {
+    window_pool_release(g_fill);
+    g_fill = kNoWindow;
+    const uint32_t pending = g_handoff.exchange(kNoWindow);
+    if (pending & kFreshBit) {
+        window_pool_release(static_cast<WindowHandle>(pending & kHandleMask));
+    }
+}
+
+void plan_next_window() {
+    g_fill_len = g_window_samples;
+    g_skip = 0;
+    g_fill_freq_hz = 0;
+    g_fill_band = 0;
+    if (g_scheduler == nullptr) {
+        return;
+    }
+    const AdcWindowPlan plan = g_scheduler(g_sample_index, g_scheduler_ctx);
+    if (plan.samples != 0 && plan.samples < g_window_samples) {
+        g_fill_len = plan.samples;
+    }
+    g_skip = plan.skip;
+    g_fill_freq_hz = plan.center_freq_hz;
+    g_fill_band = plan.band;
+}
+
+void reset_capture_state(uint32_t sample_rate_hz) {
+    release_capture_windows();
+    g_fill_pos = 0;
+    g_sample_index = 0;
+    g_sample_rate_hz = sample_rate_hz;
+    g_window_samples = window_profile().samples;
+    g_windows_completed.store(0, std::memory_order_relaxed);
+    g_windows_taken.store(0, std::memory_order_relaxed);
+    g_windows_dropped.store(0, std::memory_order_relaxed);
+    g_dma_overflows.store(0, std::memory_order_relaxed);
+    g_samples_skipped.store(0, std::memory_order_relaxed);
+    g_windows_filtered.store(0, std::memory_order_relaxed);
+    g_want_band.store(kAdcAnyBand, std::memory_order_relaxed);
+    plan_next_window();
+}
+
+#ifdef ESP_PLATFORM
+// Runs in ISR context once per DMA conversion frame.
+bool IRAM_ATTR on_conv_done(adc_continuous_handle_t, const adc_continuous_evt_data_t* edata, void*) {
+    constexpr std::size_t kMaxResults = kConvFrameBytes / SOC_ADC_DIGI_RESULT_BYTES;
+    int16_t block[kMaxResults];
+    std::size_t count = 0;
+    for (uint32_t i = 0; i + SOC_ADC_DIGI_RESULT_BYTES <= edata->size && count < kMaxResults;
+         i += SOC_ADC_DIGI_RESULT_BYTES) {
+        const auto* p = reinterpret_cast<const adc_digi_output_data_t*>(&edata->conv_frame_buffer[i]);
+        // Center 12-bit unsigned ADC to signed for FFT input.
+        block[count++] = static_cast<int16_t>(static_cast<int>(std::min<uint32_t>(result_data(p), 4095)) - 2048);
+    }
+    adc_capture_ingest(block, count);
+    return false;
+}
+
+// The driver pool filled up before the callback drained it; samples were lost.
+bool IRAM_ATTR on_pool_ovf(adc_continuous_handle_t, const adc_continuous_evt_data_t*, void*) {
+    g_dma_overflows.fetch_add(1, std::memory_order_relaxed);
+    return false;
+}
+#else
+// Host producer: emits samples from the configured source (the stub waveform
+// by default) in fixed blocks. Paced mode schedules against the steady clock,
+// so sample n is due at start + n / rate regardless of jitter; unpaced mode
+// runs as fast as the consumer takes windows and never drops one.
+struct HostProducer {
+    std::thread thread;
+    std::atomic<bool> stop{false};
+    std::atomic<bool> source_done{false};
+
+    ~HostProducer() { halt(); }
+
+    void halt() {
+        stop.store(true);
+        if (thread.joinable()) {
+            thread.join();
+        }
+    }
+};
+
+HostProducer g_host_producer;
+
+int16_t host_stub_sample(uint64_t n) {
+    // Ramp + small spike, repeating every window.
+    return static_cast<int16_t>((n % g_window_samples) == 5 ? 200 : n % 64);
+}
+
+void host_producer_loop(AdcCaptureConfig cfg) {
+    using Clock = std::chrono::steady_clock;
+    constexpr std::size_t kBlock = 32; // <= the smallest window, so a block completes at most one
+    const auto start = Clock::now();
+    uint64_t produced = 0;
+    int16_t block[kBlock];
+    while (!g_host_producer.stop.load(std::memory_order_relaxed)) {
+        std::size_t n = kBlock;
+        if (cfg.host_source != nullptr) {
+            n = cfg.host_source(block, kBlock, cfg.host_source_ctx);
+        } else {
+            for (std::size_t i = 0; i < kBlock; ++i) {
+                block[i] = host_stub_sample(produced + i);
+            }
+        }
+        if (n == 0) {
+            g_host_producer.source_done.store(true);
+            return;
+        }
+        produced += n;
+        if (cfg.host_paced) {
+            std::this_thread::sleep_until(start + std::chrono::nanoseconds(produced * 1000000000ull /
+                                                                           cfg.sample_rate_hz));
+        } else {
+            while (adc_capture_pending() && !g_host_producer.stop.load(std::memory_order_relaxed)) {
+                std::this_thread::yield();
+            }
+        }
+        adc_capture_ingest(block, n);
+    }
+}
+#endif
 } // namespace
 
 void init_adc() {
@@ -52,6 +228,11 @@ RFSampleWindow collect_rf_window(uint32_t now_ms) {
     window.center_freq_hz = 915000000; // placeholder ISM band
     window.sample_count = kMaxRfSamples;
 
+    if (adc_capture_running()) {
+        window.sample_count = 0;
+        return window;
+    }
+
 #ifdef ESP_PLATFORM
     if (!g_adc_ready) {
         ESP_LOGW("ADC", "collect_rf_window: ADC not initialized, returning zeroes");
@@ -83,3 +264,249 @@ RFSampleWindow collect_rf_window(uint32_t now_ms) {
 
     return window;
 }
+
+bool adc_capture_start(const AdcCaptureConfig& cfg) {
+    if (cfg.sample_rate_hz == 0) {
+        return false;
+    }
+    adc_capture_stop();
+    if (!decimator_init(g_decimator, cfg.decimation)) {
+        return false;
+    }
+    g_scheduler = cfg.scheduler;
+    g_scheduler_ctx = cfg.scheduler_ctx;
+
+#ifdef ESP_PLATFORM
+    uint32_t rate = cfg.sample_rate_hz;
+    if (cfg.start_producer) {
+        rate = std::clamp<uint32_t>(rate, SOC_ADC_SAMPLE_FREQ_THRES_LOW, SOC_ADC_SAMPLE_FREQ_THRES_HIGH);
+        // The continuous driver and the one-shot driver cannot share the unit.
+        if (g_adc_unit != nullptr) {
+            adc_oneshot_del_unit(g_adc_unit);
+            g_adc_unit = nullptr;
+            g_adc_ready = false;
+        }
+
+        adc_continuous_handle_cfg_t handle_cfg = {};
+        handle_cfg.max_store_buf_size = 4 * kConvFrameBytes;
+        handle_cfg.conv_frame_size = kConvFrameBytes;
+        if (!check_esp(adc_continuous_new_handle(&handle_cfg, &g_adc_stream), "adc_continuous_new_handle")) {
+            return false;
+        }
+
+        adc_digi_pattern_config_t pattern = {};
+        pattern.atten = ADC_ATTEN_DB_12;
+        pattern.channel = kAdcChannel & 0x7;
+        pattern.unit = kAdcUnit;
+        pattern.bit_width = SOC_ADC_DIGI_MAX_BITWIDTH;
+
+        adc_continuous_config_t dig_cfg = {};
+        dig_cfg.sample_freq_hz = rate;
+        dig_cfg.conv_mode = ADC_CONV_SINGLE_UNIT_1;
+        dig_cfg.format = kOutputFormat;
+        dig_cfg.pattern_num = 1;
+        dig_cfg.adc_pattern = &pattern;
+
+        adc_continuous_evt_cbs_t cbs = {};
+        cbs.on_conv_done = on_conv_done;
+        cbs.on_pool_ovf = on_pool_ovf;
+        if (!check_esp(adc_continuous_config(g_adc_stream, &dig_cfg), "adc_continuous_config") ||
+            !check_esp(adc_continuous_register_event_callbacks(g_adc_stream, &cbs, nullptr),
+                       "adc_continuous_register_event_callbacks")) {
+            adc_continuous_deinit(g_adc_stream);
+            g_adc_stream = nullptr;
+            return false;
+        }
+    }
+    reset_capture_state(rate);
+    g_capture_running.store(true);
+    if (g_adc_stream != nullptr && !check_esp(adc_continuous_start(g_adc_stream), "adc_continuous_start")) {
+        adc_capture_stop();
+        return false;
+    }
+    ESP_LOGI("ADC", "continuous capture at %u Hz, %u-sample windows", static_cast<unsigned>(rate),
+             static_cast<unsigned>(g_window_samples));
+#else
+    reset_capture_state(cfg.sample_rate_hz);
+    g_capture_running.store(true);
+    if (cfg.start_producer) {
+        g_host_producer.stop.store(false);
+        g_host_producer.source_done.store(false);
+        g_host_producer.thread = std::thread(host_producer_loop, cfg);
+    }
+#endif
+    return true;
+}
+
+void adc_capture_stop() {
+#ifdef ESP_PLATFORM
+    if (g_adc_stream != nullptr) {
+        adc_continuous_stop(g_adc_stream);
+        adc_continuous_deinit(g_adc_stream);
+        g_adc_stream = nullptr;
+    }
+#else
+    g_host_producer.halt();
+#endif
+    g_capture_running.store(false);
+    release_capture_windows();
+}
+
+bool adc_capture_running() {
+    return g_capture_running.load();
+}
+
+uint32_t adc_capture_sample_rate_hz() {
+    return adc_capture_running() ? g_sample_rate_hz : 0;
+}
+
+static void fill_windows(const int16_t* samples, std::size_t count) {
+    while (count > 0) {
+        if (g_skip > 0) {
+            const std::size_t n = std::min(count, g_skip);
+            g_skip -= n;
+            g_sample_index += n;
+            samples += n;
+            count -= n;
+            g_samples_skipped.fetch_add(static_cast<uint32_t>(n), std::memory_order_relaxed);
+            continue;
+        }
+        // Claim a window only at a window boundary so a failed acquire
+        // discards whole windows and sample indices stay aligned.
+        if (g_fill == kNoWindow && g_fill_pos == 0) {
+            g_fill = window_pool_acquire();
+        }
+        const std::size_t n = std::min(count, g_fill_len - g_fill_pos);
+        if (RfWindow* w = window_pool_get(g_fill)) {
+            std::memcpy(w->samples + g_fill_pos, samples, n * sizeof(int16_t));
+        }
+        g_fill_pos += n;
+        samples += n;
+        count -= n;
+        if (g_fill_pos < g_fill_len) {
+            break;
+        }
+
+        const uint64_t first = g_sample_index;
+        g_sample_index += g_fill_len;
+        g_fill_pos = 0;
+        g_windows_completed.fetch_add(1, std::memory_order_relaxed);
+        const WindowHandle done = g_fill;
+        g_fill = kNoWindow;
+        if (done == kNoWindow) {
+            // Pool exhausted for this whole window: samples were discarded.
+            g_windows_dropped.fetch_add(1, std::memory_order_relaxed);
+            plan_next_window();
+            continue;
+        }
+
+        RfWindow& w = *window_pool_get(done);
+        w.sample_count = g_fill_len;
+        w.timestamp_ms =
+            g_sample_rate_hz ? static_cast<uint32_t>(first * g_decimator.factor * 1000u / g_sample_rate_hz) : 0;
+        w.center_freq_hz = g_fill_freq_hz;
+        w.band = g_fill_band;
+        w.first_sample = first;
+        // The next window's layout (and any retune) is settled before this one
+        // is published, so the front end moves on while the consumer works.
+        plan_next_window();
+
+        const uint32_t want = g_want_band.load(std::memory_order_relaxed);
+        if (want != kAdcAnyBand && w.band != want) {
+            window_pool_release(done);
+            g_windows_filtered.fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
+        // Publish, and drop whichever window was still waiting unread.
+        const uint32_t prev = g_handoff.exchange(done | kFreshBit, std::memory_order_acq_rel);
+        if (prev & kFreshBit) {
+            window_pool_release(static_cast<WindowHandle>(prev & kHandleMask));
+            g_windows_dropped.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+}
+
+void adc_capture_ingest(const int16_t* samples, std::size_t count) {
+    if (samples == nullptr) {
+        return;
+    }
+    if (g_decimator.factor <= 1) {
+        fill_windows(samples, count);
+        return;
+    }
+    constexpr std::size_t kChunk = 64;
+    int16_t decimated[kChunk + 1];
+    while (count > 0) {
+        const std::size_t n = std::min(count, kChunk);
+        fill_windows(decimated, decimator_process(g_decimator, samples, n, decimated));
+        samples += n;
+        count -= n;
+    }
+}
+
+bool adc_capture_pending() {
+    return (g_handoff.load(std::memory_order_acquire) & kFreshBit) != 0;
+}
+
+WindowHandle adc_capture_take_handle(uint64_t* first_sample) {
+    if (!adc_capture_pending()) {
+        return kNoWindow;
+    }
+    // Only this consumer clears the fresh bit, so the exchange always yields a window.
+    const uint32_t prev = g_handoff.exchange(kNoWindow, std::memory_order_acq_rel);
+    const auto h = static_cast<WindowHandle>(prev & kHandleMask);
+    if (first_sample != nullptr) {
+        *first_sample = window_pool_get(h)->first_sample;
+    }
+    g_windows_taken.fetch_add(1, std::memory_order_relaxed);
+    return h;
+}
+
+void adc_capture_want_band(uint8_t band) {
+    g_want_band.store(band, std::memory_order_relaxed);
+}
+
+bool adc_frontend_tune(const BandConfig& band, void*) {
+    // No synthesizer or gain stage is wired on this board yet; the driver
+    // reads the setting published here.
+    g_frontend_freq_hz.store(band.center_freq_hz, std::memory_order_relaxed);
+    g_frontend_gain_db.store(band.gain_db, std::memory_order_relaxed);
+    g_frontend_tunes.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+
+AdcFrontEnd adc_frontend() {
+    AdcFrontEnd fe{};
+    fe.center_freq_hz = g_frontend_freq_hz.load(std::memory_order_relaxed);
+    fe.gain_db = static_cast<int8_t>(g_frontend_gain_db.load(std::memory_order_relaxed));
+    fe.tunes = g_frontend_tunes.load(std::memory_order_relaxed);
+    return fe;
+}
+
+bool adc_capture_take(RFSampleWindow& out, uint64_t* first_sample) {
+    const WindowHandle h = adc_capture_take_handle(first_sample);
+    if (h == kNoWindow) {
+        return false;
+    }
+    const RfWindow& w = *window_pool_get(h);
+    out.timestamp_ms = w.timestamp_ms;
+    out.center_freq_hz = w.center_freq_hz;
+    out.sample_count = std::min(w.sample_count, kMaxRfSamples);
+    std::copy(w.samples, w.samples + out.sample_count, out.samples.begin());
+    window_pool_release(h);
+    return true;
+}
+
+AdcCaptureStats adc_capture_stats() {
+    AdcCaptureStats stats{};
+    stats.windows_completed = g_windows_completed.load(std::memory_order_relaxed);
+    stats.windows_taken = g_windows_taken.load(std::memory_order_relaxed);
+    stats.windows_dropped = g_windows_dropped.load(std::memory_order_relaxed);
+    stats.dma_overflows = g_dma_overflows.load(std::memory_order_relaxed);
+    stats.samples_skipped = g_samples_skipped.load(std::memory_order_relaxed);
+    stats.windows_filtered = g_windows_filtered.load(std::memory_order_relaxed);
+#ifndef ESP_PLATFORM
+    stats.source_done = g_host_producer.source_done.load();
+#endif
+    return stats;
+}
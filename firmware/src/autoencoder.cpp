@@ -0,0 +1,152 @@
+#include "autoencoder.hpp"
+#include "autoencoder_model_data.hpp"
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace {
+struct DenseLayerQ8 {
+    std::size_t in;
+    std::size_t out;
+    const int8_t* weights;     // [out][in]
+    const int32_t* bias;       // input zero-point already folded in
+    const int32_t* multiplier; // Q31 requantization multiplier per channel
+    const int8_t* shift;       // M = multiplier * 2^(shift - 31)
+    int32_t out_zero_point;
+    bool relu;
+};
+
+constexpr std::array<DenseLayerQ8, kAeLayerCount> kLayers{{
+    {kAeLayerDims[0], kAeLayerDims[1], kAeL0Weights, kAeL0Bias, kAeL0Multiplier, kAeL0Shift, kAeL0ZeroPoint, true},
+    {kAeLayerDims[1], kAeLayerDims[2], kAeL1Weights, kAeL1Bias, kAeL1Multiplier, kAeL1Shift, kAeL1ZeroPoint, true},
+    {kAeLayerDims[2], kAeLayerDims[3], kAeL2Weights, kAeL2Bias, kAeL2Multiplier, kAeL2Shift, kAeL2ZeroPoint, true},
+    {kAeLayerDims[3], kAeLayerDims[4], kAeL3Weights, kAeL3Bias, kAeL3Multiplier, kAeL3Shift, kAeL3ZeroPoint, true},
+    {kAeLayerDims[4], kAeLayerDims[5], kAeL4Weights, kAeL4Bias, kAeL4Multiplier, kAeL4Shift, kAeL4ZeroPoint, true},
+    {kAeLayerDims[5], kAeLayerDims[6], kAeL5Weights, kAeL5Bias, kAeL5Multiplier, kAeL5Shift, kAeL5ZeroPoint, false},
+}};
+
+constexpr std::size_t max_layer_width() {
+    std::size_t widest = 0;
+    for (std::size_t dim : kAeLayerDims) {
+        widest = std::max(widest, dim);
+    }
+    return widest;
+}
+
+// Planned at compile time: two activation buffers of the widest layer.
+constexpr std::size_t kArenaWidth = (max_layer_width() + 15) & ~static_cast<std::size_t>(15);
+alignas(16) int8_t g_arena[2 * kArenaWidth];
+
+static_assert(kAeLayerDims[0] == kAutoencoderInputs, "model input width");
+static_assert(kAeLayerDims[kAeLayerCount] == kAutoencoderInputs, "model output width");
+// FFTTflmTask runs with a 3584-word stack; the arena lives in .bss, not on it.
+static_assert(sizeof(g_arena) <= 1024, "activation arena grew unexpectedly");
+
+int8_t requantize(int32_t acc, int32_t multiplier, int8_t shift, int32_t zero_point, int32_t lo) {
+    const int total_shift = 31 - shift;
+    const int64_t prod = static_cast<int64_t>(acc) * multiplier + (static_cast<int64_t>(1) << (total_shift - 1));
+    const int32_t out = static_cast<int32_t>(prod >> total_shift) + zero_point;
+    return static_cast<int8_t>(std::clamp(out, lo, static_cast<int32_t>(127)));
+}
+
+// y = requant(W x + b) for `batch` activation vectors laid out [window][width].
+// Windows are processed four at a time so each weight row is loaded once per
+// tile instead of once per window.
+void dense_q8_batch(const DenseLayerQ8& layer, const int8_t* in, std::size_t in_stride, int8_t* out,
+                    std::size_t out_stride, std::size_t batch) {
+    const int32_t lo = layer.relu ? layer.out_zero_point : -128;
+    std::size_t b = 0;
+    for (; b + 4 <= batch; b += 4) {
+        const int8_t* x0 = in + b * in_stride;
+        const int8_t* x1 = x0 + in_stride;
+        const int8_t* x2 = x1 + in_stride;
+        const int8_t* x3 = x2 + in_stride;
+        for (std::size_t o = 0; o < layer.out; ++o) {
+            const int8_t* row = layer.weights + o * layer.in;
+            int32_t acc0 = layer.bias[o];
+            int32_t acc1 = acc0;
+            int32_t acc2 = acc0;
+            int32_t acc3 = acc0;
+            for (std::size_t i = 0; i < layer.in; ++i) {
+                const int32_t w = row[i];
+                acc0 += w * x0[i];
+                acc1 += w * x1[i];
+                acc2 += w * x2[i];
+                acc3 += w * x3[i];
+            }
+            int8_t* y = out + b * out_stride + o;
+            y[0] = requantize(acc0, layer.multiplier[o], layer.shift[o], layer.out_zero_point, lo);
+            y[out_stride] = requantize(acc1, layer.multiplier[o], layer.shift[o], layer.out_zero_point, lo);
+            y[2 * out_stride] = requantize(acc2, layer.multiplier[o], layer.shift[o], layer.out_zero_point, lo);
+            y[3 * out_stride] = requantize(acc3, layer.multiplier[o], layer.shift[o], layer.out_zero_point, lo);
+        }
+    }
+    for (; b < batch; ++b) {
+        const int8_t* x = in + b * in_stride;
+        for (std::size_t o = 0; o < layer.out; ++o) {
+            const int8_t* row = layer.weights + o * layer.in;
+            int32_t acc = layer.bias[o];
+            for (std::size_t i = 0; i < layer.in; ++i) {
+                acc += static_cast<int32_t>(row[i]) * static_cast<int32_t>(x[i]);
+            }
+            out[b * out_stride + o] = requantize(acc, layer.multiplier[o], layer.shift[o], layer.out_zero_point, lo);
+        }
+    }
+}
+} // namespace
+
+void autoencoder_reconstruction_error_batch(const float* features, std::size_t batch, int8_t* scratch,
+                                            float* mse_out) {
+    if (features == nullptr || scratch == nullptr || mse_out == nullptr) {
+        return;
+    }
+
+    int8_t* cur = scratch;
+    int8_t* next = scratch + batch * kArenaWidth;
+    for (std::size_t b = 0; b < batch; ++b) {
+        const float* x = features + b * kAutoencoderInputs;
+        for (std::size_t i = 0; i < kAutoencoderInputs; ++i) {
+            const int32_t q = static_cast<int32_t>(std::floor(x[i] / kAeInputScale + 0.5f)) + kAeInputZeroPoint;
+            cur[b * kArenaWidth + i] =
+                static_cast<int8_t>(std::clamp(q, static_cast<int32_t>(-128), static_cast<int32_t>(127)));
+        }
+    }
+    for (const DenseLayerQ8& layer : kLayers) {
+        dense_q8_batch(layer, cur, kArenaWidth, next, kArenaWidth, batch);
+        std::swap(cur, next);
+    }
+
+    for (std::size_t b = 0; b < batch; ++b) {
+        const float* x = features + b * kAutoencoderInputs;
+        const int8_t* y = cur + b * kArenaWidth;
+        float sum = 0.0f;
+        for (std::size_t i = 0; i < kAutoencoderInputs; ++i) {
+            const float recon = static_cast<float>(y[i] - kAeOutputZeroPoint) * kAeOutputScale;
+            const float diff = recon - x[i];
+            sum += diff * diff;
+        }
+        mse_out[b] = sum / static_cast<float>(kAutoencoderInputs);
+    }
+}
+
+float autoencoder_reconstruction_error(const float* features) {
+    float mse = 0.0f;
+    autoencoder_reconstruction_error_batch(features, 1, g_arena, &mse);
+    return mse;
+}
+
+std::size_t autoencoder_batch_scratch_bytes(std::size_t batch) {
+    return 2 * kArenaWidth * batch;
+}
+
+float autoencoder_anomaly_score(float mse) {
+    return std::clamp(0.5f * mse / kAeMseThreshold, 0.0f, 1.0f);
+}
+
+float autoencoder_mse_threshold() {
+    return kAeMseThreshold;
+}
+
+std::size_t autoencoder_arena_bytes() {
+    return sizeof(g_arena);
+}
@@ -0,0 +1,169 @@
+#include "band_plan.hpp"
+#include "fft.hpp"
+#include "window_profile.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+
+namespace {
+std::array<BandConfig, kMaxBands> g_bands{};
+std::array<uint64_t, kMaxBands> g_dwell_samples{};
+std::size_t g_count = 0;
+std::size_t g_settle_samples = 0;
+
+// Capture-side sweep position, touched only by band_plan_next_window.
+std::size_t g_current = 0;
+uint64_t g_dwell_end = 0;
+bool g_tuned = false;
+
+BandTuneFn g_tuner = nullptr;
+void* g_tuner_ctx = nullptr;
+
+std::array<BandState, kMaxBands> g_state{};
+BandReport g_report{};
+float g_report_margin = 0.0f;
+bool g_report_valid = false;
+
+std::atomic<uint32_t> g_retunes{0};
+std::atomic<uint32_t> g_retune_failures{0};
+std::atomic<uint32_t> g_sweeps{0};
+
+// Noise floor EWMA weight per quiet window.
+constexpr float kFloorAlpha = 0.125f;
+
+std::size_t clamp_window(std::size_t n, std::size_t max_len) {
+    return std::min(std::max(fft_next_pow2(std::max<std::size_t>(n, 1)), kMinWindowSamples), max_len);
+}
+} // namespace
+
+bool band_plan_init(const NodeConfig& cfg) {
+    g_count = 0;
+    g_current = 0;
+    g_dwell_end = 0;
+    g_tuned = false;
+    g_state.fill(BandState{});
+    g_report_valid = false;
+    g_retunes.store(0, std::memory_order_relaxed);
+    g_retune_failures.store(0, std::memory_order_relaxed);
+    g_sweeps.store(0, std::memory_order_relaxed);
+    // Dwell and settle are counted in window samples, i.e. after decimation.
+    const uint32_t rate = cfg.adc_sample_rate_hz / std::max<uint32_t>(cfg.decimation, 1);
+    if (cfg.band_count == 0 || cfg.band_count > kMaxBands || rate == 0) {
+        return false;
+    }
+
+    const std::size_t window_max = clamp_window(cfg.fft_size, kMaxWindowSamples);
+    for (std::size_t i = 0; i < cfg.band_count; ++i) {
+        BandConfig band = cfg.bands[i];
+        if (band.center_freq_hz == 0) {
+            return false;
+        }
+        band.fft_size = static_cast<uint16_t>(clamp_window(band.fft_size ? band.fft_size : window_max, window_max));
+        if (band.anomaly_threshold <= 0.0f) {
+            band.anomaly_threshold = cfg.anomaly_threshold;
+        }
+        // Whole windows only, at least one per visit.
+        const uint64_t dwell = static_cast<uint64_t>(band.dwell_ms) * rate / 1000u;
+        const uint64_t windows = std::max<uint64_t>((dwell + band.fft_size - 1) / band.fft_size, 1);
+        g_dwell_samples[i] = windows * band.fft_size;
+        g_bands[i] = band;
+    }
+    g_settle_samples = static_cast<std::size_t>(static_cast<uint64_t>(cfg.retune_settle_us) * rate / 1000000u);
+    g_count = cfg.band_count;
+    return true;
+}
+
+bool band_plan_active() {
+    return g_count != 0;
+}
+
+std::size_t band_plan_count() {
+    return g_count;
+}
+
+const BandConfig* band_plan_band(std::size_t index) {
+    return index < g_count ? &g_bands[index] : nullptr;
+}
+
+void band_plan_set_tuner(BandTuneFn fn, void* ctx) {
+    g_tuner = fn;
+    g_tuner_ctx = ctx;
+}
+
+AdcWindowPlan band_plan_next_window(uint64_t sample_index, void*) {
+    AdcWindowPlan plan{};
+    if (g_count == 0) {
+        return plan;
+    }
+    if (!g_tuned || sample_index >= g_dwell_end) {
+        if (g_tuned) {
+            g_current = (g_current + 1) % g_count;
+            if (g_current == 0) {
+                g_sweeps.fetch_add(1, std::memory_order_relaxed);
+            }
+        }
+        // A one-band plan tunes once and then just renews its dwell.
+        if (!g_tuned || g_count > 1) {
+            g_retunes.fetch_add(1, std::memory_order_relaxed);
+            if (g_tuner != nullptr && !g_tuner(g_bands[g_current], g_tuner_ctx)) {
+                g_retune_failures.fetch_add(1, std::memory_order_relaxed);
+            }
+            plan.skip = g_settle_samples;
+        }
+        g_tuned = true;
+        g_dwell_end = sample_index + plan.skip + g_dwell_samples[g_current];
+    }
+    const BandConfig& band = g_bands[g_current];
+    plan.samples = band.fft_size;
+    plan.center_freq_hz = band.center_freq_hz;
+    plan.band = static_cast<uint8_t>(g_current);
+    return plan;
+}
+
+bool band_plan_record(uint8_t band, const RfFeatures& features, float score, uint32_t timestamp_ms) {
+    if (band >= g_count) {
+        return false;
+    }
+    BandState& st = g_state[band];
+    const bool anomaly = score > g_bands[band].anomaly_threshold;
+    if (st.windows == 0) {
+        st.noise_floor_dbm = features.avg_dbm;
+    } else if (!anomaly) {
+        st.noise_floor_dbm += kFloorAlpha * (features.avg_dbm - st.noise_floor_dbm);
+    }
+    st.last_features = features;
+    st.last_score = score;
+    st.last_timestamp_ms = timestamp_ms;
+    st.windows++;
+    st.anomalies += anomaly ? 1 : 0;
+
+    const float margin = score - g_bands[band].anomaly_threshold;
+    if (!g_report_valid || margin > g_report_margin) {
+        g_report = {band, features, score, anomaly, timestamp_ms};
+        g_report_margin = margin;
+        g_report_valid = true;
+    }
+    return anomaly;
+}
+
+const BandState* band_state(std::size_t index) {
+    return index < g_count ? &g_state[index] : nullptr;
+}
+
+bool band_plan_take_report(BandReport& out) {
+    if (!g_report_valid) {
+        return false;
+    }
+    out = g_report;
+    g_report_valid = false;
+    return true;
+}
+
+BandPlanStats band_plan_stats() {
+    BandPlanStats stats{};
+    stats.retunes = g_retunes.load(std::memory_order_relaxed);
+    stats.retune_failures = g_retune_failures.load(std::memory_order_relaxed);
+    stats.sweeps = g_sweeps.load(std::memory_order_relaxed);
+    return stats;
+}
@@ -6,8 +6,20 @@ NodeConfig load_config() {
     cfg.report_interval_ms = 1000;
     cfg.rf_center_freq_hz = 915000000;
     cfg.fft_size = 128;
+    cfg.adc_sample_rate_hz = 20000;
+    cfg.decimation = 1;
+    cfg.stft_hop_size = 0; // fft_size / 2
+    cfg.stft_window = 1; // Hann
+    cfg.watch_bins.fill(0);
+    cfg.watch_bin_count = 0;
     cfg.anomaly_threshold = 0.8f;
+    cfg.prescreen = {true, 6.0f, 3.0f, 4, 8};
+    cfg.bands.fill(BandConfig{});
+    cfg.band_count = 0;
+    cfg.retune_settle_us = 200;
     cfg.heartbeat_interval_ms = 10000;
+    cfg.mesh_schema_version = 2;
+    cfg.telemetry_keyframe_interval = 10;
     cfg.mesh_key.fill(0x11);
     return cfg;
 }
@@ -0,0 +1,168 @@
+#include "decimator.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+constexpr uint8_t kMaxCoeffFracBits = 14;
+constexpr double kMaxBoost = 4.0; // droop compensation cap (+12 dB)
+
+int16_t saturate16(int64_t v) {
+    return static_cast<int16_t>(std::clamp<int64_t>(v, INT16_MIN, INT16_MAX));
+}
+
+// |H_cic| at `f` cycles per CIC output sample.
+double cic_response(double f, unsigned r, unsigned order) {
+    constexpr double kPi = 3.14159265358979323846;
+    if (f <= 0.0 || r <= 1) {
+        return 1.0;
+    }
+    const double h = std::sin(kPi * f) / (r * std::sin(kPi * f / r));
+    return std::pow(std::fabs(h), order);
+}
+
+// Frequency-sampled inverse-CIC lowpass, Hamming-windowed, scaled by `gain`
+// (the residual CIC gain correction), then quantized to Q14 and split by phase.
+void design_fir(Decimator& dec, double gain) {
+    constexpr double kPi = 3.14159265358979323846;
+    constexpr std::size_t kGrid = 512;
+    // FIR x2: 80% of the output Nyquist. Without FIR decimation the CIC
+    // aliases near the output Nyquist anyway, so only the lower half is kept.
+    const double cutoff = dec.fir_factor == 2 ? 0.2 : 0.25;
+    const double center = (kDecimFirTaps - 1) / 2.0;
+    std::array<double, kDecimFirTaps> h{};
+    double dc = 0.0;
+    for (std::size_t n = 0; n < kDecimFirTaps; ++n) {
+        double acc = 0.0;
+        for (std::size_t g = 0; g < kGrid; ++g) {
+            const double f = (g + 0.5) * cutoff / kGrid;
+            const double boost = std::min(1.0 / cic_response(f, dec.cic_factor, dec.cic_order), kMaxBoost);
+            acc += std::cos(2.0 * kPi * f * (n - center)) * boost;
+        }
+        const double window = 0.54 - 0.46 * std::cos(2.0 * kPi * n / (kDecimFirTaps - 1));
+        h[n] = 2.0 * acc * cutoff / kGrid * window;
+        dc += h[n];
+    }
+    // Unity DC gain through CIC + shift + FIR. Drop fractional bits until the
+    // coefficient L1 norm keeps a full-scale int32 accumulation from overflowing.
+    double l1 = 0.0;
+    for (double c : h) {
+        l1 += std::fabs(c * gain / dc);
+    }
+    dec.coeff_shift = kMaxCoeffFracBits;
+    while (dec.coeff_shift > 8 && l1 * (1 << dec.coeff_shift) * 32768.0 >= 2147483647.0) {
+        --dec.coeff_shift;
+    }
+    const double scale = gain / dc * (1 << dec.coeff_shift);
+    const std::size_t phases = dec.fir_factor;
+    for (std::size_t p = 0; p < phases; ++p) {
+        for (std::size_t k = 0; k < dec.taps_per_phase; ++k) {
+            const double c = std::round(h[k * phases + p] * scale);
+            dec.coeffs[p][dec.taps_per_phase - 1 - k] = saturate16(static_cast<int64_t>(c));
+        }
+    }
+}
+
+// One CIC output (every cic_factor inputs) goes through the FIR commutator;
+// returns true with *out set when a full FIR block completes.
+bool fir_push(Decimator& dec, int16_t x, int16_t* out) {
+    // Within a block the newest sample feeds phase 0, the oldest phase D-1:
+    // branch p sees x[jD - p].
+    const std::size_t branch = dec.fir_factor - 1 - dec.fir_phase;
+    const std::size_t taps = dec.taps_per_phase;
+    dec.history[branch][dec.history_pos] = x;
+    dec.history[branch][dec.history_pos + taps] = x;
+    if (++dec.fir_phase < dec.fir_factor) {
+        return false;
+    }
+    dec.fir_phase = 0;
+    dec.history_pos = dec.history_pos + 1 == taps ? 0 : dec.history_pos + 1;
+
+    // history[p][pos .. pos + taps) runs oldest to newest. coeff_shift was
+    // chosen so the int32 sum cannot overflow (16x16 -> 32 multiply-adds).
+    int32_t acc = 0;
+    for (std::size_t p = 0; p < dec.fir_factor; ++p) {
+        const int16_t* h = dec.coeffs[p].data();
+        const int16_t* s = dec.history[p].data() + dec.history_pos;
+        for (std::size_t k = 0; k < taps; ++k) {
+            acc += static_cast<int32_t>(h[k]) * s[k];
+        }
+    }
+    *out = saturate16((static_cast<int64_t>(acc) + (1 << (dec.coeff_shift - 1))) >> dec.coeff_shift);
+    return true;
+}
+} // namespace
+
+bool decimator_init(Decimator& dec, uint16_t factor, uint8_t cic_order) {
+    if (factor == 0 || factor > 255 || cic_order == 0 || cic_order > kMaxCicOrder) {
+        return false;
+    }
+    Decimator d{};
+    d.factor = factor;
+    if (factor > 1) {
+        d.fir_factor = factor % 2 == 0 ? 2 : 1;
+        d.cic_factor = static_cast<uint16_t>(factor / d.fir_factor);
+        d.cic_order = d.cic_factor > 1 ? cic_order : 0;
+        // Smallest shift with 2^shift >= R^N; the residual R^N / 2^shift is
+        // folded into the FIR so the CIC output never exceeds input scale.
+        uint64_t gain = 1;
+        for (uint8_t i = 0; i < d.cic_order; ++i) {
+            gain *= d.cic_factor;
+        }
+        while ((uint64_t{1} << d.cic_shift) < gain) {
+            ++d.cic_shift;
+        }
+        if (d.cic_shift > 16) {
+            return false; // 16-bit input + growth must fit the uint32 registers
+        }
+        d.taps_per_phase = kDecimFirTaps / d.fir_factor;
+        design_fir(d, static_cast<double>(uint64_t{1} << d.cic_shift) / static_cast<double>(gain));
+    }
+    dec = d;
+    return true;
+}
+
+void decimator_reset(Decimator& dec) {
+    dec.integrators.fill(0);
+    dec.comb_delay.fill(0);
+    for (auto& h : dec.history) {
+        h.fill(0);
+    }
+    dec.history_pos = 0;
+    dec.cic_phase = 0;
+    dec.fir_phase = 0;
+}
+
+std::size_t decimator_process(Decimator& dec, const int16_t* in, std::size_t count, int16_t* out) {
+    if (in == nullptr || out == nullptr) {
+        return 0;
+    }
+    if (dec.factor <= 1) {
+        std::copy(in, in + count, out);
+        return count;
+    }
+    std::size_t written = 0;
+    const std::size_t order = dec.cic_order;
+    for (std::size_t i = 0; i < count; ++i) {
+        // Wrapping unsigned arithmetic: the combs undo any integrator overflow.
+        uint32_t v = static_cast<uint32_t>(static_cast<int32_t>(in[i]));
+        for (std::size_t s = 0; s < order; ++s) {
+            dec.integrators[s] += v;
+            v = dec.integrators[s];
+        }
+        if (++dec.cic_phase < dec.cic_factor) {
+            continue;
+        }
+        dec.cic_phase = 0;
+        for (std::size_t s = 0; s < order; ++s) {
+            const uint32_t prev = dec.comb_delay[s];
+            dec.comb_delay[s] = v;
+            v -= prev;
+        }
+        const int32_t cic = static_cast<int32_t>(v) >> dec.cic_shift;
+        if (fir_push(dec, saturate16(cic), &out[written])) {
+            ++written;
+        }
+    }
+    return written;
+}
@@ -0,0 +1,347 @@
+#include "dsp_kernels.hpp"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+
+#if defined(__GNUC__) && defined(__SSE2__)
+#define OL_DSP_X86 1
+#include <immintrin.h>
+#endif
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#define OL_DSP_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace {
+constexpr float kLn2 = 0.69314718056f;
+constexpr float kLog10E = 0.43429448190f;
+constexpr float kSqrt2 = 1.41421356237f;
+
+struct KernelSet {
+    DspIsa isa;
+    void (*mag_sq)(const float*, std::size_t, float*);
+    MagnitudeStats (*mag_stats)(const float*, std::size_t, float, float*);
+    void (*log10)(const float*, std::size_t, float*);
+};
+
+// ---- scalar ---------------------------------------------------------------
+
+float log10_scalar_one(float x) {
+    x = std::max(x, FLT_MIN);
+    uint32_t bits = 0;
+    std::memcpy(&bits, &x, sizeof(bits));
+    float e = static_cast<float>(static_cast<int32_t>(bits >> 23) - 127);
+    bits = (bits & 0x007FFFFFu) | 0x3F800000u;
+    float m = 0.0f;
+    std::memcpy(&m, &bits, sizeof(m));
+    if (m > kSqrt2) {
+        m *= 0.5f;
+        e += 1.0f;
+    }
+    // ln(m) = 2 atanh(t), t = (m-1)/(m+1), |t| <= 0.172 so four terms reach float precision.
+    const float t = (m - 1.0f) / (m + 1.0f);
+    const float t2 = t * t;
+    const float poly = 1.0f + t2 * (0.33333333f + t2 * (0.2f + t2 * 0.14285714f));
+    const float ln = e * kLn2 + 2.0f * t * poly;
+    return ln * kLog10E;
+}
+
+void mag_sq_scalar(const float* bins, std::size_t count, float* out) {
+    for (std::size_t k = 0; k < count; ++k) {
+        out[k] = bins[2 * k] * bins[2 * k] + bins[2 * k + 1] * bins[2 * k + 1];
+    }
+}
+
+MagnitudeStats mag_stats_scalar(const float* bins, std::size_t count, float scale, float* out) {
+    MagnitudeStats stats{0.0f, 0.0f};
+    for (std::size_t k = 0; k < count; ++k) {
+        const float m = std::sqrt(bins[2 * k] * bins[2 * k] + bins[2 * k + 1] * bins[2 * k + 1]) * scale;
+        out[k] = m;
+        stats.max = std::max(stats.max, m);
+        stats.sum += m;
+    }
+    return stats;
+}
+
+void log10_scalar(const float* in, std::size_t count, float* out) {
+    for (std::size_t i = 0; i < count; ++i) {
+        out[i] = log10_scalar_one(in[i]);
+    }
+}
+
+constexpr KernelSet kScalar{DspIsa::Scalar, mag_sq_scalar, mag_stats_scalar, log10_scalar};
+
+// ---- SSE2 / AVX2 ----------------------------------------------------------
+#ifdef OL_DSP_X86
+
+float hmax_128(__m128 v) {
+    v = _mm_max_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 0, 3, 2)));
+    v = _mm_max_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtss_f32(v);
+}
+
+float hsum_128(__m128 v) {
+    v = _mm_add_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 0, 3, 2)));
+    v = _mm_add_ps(v, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtss_f32(v);
+}
+
+// Four interleaved bins -> four |z|^2 in bin order.
+inline __m128 mag_sq_4(const float* p) {
+    const __m128 a = _mm_loadu_ps(p);
+    const __m128 b = _mm_loadu_ps(p + 4);
+    const __m128 a2 = _mm_mul_ps(a, a);
+    const __m128 b2 = _mm_mul_ps(b, b);
+    return _mm_add_ps(_mm_shuffle_ps(a2, b2, _MM_SHUFFLE(2, 0, 2, 0)),
+                      _mm_shuffle_ps(a2, b2, _MM_SHUFFLE(3, 1, 3, 1)));
+}
+
+void mag_sq_sse2(const float* bins, std::size_t count, float* out) {
+    std::size_t k = 0;
+    for (; k + 4 <= count; k += 4) {
+        _mm_storeu_ps(out + k, mag_sq_4(bins + 2 * k));
+    }
+    mag_sq_scalar(bins + 2 * k, count - k, out + k);
+}
+
+MagnitudeStats mag_stats_sse2(const float* bins, std::size_t count, float scale, float* out) {
+    const __m128 vscale = _mm_set1_ps(scale);
+    __m128 vmax = _mm_setzero_ps();
+    __m128 vsum = _mm_setzero_ps();
+    std::size_t k = 0;
+    for (; k + 4 <= count; k += 4) {
+        const __m128 m = _mm_mul_ps(_mm_sqrt_ps(mag_sq_4(bins + 2 * k)), vscale);
+        _mm_storeu_ps(out + k, m);
+        vmax = _mm_max_ps(vmax, m);
+        vsum = _mm_add_ps(vsum, m);
+    }
+    MagnitudeStats tail = mag_stats_scalar(bins + 2 * k, count - k, scale, out + k);
+    return {std::max(hmax_128(vmax), tail.max), hsum_128(vsum) + tail.sum};
+}
+
+inline __m128 log10_4(__m128 x) {
+    x = _mm_max_ps(x, _mm_set1_ps(FLT_MIN));
+    const __m128i bits = _mm_castps_si128(x);
+    __m128 e = _mm_cvtepi32_ps(_mm_sub_epi32(_mm_srli_epi32(bits, 23), _mm_set1_epi32(127)));
+    __m128 m = _mm_castsi128_ps(_mm_or_si128(_mm_and_si128(bits, _mm_set1_epi32(0x007FFFFF)),
+                                             _mm_set1_epi32(0x3F800000)));
+    const __m128 big = _mm_cmpgt_ps(m, _mm_set1_ps(kSqrt2));
+    m = _mm_or_ps(_mm_andnot_ps(big, m), _mm_and_ps(big, _mm_mul_ps(m, _mm_set1_ps(0.5f))));
+    e = _mm_add_ps(e, _mm_and_ps(big, _mm_set1_ps(1.0f)));
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 t = _mm_div_ps(_mm_sub_ps(m, one), _mm_add_ps(m, one));
+    const __m128 t2 = _mm_mul_ps(t, t);
+    __m128 poly = _mm_add_ps(_mm_set1_ps(0.2f), _mm_mul_ps(t2, _mm_set1_ps(0.14285714f)));
+    poly = _mm_add_ps(_mm_set1_ps(0.33333333f), _mm_mul_ps(t2, poly));
+    poly = _mm_add_ps(one, _mm_mul_ps(t2, poly));
+    const __m128 ln = _mm_add_ps(_mm_mul_ps(e, _mm_set1_ps(kLn2)),
+                                 _mm_mul_ps(_mm_mul_ps(_mm_set1_ps(2.0f), t), poly));
+    return _mm_mul_ps(ln, _mm_set1_ps(kLog10E));
+}
+
+void log10_sse2(const float* in, std::size_t count, float* out) {
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_ps(out + i, log10_4(_mm_loadu_ps(in + i)));
+    }
+    log10_scalar(in + i, count - i, out + i);
+}
+
+constexpr KernelSet kSse2{DspIsa::Sse2, mag_sq_sse2, mag_stats_sse2, log10_sse2};
+
+#define OL_AVX2 __attribute__((target("avx2")))
+
+// Eight interleaved bins -> eight |z|^2; the in-lane shuffle leaves 64-bit
+// pairs as [0 1 4 5 | 2 3 6 7], so one cross-lane permute restores bin order.
+OL_AVX2 inline __m256 mag_sq_8(const float* p) {
+    const __m256 a = _mm256_loadu_ps(p);
+    const __m256 b = _mm256_loadu_ps(p + 8);
+    const __m256 a2 = _mm256_mul_ps(a, a);
+    const __m256 b2 = _mm256_mul_ps(b, b);
+    const __m256 sum = _mm256_add_ps(_mm256_shuffle_ps(a2, b2, _MM_SHUFFLE(2, 0, 2, 0)),
+                                     _mm256_shuffle_ps(a2, b2, _MM_SHUFFLE(3, 1, 3, 1)));
+    return _mm256_castpd_ps(_mm256_permute4x64_pd(_mm256_castps_pd(sum), _MM_SHUFFLE(3, 1, 2, 0)));
+}
+
+OL_AVX2 void mag_sq_avx2(const float* bins, std::size_t count, float* out) {
+    std::size_t k = 0;
+    for (; k + 8 <= count; k += 8) {
+        _mm256_storeu_ps(out + k, mag_sq_8(bins + 2 * k));
+    }
+    mag_sq_sse2(bins + 2 * k, count - k, out + k);
+}
+
+OL_AVX2 MagnitudeStats mag_stats_avx2(const float* bins, std::size_t count, float scale, float* out) {
+    const __m256 vscale = _mm256_set1_ps(scale);
+    __m256 vmax = _mm256_setzero_ps();
+    __m256 vsum = _mm256_setzero_ps();
+    std::size_t k = 0;
+    for (; k + 8 <= count; k += 8) {
+        const __m256 m = _mm256_mul_ps(_mm256_sqrt_ps(mag_sq_8(bins + 2 * k)), vscale);
+        _mm256_storeu_ps(out + k, m);
+        vmax = _mm256_max_ps(vmax, m);
+        vsum = _mm256_add_ps(vsum, m);
+    }
+    const __m128 max4 = _mm_max_ps(_mm256_castps256_ps128(vmax), _mm256_extractf128_ps(vmax, 1));
+    const __m128 sum4 = _mm_add_ps(_mm256_castps256_ps128(vsum), _mm256_extractf128_ps(vsum, 1));
+    MagnitudeStats tail = mag_stats_sse2(bins + 2 * k, count - k, scale, out + k);
+    return {std::max(hmax_128(max4), tail.max), hsum_128(sum4) + tail.sum};
+}
+
+OL_AVX2 void log10_avx2(const float* in, std::size_t count, float* out) {
+    const __m256 one = _mm256_set1_ps(1.0f);
+    std::size_t i = 0;
+    for (; i + 8 <= count; i += 8) {
+        const __m256 x = _mm256_max_ps(_mm256_loadu_ps(in + i), _mm256_set1_ps(FLT_MIN));
+        const __m256i bits = _mm256_castps_si256(x);
+        __m256 e = _mm256_cvtepi32_ps(_mm256_sub_epi32(_mm256_srli_epi32(bits, 23), _mm256_set1_epi32(127)));
+        __m256 m = _mm256_castsi256_ps(_mm256_or_si256(_mm256_and_si256(bits, _mm256_set1_epi32(0x007FFFFF)),
+                                                       _mm256_set1_epi32(0x3F800000)));
+        const __m256 big = _mm256_cmp_ps(m, _mm256_set1_ps(kSqrt2), _CMP_GT_OQ);
+        m = _mm256_blendv_ps(m, _mm256_mul_ps(m, _mm256_set1_ps(0.5f)), big);
+        e = _mm256_add_ps(e, _mm256_and_ps(big, one));
+        const __m256 t = _mm256_div_ps(_mm256_sub_ps(m, one), _mm256_add_ps(m, one));
+        const __m256 t2 = _mm256_mul_ps(t, t);
+        __m256 poly = _mm256_add_ps(_mm256_set1_ps(0.2f), _mm256_mul_ps(t2, _mm256_set1_ps(0.14285714f)));
+        poly = _mm256_add_ps(_mm256_set1_ps(0.33333333f), _mm256_mul_ps(t2, poly));
+        poly = _mm256_add_ps(one, _mm256_mul_ps(t2, poly));
+        const __m256 ln = _mm256_add_ps(_mm256_mul_ps(e, _mm256_set1_ps(kLn2)),
+                                        _mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(2.0f), t), poly));
+        _mm256_storeu_ps(out + i, _mm256_mul_ps(ln, _mm256_set1_ps(kLog10E)));
+    }
+    log10_sse2(in + i, count - i, out + i);
+}
+
+constexpr KernelSet kAvx2{DspIsa::Avx2, mag_sq_avx2, mag_stats_avx2, log10_avx2};
+#endif // OL_DSP_X86
+
+// ---- NEON (AArch64) -------------------------------------------------------
+#ifdef OL_DSP_NEON
+
+void mag_sq_neon(const float* bins, std::size_t count, float* out) {
+    std::size_t k = 0;
+    for (; k + 4 <= count; k += 4) {
+        const float32x4x2_t z = vld2q_f32(bins + 2 * k); // de-interleaves re/im
+        vst1q_f32(out + k, vaddq_f32(vmulq_f32(z.val[0], z.val[0]), vmulq_f32(z.val[1], z.val[1])));
+    }
+    mag_sq_scalar(bins + 2 * k, count - k, out + k);
+}
+
+MagnitudeStats mag_stats_neon(const float* bins, std::size_t count, float scale, float* out) {
+    float32x4_t vmax = vdupq_n_f32(0.0f);
+    float32x4_t vsum = vdupq_n_f32(0.0f);
+    std::size_t k = 0;
+    for (; k + 4 <= count; k += 4) {
+        const float32x4x2_t z = vld2q_f32(bins + 2 * k);
+        const float32x4_t sq = vaddq_f32(vmulq_f32(z.val[0], z.val[0]), vmulq_f32(z.val[1], z.val[1]));
+        const float32x4_t m = vmulq_n_f32(vsqrtq_f32(sq), scale);
+        vst1q_f32(out + k, m);
+        vmax = vmaxq_f32(vmax, m);
+        vsum = vaddq_f32(vsum, m);
+    }
+    MagnitudeStats tail = mag_stats_scalar(bins + 2 * k, count - k, scale, out + k);
+    return {std::max(vmaxvq_f32(vmax), tail.max), vaddvq_f32(vsum) + tail.sum};
+}
+
+void log10_neon(const float* in, std::size_t count, float* out) {
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    std::size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        const float32x4_t x = vmaxq_f32(vld1q_f32(in + i), vdupq_n_f32(FLT_MIN));
+        const uint32x4_t bits = vreinterpretq_u32_f32(x);
+        float32x4_t e = vcvtq_f32_s32(vsubq_s32(vreinterpretq_s32_u32(vshrq_n_u32(bits, 23)), vdupq_n_s32(127)));
+        float32x4_t m = vreinterpretq_f32_u32(vorrq_u32(vandq_u32(bits, vdupq_n_u32(0x007FFFFF)),
+                                                        vdupq_n_u32(0x3F800000)));
+        const uint32x4_t big = vcgtq_f32(m, vdupq_n_f32(kSqrt2));
+        m = vbslq_f32(big, vmulq_n_f32(m, 0.5f), m);
+        e = vaddq_f32(e, vreinterpretq_f32_u32(vandq_u32(big, vreinterpretq_u32_f32(one))));
+        const float32x4_t t = vdivq_f32(vsubq_f32(m, one), vaddq_f32(m, one));
+        const float32x4_t t2 = vmulq_f32(t, t);
+        float32x4_t poly = vaddq_f32(vdupq_n_f32(0.2f), vmulq_n_f32(t2, 0.14285714f));
+        poly = vaddq_f32(vdupq_n_f32(0.33333333f), vmulq_f32(t2, poly));
+        poly = vaddq_f32(one, vmulq_f32(t2, poly));
+        const float32x4_t ln = vaddq_f32(vmulq_n_f32(e, kLn2), vmulq_f32(vmulq_n_f32(t, 2.0f), poly));
+        vst1q_f32(out + i, vmulq_n_f32(ln, kLog10E));
+    }
+    log10_scalar(in + i, count - i, out + i);
+}
+
+constexpr KernelSet kNeon{DspIsa::Neon, mag_sq_neon, mag_stats_neon, log10_neon};
+#endif // OL_DSP_NEON
+
+const KernelSet* kernels_for(DspIsa isa) {
+    switch (isa) {
+#ifdef OL_DSP_X86
+        case DspIsa::Avx2:
+            return __builtin_cpu_supports("avx2") ? &kAvx2 : nullptr;
+        case DspIsa::Sse2:
+            return &kSse2;
+#endif
+#ifdef OL_DSP_NEON
+        case DspIsa::Neon:
+            return &kNeon;
+#endif
+        case DspIsa::Scalar:
+            return &kScalar;
+        default:
+            return nullptr;
+    }
+}
+
+const KernelSet*& active() {
+    static const KernelSet* set = kernels_for(dsp_detect_isa());
+    return set;
+}
+} // namespace
+
+DspIsa dsp_detect_isa() {
+#if defined(OL_DSP_X86)
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("avx2") ? DspIsa::Avx2 : DspIsa::Sse2;
+#elif defined(OL_DSP_NEON)
+    return DspIsa::Neon;
+#else
+    return DspIsa::Scalar;
+#endif
+}
+
+DspIsa dsp_active_isa() {
+    return active()->isa;
+}
+
+bool dsp_select_isa(DspIsa isa) {
+    const KernelSet* set = kernels_for(isa);
+    if (set == nullptr) {
+        return false;
+    }
+    active() = set;
+    return true;
+}
+
+const char* dsp_isa_name(DspIsa isa) {
+    switch (isa) {
+        case DspIsa::Sse2: return "sse2";
+        case DspIsa::Avx2: return "avx2";
+        case DspIsa::Neon: return "neon";
+        case DspIsa::Scalar:
+        default: return "scalar";
+    }
+}
+
+void dsp_magnitude_squared(const std::complex<float>* bins, std::size_t count, float* out) {
+    active()->mag_sq(reinterpret_cast<const float*>(bins), count, out);
+}
+
+MagnitudeStats dsp_magnitude_stats(const std::complex<float>* bins, std::size_t count, float scale,
+                                   float* mags_out) {
+    return active()->mag_stats(reinterpret_cast<const float*>(bins), count, scale, mags_out);
+}
+
+void dsp_log10(const float* in, std::size_t count, float* out) {
+    active()->log10(in, count, out);
+}
+
+float dsp_log10(float x) {
+    return log10_scalar_one(x);
+}
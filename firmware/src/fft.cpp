@@ -0,0 +1,265 @@
+#include "fft.hpp"
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+namespace {
+uint8_t ilog2(std::size_t n) {
+    uint8_t bits = 0;
+    while ((static_cast<std::size_t>(1) << bits) < n) {
+        ++bits;
+    }
+    return bits;
+}
+} // namespace
+
+bool fft_is_pow2(std::size_t n) {
+    return n != 0 && (n & (n - 1)) == 0;
+}
+
+std::size_t fft_next_pow2(std::size_t n) {
+    std::size_t p = 1;
+    while (p < n) {
+        p <<= 1;
+    }
+    return p;
+}
+
+bool fft_plan_init(FftPlan& plan, std::size_t n) {
+    if (n < 2 || n > kMaxFftSize || !fft_is_pow2(n)) {
+        return false;
+    }
+    plan.size = n;
+    plan.log2_size = ilog2(n);
+
+    // Twiddles are computed in double once so every stage sees correctly rounded factors.
+    constexpr double kTwoPi = 6.283185307179586476925286766559;
+    plan.twiddles.resize(n / 2);
+    for (std::size_t k = 0; k < n / 2; ++k) {
+        const double angle = -kTwoPi * static_cast<double>(k) / static_cast<double>(n);
+        plan.twiddles[k] = {static_cast<float>(std::cos(angle)), static_cast<float>(std::sin(angle))};
+    }
+
+    plan.bitrev.resize(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        std::size_t rev = 0;
+        for (uint8_t b = 0; b < plan.log2_size; ++b) {
+            rev |= ((i >> b) & 1u) << (plan.log2_size - 1 - b);
+        }
+        plan.bitrev[i] = static_cast<uint16_t>(rev);
+    }
+    return true;
+}
+
+bool fft_complex(const FftPlan& plan, std::complex<float>* data, std::size_t n) {
+    if (data == nullptr || n > plan.size || !fft_is_pow2(n)) {
+        return false;
+    }
+    if (n == 1) {
+        return true;
+    }
+
+    const uint8_t shift = static_cast<uint8_t>(plan.log2_size - ilog2(n));
+    for (std::size_t i = 0; i < n; ++i) {
+        const std::size_t j = plan.bitrev[i] >> shift;
+        if (i < j) {
+            std::swap(data[i], data[j]);
+        }
+    }
+
+    // Butterflies use explicit real/imag arithmetic: std::complex multiply goes
+    // through the Annex G NaN path (__mulsc3) unless -ffast-math is set.
+    auto* buf = reinterpret_cast<float*>(data);
+    const auto* tw = reinterpret_cast<const float*>(plan.twiddles.data());
+    for (std::size_t len = 2; len <= n; len <<= 1) {
+        const std::size_t half = len / 2;
+        const std::size_t stride = plan.size / len;
+        for (std::size_t base = 0; base < n; base += len) {
+            for (std::size_t j = 0; j < half; ++j) {
+                const float wr = tw[2 * j * stride];
+                const float wi = tw[2 * j * stride + 1];
+                float* a = buf + 2 * (base + j);
+                float* b = buf + 2 * (base + j + half);
+                const float vr = b[0] * wr - b[1] * wi;
+                const float vi = b[0] * wi + b[1] * wr;
+                b[0] = a[0] - vr;
+                b[1] = a[1] - vi;
+                a[0] += vr;
+                a[1] += vi;
+            }
+        }
+    }
+    return true;
+}
+
+namespace {
+// Runs the n/2-point FFT on packed (even + i*odd) samples in `out` and expands
+// the result into the n/2 + 1 bins of the real-input spectrum.
+bool split_real_spectrum(const FftPlan& plan, std::complex<float>* out, std::size_t n) {
+    const std::size_t half = n / 2;
+    if (!fft_complex(plan, out, half)) {
+        return false;
+    }
+
+    // Split Z = FFT(even + i*odd) into X[k] = E[k] + W^k O[k] and its mirror
+    // X[n/2-k] = conj(E[k] - W^k O[k]), with E/O the even/odd sub-spectra.
+    auto* z = reinterpret_cast<float*>(out);
+    const auto* tw = reinterpret_cast<const float*>(plan.twiddles.data());
+    const std::size_t stride = plan.size / n;
+
+    const float z0r = z[0];
+    const float z0i = z[1];
+    z[0] = z0r + z0i;
+    z[1] = 0.0f;
+    z[2 * half] = z0r - z0i;
+    z[2 * half + 1] = 0.0f;
+
+    for (std::size_t k = 1; k <= half / 2; ++k) {
+        const std::size_t j = half - k;
+        const float ar = z[2 * k];
+        const float ai = z[2 * k + 1];
+        const float br = z[2 * j];
+        const float bi = z[2 * j + 1];
+
+        const float er = 0.5f * (ar + br);
+        const float ei = 0.5f * (ai - bi);
+        const float or_ = 0.5f * (ai + bi);
+        const float oi = -0.5f * (ar - br);
+
+        const float wr = tw[2 * k * stride];
+        const float wi = tw[2 * k * stride + 1];
+        const float tr = wr * or_ - wi * oi;
+        const float ti = wr * oi + wi * or_;
+
+        z[2 * k] = er + tr;
+        z[2 * k + 1] = ei + ti;
+        z[2 * j] = er - tr;
+        z[2 * j + 1] = -(ei - ti);
+    }
+    return true;
+}
+} // namespace
+
+bool fft_real(const FftPlan& plan, const int16_t* samples, std::size_t count, std::size_t n,
+              std::complex<float>* out) {
+    if (samples == nullptr || out == nullptr || n < 2 || n > plan.size || !fft_is_pow2(n) || count > n) {
+        return false;
+    }
+
+    const std::size_t half = n / 2;
+    for (std::size_t m = 0; m < half; ++m) {
+        const std::size_t i = 2 * m;
+        const float re = i < count ? static_cast<float>(samples[i]) : 0.0f;
+        const float im = i + 1 < count ? static_cast<float>(samples[i + 1]) : 0.0f;
+        out[m] = {re, im};
+    }
+    return split_real_spectrum(plan, out, n);
+}
+
+bool fft_real_windowed(const FftPlan& plan, const int16_t* samples, const float* window, std::size_t n,
+                       std::complex<float>* out) {
+    if (samples == nullptr || window == nullptr || out == nullptr || n < 2 || n > plan.size || !fft_is_pow2(n)) {
+        return false;
+    }
+
+    for (std::size_t m = 0; m < n / 2; ++m) {
+        out[m] = {static_cast<float>(samples[2 * m]) * window[2 * m],
+                  static_cast<float>(samples[2 * m + 1]) * window[2 * m + 1]};
+    }
+    return split_real_spectrum(plan, out, n);
+}
+
+bool fft_complex_batch(const FftPlan& plan, std::complex<float>* data, std::size_t n, std::size_t batch) {
+    if (data == nullptr || batch == 0 || n > plan.size || !fft_is_pow2(n)) {
+        return false;
+    }
+    if (n == 1) {
+        return true;
+    }
+
+    const uint8_t shift = static_cast<uint8_t>(plan.log2_size - ilog2(n));
+    for (std::size_t i = 0; i < n; ++i) {
+        const std::size_t j = plan.bitrev[i] >> shift;
+        if (i < j) {
+            std::swap_ranges(data + i * batch, data + (i + 1) * batch, data + j * batch);
+        }
+    }
+
+    // Same butterfly arithmetic as fft_complex, with the window loop innermost.
+    auto* buf = reinterpret_cast<float*>(data);
+    const auto* tw = reinterpret_cast<const float*>(plan.twiddles.data());
+    for (std::size_t len = 2; len <= n; len <<= 1) {
+        const std::size_t half = len / 2;
+        const std::size_t stride = plan.size / len;
+        for (std::size_t base = 0; base < n; base += len) {
+            for (std::size_t j = 0; j < half; ++j) {
+                const float wr = tw[2 * j * stride];
+                const float wi = tw[2 * j * stride + 1];
+                float* a = buf + 2 * (base + j) * batch;
+                float* b = buf + 2 * (base + j + half) * batch;
+                for (std::size_t w = 0; w < 2 * batch; w += 2) {
+                    const float vr = b[w] * wr - b[w + 1] * wi;
+                    const float vi = b[w] * wi + b[w + 1] * wr;
+                    b[w] = a[w] - vr;
+                    b[w + 1] = a[w + 1] - vi;
+                    a[w] += vr;
+                    a[w + 1] += vi;
+                }
+            }
+        }
+    }
+    return true;
+}
+
+bool fft_real_batch(const FftPlan& plan, std::complex<float>* data, std::size_t n, std::size_t batch) {
+    if (data == nullptr || batch == 0 || n < 2 || n > plan.size || !fft_is_pow2(n)) {
+        return false;
+    }
+    const std::size_t half = n / 2;
+    if (!fft_complex_batch(plan, data, half, batch)) {
+        return false;
+    }
+
+    // Same split as split_real_spectrum, applied row by row.
+    auto* z = reinterpret_cast<float*>(data);
+    const auto* tw = reinterpret_cast<const float*>(plan.twiddles.data());
+    const std::size_t stride = plan.size / n;
+
+    float* row0 = z;
+    float* row_half = z + 2 * half * batch;
+    for (std::size_t w = 0; w < 2 * batch; w += 2) {
+        const float z0r = row0[w];
+        const float z0i = row0[w + 1];
+        row0[w] = z0r + z0i;
+        row0[w + 1] = 0.0f;
+        row_half[w] = z0r - z0i;
+        row_half[w + 1] = 0.0f;
+    }
+
+    for (std::size_t k = 1; k <= half / 2; ++k) {
+        const float wr = tw[2 * k * stride];
+        const float wi = tw[2 * k * stride + 1];
+        float* zk = z + 2 * k * batch;
+        float* zj = z + 2 * (half - k) * batch;
+        for (std::size_t w = 0; w < 2 * batch; w += 2) {
+            const float ar = zk[w];
+            const float ai = zk[w + 1];
+            const float br = zj[w];
+            const float bi = zj[w + 1];
+
+            const float er = 0.5f * (ar + br);
+            const float ei = 0.5f * (ai - bi);
+            const float or_ = 0.5f * (ai + bi);
+            const float oi = -0.5f * (ar - br);
+
+            const float tr = wr * or_ - wi * oi;
+            const float ti = wr * oi + wi * or_;
+
+            zk[w] = er + tr;
+            zk[w + 1] = ei + ti;
+            zj[w] = er - tr;
+            zj[w + 1] = -(ei - ti);
+        }
+    }
+    return true;
+}
@@ -0,0 +1,237 @@
+#include "fft_q15.hpp"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <utility>
+
+namespace {
+// Largest component allowed before a butterfly: |a| + sqrt(2)|b| must stay below 2^15.
+constexpr int32_t kHeadroomLimit = 1 << 13;
+
+// log2(1 + i/32) in Q16, i = 0..32.
+constexpr int32_t kLog2Table[33] = {
+    0, 2909, 5732, 8473, 11136, 13727, 16248, 18704, 21098, 23433, 25711,
+    27936, 30109, 32234, 34312, 36346, 38336, 40286, 42196, 44068, 45904, 47705,
+    49472, 51207, 52911, 54584, 56229, 57845, 59434, 60997, 62534, 64047, 65536,
+};
+
+uint8_t ilog2(std::size_t n) {
+    uint8_t bits = 0;
+    while ((static_cast<std::size_t>(1) << bits) < n) {
+        ++bits;
+    }
+    return bits;
+}
+
+bool is_pow2(std::size_t n) {
+    return n != 0 && (n & (n - 1)) == 0;
+}
+
+// Index of the highest set bit; binary search since Cortex-M0+ has no CLZ.
+int msb_index(uint64_t x) {
+    int pos = 0;
+    for (int step = 32; step > 0; step >>= 1) {
+        if (x >> step) {
+            x >>= step;
+            pos += step;
+        }
+    }
+    return pos;
+}
+
+int32_t max_abs(const int16_t* data, std::size_t count) {
+    int32_t m = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        const int32_t v = data[i] < 0 ? -static_cast<int32_t>(data[i]) : data[i];
+        m = std::max(m, v);
+    }
+    return m;
+}
+
+// Right-shifts (with rounding) until every component is below kHeadroomLimit.
+int rescale_block(int16_t* data, std::size_t count) {
+    int32_t m = max_abs(data, count);
+    int shift = 0;
+    while (m >= kHeadroomLimit) {
+        m >>= 1;
+        ++shift;
+    }
+    if (shift > 0) {
+        const int32_t round = 1 << (shift - 1);
+        for (std::size_t i = 0; i < count; ++i) {
+            data[i] = static_cast<int16_t>((static_cast<int32_t>(data[i]) + round) >> shift);
+        }
+    }
+    return shift;
+}
+} // namespace
+
+bool fft_plan_init_q15(FftPlanQ15& plan, std::size_t n) {
+    if (n < 2 || n > 4096 || !is_pow2(n)) {
+        return false;
+    }
+    plan.size = n;
+    plan.log2_size = ilog2(n);
+
+    constexpr double kTwoPi = 6.283185307179586476925286766559;
+    plan.twiddles.resize(n);
+    for (std::size_t k = 0; k < n / 2; ++k) {
+        const double angle = -kTwoPi * static_cast<double>(k) / static_cast<double>(n);
+        const long re = std::lround(std::cos(angle) * 32768.0);
+        const long im = std::lround(std::sin(angle) * 32768.0);
+        plan.twiddles[2 * k] = static_cast<int16_t>(std::clamp(re, -32768L, 32767L));
+        plan.twiddles[2 * k + 1] = static_cast<int16_t>(std::clamp(im, -32768L, 32767L));
+    }
+
+    plan.bitrev.resize(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        std::size_t rev = 0;
+        for (uint8_t b = 0; b < plan.log2_size; ++b) {
+            rev |= ((i >> b) & 1u) << (plan.log2_size - 1 - b);
+        }
+        plan.bitrev[i] = static_cast<uint16_t>(rev);
+    }
+    return true;
+}
+
+bool fft_complex_q15(const FftPlanQ15& plan, int16_t* data, std::size_t n, int& exponent) {
+    if (data == nullptr || n > plan.size || !is_pow2(n)) {
+        return false;
+    }
+    if (n == 1) {
+        return true;
+    }
+
+    const uint8_t shift = static_cast<uint8_t>(plan.log2_size - ilog2(n));
+    for (std::size_t i = 0; i < n; ++i) {
+        const std::size_t j = plan.bitrev[i] >> shift;
+        if (i < j) {
+            std::swap(data[2 * i], data[2 * j]);
+            std::swap(data[2 * i + 1], data[2 * j + 1]);
+        }
+    }
+
+    const int16_t* tw = plan.twiddles.data();
+    for (std::size_t len = 2; len <= n; len <<= 1) {
+        exponent += rescale_block(data, 2 * n);
+        const std::size_t half = len / 2;
+        const std::size_t stride = plan.size / len;
+        for (std::size_t base = 0; base < n; base += len) {
+            for (std::size_t j = 0; j < half; ++j) {
+                const int32_t wr = tw[2 * j * stride];
+                const int32_t wi = tw[2 * j * stride + 1];
+                int16_t* a = data + 2 * (base + j);
+                int16_t* b = data + 2 * (base + j + half);
+                const int32_t vr = (b[0] * wr - b[1] * wi + (1 << 14)) >> 15;
+                const int32_t vi = (b[0] * wi + b[1] * wr + (1 << 14)) >> 15;
+                b[0] = static_cast<int16_t>(a[0] - vr);
+                b[1] = static_cast<int16_t>(a[1] - vi);
+                a[0] = static_cast<int16_t>(a[0] + vr);
+                a[1] = static_cast<int16_t>(a[1] + vi);
+            }
+        }
+    }
+    return true;
+}
+
+bool fft_real_q15(const FftPlanQ15& plan, const int16_t* samples, std::size_t count, std::size_t n,
+                  int16_t* out, int& exponent) {
+    if (samples == nullptr || out == nullptr || n < 2 || n > plan.size || !is_pow2(n) || count > n) {
+        return false;
+    }
+
+    const std::size_t half = n / 2;
+    for (std::size_t i = 0; i < n; ++i) {
+        out[i] = i < count ? samples[i] : 0;
+    }
+    out[n] = 0;
+    out[n + 1] = 0;
+
+    // Scale small inputs up into the headroom window so quiet bands keep precision.
+    exponent = 0;
+    int32_t m = max_abs(out, n);
+    if (m > 0) {
+        while (m < kHeadroomLimit / 2) {
+            m <<= 1;
+            --exponent;
+        }
+        if (exponent < 0) {
+            for (std::size_t i = 0; i < n; ++i) {
+                out[i] = static_cast<int16_t>(out[i] * (1 << -exponent));
+            }
+        }
+    }
+    exponent += rescale_block(out, n);
+
+    if (!fft_complex_q15(plan, out, half, exponent)) {
+        return false;
+    }
+    exponent += rescale_block(out, n);
+
+    // Same even/odd split as fft_real, computed on doubled values to keep the LSB.
+    const int16_t* tw = plan.twiddles.data();
+    const std::size_t stride = plan.size / n;
+
+    const int32_t z0r = out[0];
+    const int32_t z0i = out[1];
+    out[0] = static_cast<int16_t>(z0r + z0i);
+    out[1] = 0;
+    out[2 * half] = static_cast<int16_t>(z0r - z0i);
+    out[2 * half + 1] = 0;
+
+    for (std::size_t k = 1; k <= half / 2; ++k) {
+        const std::size_t j = half - k;
+        const int32_t ar = out[2 * k];
+        const int32_t ai = out[2 * k + 1];
+        const int32_t br = out[2 * j];
+        const int32_t bi = out[2 * j + 1];
+
+        const int32_t er2 = ar + br;
+        const int32_t ei2 = ai - bi;
+        const int32_t or2 = ai + bi;
+        const int32_t oi2 = br - ar;
+
+        const int32_t wr = tw[2 * k * stride];
+        const int32_t wi = tw[2 * k * stride + 1];
+        const int32_t tr2 = (or2 * wr - oi2 * wi + (1 << 14)) >> 15;
+        const int32_t ti2 = (oi2 * wr + or2 * wi + (1 << 14)) >> 15;
+
+        out[2 * k] = static_cast<int16_t>((er2 + tr2 + 1) >> 1);
+        out[2 * k + 1] = static_cast<int16_t>((ei2 + ti2 + 1) >> 1);
+        out[2 * j] = static_cast<int16_t>((er2 - tr2 + 1) >> 1);
+        out[2 * j + 1] = static_cast<int16_t>((ti2 - ei2 + 1) >> 1);
+    }
+    return true;
+}
+
+int32_t log2_q16(uint64_t x) {
+    if (x == 0) {
+        return INT32_MIN;
+    }
+    const int msb = msb_index(x);
+    const uint64_t mant = msb >= 31 ? (x >> (msb - 31)) : (x << (31 - msb));
+    const uint32_t frac = static_cast<uint32_t>(mant - (1ULL << 31)); // 31 fractional bits
+    const uint32_t idx = frac >> 26;
+    const int64_t rem = frac & ((1u << 26) - 1);
+    const int32_t lo = kLog2Table[idx];
+    const int32_t hi = kLog2Table[idx + 1];
+    return msb * 65536 + lo + static_cast<int32_t>(((hi - lo) * rem) >> 26);
+}
+
+uint32_t isqrt_u64(uint64_t x) {
+    uint64_t result = 0;
+    uint64_t bit = 1ULL << 62;
+    while (bit > x) {
+        bit >>= 2;
+    }
+    while (bit != 0) {
+        if (x >= result + bit) {
+            x -= result + bit;
+            result = (result >> 1) + bit;
+        } else {
+            result >>= 1;
+        }
+        bit >>= 2;
+    }
+    return static_cast<uint32_t>(result);
+}
@@ -0,0 +1,73 @@
+#include "goertzel.hpp"
+#include <algorithm>
+#include <cmath>
+
+bool goertzel_bank_init(GoertzelBank& bank, const uint16_t* bins, std::size_t count, std::size_t n) {
+    if (bins == nullptr || count == 0 || count > kMaxGoertzelBins || n < 2) {
+        return false;
+    }
+    for (std::size_t i = 0; i < count; ++i) {
+        if (bins[i] > n / 2) {
+            return false;
+        }
+    }
+
+    constexpr double kTwoPi = 6.283185307179586476925286766559;
+    bank.n = n;
+    bank.bin_count = count;
+    for (std::size_t i = 0; i < count; ++i) {
+        bank.bins[i] = bins[i];
+        bank.coeff[i] = static_cast<float>(2.0 * std::cos(kTwoPi * bins[i] / static_cast<double>(n)));
+    }
+    return true;
+}
+
+MagnitudeStats goertzel_bank_run(const GoertzelBank& bank, const int16_t* samples, std::size_t count, float scale,
+                                 float* mags_out) {
+    MagnitudeStats stats{0.0f, 0.0f};
+    if (samples == nullptr || mags_out == nullptr || bank.bin_count == 0) {
+        return stats;
+    }
+
+    // Samples outer, bins inner: one pass over the window and the per-bin
+    // state stays in registers/L1 instead of re-reading samples per bin.
+    std::array<float, kMaxGoertzelBins> s1{};
+    std::array<float, kMaxGoertzelBins> s2{};
+    const std::size_t nb = bank.bin_count;
+    // Bin loop rounded up to 4 lanes so it vectorizes; padding lanes are never read back.
+    const std::size_t lanes = (nb + 3) & ~static_cast<std::size_t>(3);
+    const std::size_t len = std::min(count, bank.n);
+    // DC and Nyquist have coeff = +/-2, where the recurrence is a double
+    // integrator and loses everything to float cancellation; those two bins
+    // come from exact integer sums instead.
+    int32_t dc = 0;
+    int32_t nyquist = 0;
+    for (std::size_t t = 0; t < len; ++t) {
+        dc += samples[t];
+        nyquist += (t & 1u) ? -samples[t] : samples[t];
+        const float x = static_cast<float>(samples[t]);
+        for (std::size_t b = 0; b < lanes; ++b) {
+            const float s0 = x + bank.coeff[b] * s1[b] - s2[b];
+            s2[b] = s1[b];
+            s1[b] = s0;
+        }
+    }
+    // Zero padding up to bank.n is not run: with no input the recurrence only
+    // rotates (s1, s2), which leaves the power below unchanged.
+
+    for (std::size_t b = 0; b < nb; ++b) {
+        float mag = 0.0f;
+        if (bank.bins[b] == 0) {
+            mag = std::fabs(static_cast<float>(dc)) * scale;
+        } else if (2 * static_cast<std::size_t>(bank.bins[b]) == bank.n) {
+            mag = std::fabs(static_cast<float>(nyquist)) * scale;
+        } else {
+            const float power = s1[b] * s1[b] + s2[b] * s2[b] - bank.coeff[b] * s1[b] * s2[b];
+            mag = std::sqrt(std::max(power, 0.0f)) * scale;
+        }
+        mags_out[b] = mag;
+        stats.max = std::max(stats.max, mag);
+        stats.sum += mag;
+    }
+    return stats;
+}
@@ -11,6 +11,7 @@ namespace {
 MeshRoutingPayload g_routing{};
 MeshSendHandler g_send_handler = nullptr;
 char g_self_id[kMaxNodeIdLength]{};
+uint16_t g_link_id = 0;
 uint32_t g_routing_version = 0;
 MeshMetrics g_metrics{};
 
@@ -22,6 +23,47 @@ struct SeenFrame {
 constexpr std::size_t kSeenWindow = 8;
 std::array<SeenFrame, kSeenWindow> g_seen{};
 
+// Last Telemetry keyframe per source, for rebuilding delta frames. The least
+// recently used entry makes room for a new source.
+struct KeyframeEntry {
+    char src[kMaxNodeIdLength];
+    uint32_t seq;
+    uint32_t last_use;
+    MeshSecurity security;
+    MeshCounters counters;
+    MeshTelemetryPayload telemetry;
+    FaultStatus fault;
+};
+
+constexpr std::size_t kKeyframeSources = 8;
+std::array<KeyframeEntry, kKeyframeSources> g_keyframes{};
+uint32_t g_keyframe_clock = 0;
+
+KeyframeEntry* find_keyframe(const char* src, std::size_t src_len) {
+    for (auto& e : g_keyframes) {
+        if (e.src[0] != '\0' && strnlen(e.src, sizeof(e.src)) == src_len && std::memcmp(e.src, src, src_len) == 0) {
+            return &e;
+        }
+    }
+    return nullptr;
+}
+
+void store_keyframe(const MeshFrame& frame) {
+    const std::size_t src_len = strnlen(frame.header.src_node_id, sizeof(frame.header.src_node_id));
+    KeyframeEntry* e = find_keyframe(frame.header.src_node_id, src_len);
+    if (e == nullptr) {
+        e = &*std::min_element(g_keyframes.begin(), g_keyframes.end(),
+                               [](const KeyframeEntry& a, const KeyframeEntry& b) { return a.last_use < b.last_use; });
+        std::snprintf(e->src, sizeof(e->src), "%s", frame.header.src_node_id);
+    }
+    e->seq = frame.header.seq_no;
+    e->last_use = ++g_keyframe_clock;
+    e->security = frame.security;
+    e->counters = frame.counters;
+    e->telemetry = frame.telemetry;
+    e->fault = frame.fault;
+}
+
 struct BlacklistEntry {
     char neighbor_id[kMaxNodeIdLength];
     uint8_t strikes;
@@ -37,27 +79,37 @@ void add_route_internal(const RouteEntry& entry) {
     g_routing.version = ++g_routing_version;
 }
 
-bool seen_before(const MeshFrame& frame) {
+// `src` need not be NUL-terminated, so views can pass text straight from the frame.
+bool seen_before(const char* src, std::size_t src_len, uint32_t seq) {
+    src_len = std::min(src_len, kMaxNodeIdLength - 1);
     for (auto& s : g_seen) {
         if (s.src[0] == '\0') {
-            std::snprintf(s.src, sizeof(s.src), "%s", frame.header.src_node_id);
-            s.seq = frame.header.seq_no;
+            std::snprintf(s.src, sizeof(s.src), "%.*s", static_cast<int>(src_len), src);
+            s.seq = seq;
             return false;
         }
-        if (std::strncmp(s.src, frame.header.src_node_id, sizeof(s.src)) == 0) {
-            if (frame.header.seq_no <= s.seq) {
+        if (strnlen(s.src, sizeof(s.src)) == src_len && std::memcmp(s.src, src, src_len) == 0) {
+            if (seq <= s.seq) {
                 return true;
             }
-            s.seq = frame.header.seq_no;
+            s.seq = seq;
             return false;
         }
     }
     // Overwrite oldest slot 0
-    std::snprintf(g_seen[0].src, sizeof(g_seen[0].src), "%s", frame.header.src_node_id);
-    g_seen[0].seq = frame.header.seq_no;
+    std::snprintf(g_seen[0].src, sizeof(g_seen[0].src), "%.*s", static_cast<int>(src_len), src);
+    g_seen[0].seq = seq;
     return false;
 }
 
+bool forward_allowed(uint32_t ttl, uint32_t hop_count, const char* src, std::size_t src_len, uint32_t seq) {
+    if (ttl == 0 || hop_count >= ttl) {
+        g_metrics.ttl_drops++;
+        return false;
+    }
+    return !seen_before(src, src_len, seq);
+}
+
 bool is_blacklisted_internal(const char* neighbor_id) {
     for (const auto& b : g_blacklist) {
         if (b.neighbor_id[0] == '\0') continue;
@@ -89,6 +141,17 @@ void prune_and_sort_routes() {
     });
     g_routing = filtered;
 }
+
+bool send_link_packet(const LinkPacket& packet) {
+    if (g_send_handler) {
+        return g_send_handler(packet);
+    }
+#ifdef ESP_PLATFORM
+    return radio_driver_send(packet);
+#else
+    return true;
+#endif
+}
 } // namespace
 
 void init_mesh() {
@@ -97,6 +160,7 @@ void init_mesh() {
     g_routing.epoch_ms = 0;
     g_routing_version = 0;
     std::memset(g_self_id, 0, sizeof(g_self_id));
+    g_link_id = mesh_link_id(g_self_id);
     for (auto& s : g_seen) {
         s.src[0] = '\0';
         s.seq = 0;
@@ -105,12 +169,15 @@ void init_mesh() {
         b.neighbor_id[0] = '\0';
         b.strikes = 0;
     }
+    g_keyframes = {};
+    g_keyframe_clock = 0;
     g_metrics = {};
 }
 
 void set_mesh_node_id(const char* node_id) {
     if (node_id) {
         std::snprintf(g_self_id, sizeof(g_self_id), "%s", node_id);
+        g_link_id = mesh_link_id(g_self_id);
     }
 }
 
@@ -118,46 +185,89 @@ void set_mesh_send_handler(MeshSendHandler handler) {
     g_send_handler = handler;
 }
 
-bool send_mesh_frame(const MeshFrame& frame) {
+bool seal_mesh_frame(const MeshFrame& frame, EncryptedFrame& out, const MeshFrame* keyframe) {
     AesGcmKey key{};
     key.bytes.fill(0x11); // placeholder; real key should be loaded from cfg
 
+    out.len = 0;
     if (frame.header.ttl == 0 || frame.header.hop_count >= frame.header.ttl) {
         g_metrics.ttl_drops++;
         return false;
     }
 
-    const EncryptedFrame encoded = encrypt_mesh_frame(frame, key);
-    // Simple fragmentation guard: drop if we exceed 3 fragments worth of a 200-byte MTU.
-    constexpr std::size_t kLinkMtu = 200;
-    const std::size_t needed_frags = (encoded.len + kLinkMtu - 1) / kLinkMtu;
-    if (needed_frags > 3) {
-        g_metrics.fragments_dropped++;
-        return false;
-    }
-    if (needed_frags > 1) {
-        g_metrics.fragments_sent += static_cast<uint32_t>(needed_frags);
-    }
+    encrypt_mesh_frame_into(frame, key, out, keyframe);
     std::printf(
-        "[MESH] seq=%u ttl=%u hop=%u type=%u len=%zu rf_peak=%.2f gps_valid=%d battery=%.2f routes=%zu\n",
+        "[MESH] seq=%u ref=%u ttl=%u hop=%u type=%u len=%zu rf_peak=%.2f gps_valid=%d battery=%.2f routes=%zu\n",
         static_cast<unsigned>(frame.header.seq_no),
+        static_cast<unsigned>(frame.header.ref_seq_no),
         frame.header.ttl,
         frame.header.hop_count,
         static_cast<uint8_t>(frame.header.msg_type),
-        encoded.len,
+        out.len,
         frame.telemetry.rf_event.features.peak_dbm,
         frame.telemetry.gps.valid_fix ? 1 : 0,
         frame.telemetry.health.battery_v,
         frame.routing.entry_count
     );
-    if (g_send_handler) {
-        return g_send_handler(encoded);
+    return out.len != 0;
+}
+
+bool receive_mesh_frame(const EncodedFrame& clear, MeshFrame& out) {
+    out = MeshFrame{};
+    MeshFrameView view;
+    if (!mesh_frame_view_open(clear.bytes.data(), clear.len, view)) {
+        return false;
+    }
+    uint32_t ref = 0;
+    if (mesh_frame_view_uint(view, MeshMapKey::Header, static_cast<uint8_t>(MeshHeaderKey::RefSeqNo), ref) &&
+        ref != 0) {
+        const char* src = nullptr;
+        std::size_t src_len = 0;
+        mesh_frame_view_text(view, MeshMapKey::Header, static_cast<uint8_t>(MeshHeaderKey::SrcNodeId), src, src_len);
+        KeyframeEntry* key = src != nullptr ? find_keyframe(src, src_len) : nullptr;
+        if (key == nullptr || key->seq != ref) {
+            g_metrics.delta_misses++;
+            return false;
+        }
+        key->last_use = ++g_keyframe_clock;
+        out.security = key->security;
+        out.counters = key->counters;
+        out.telemetry = key->telemetry;
+        out.fault = key->fault;
+    }
+    if (!decode_mesh_frame_clear(clear, out)) {
+        return false;
+    }
+    if (ref == 0 && out.header.msg_type == MeshMsgType::Telemetry) {
+        store_keyframe(out);
     }
-#ifdef ESP_PLATFORM
-    return radio_driver_send(encoded);
-#else
     return true;
-#endif
+}
+
+bool send_sealed_frame(const EncryptedFrame& encoded) {
+    const std::size_t needed_frags = mesh_fragment_count(encoded.len);
+    if (needed_frags == 0 || needed_frags > kMaxFragments) {
+        g_metrics.fragments_dropped++;
+        return false;
+    }
+    if (needed_frags > 1) {
+        g_metrics.fragments_sent += static_cast<uint32_t>(needed_frags);
+    }
+    // Fragments go out one link packet at a time. If one fails the caller
+    // retries the whole frame; the receiver ignores fragments it already holds.
+    LinkPacket packet;
+    for (std::size_t i = 0; i < needed_frags; ++i) {
+        mesh_fragment_build(encoded, g_link_id, i, packet);
+        if (!send_link_packet(packet)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool send_mesh_frame(const MeshFrame& frame) {
+    EncryptedFrame encoded;
+    return seal_mesh_frame(frame, encoded) && send_sealed_frame(encoded);
 }
 
 void add_route_entry(const RouteEntry& entry) {
@@ -254,17 +364,31 @@ bool is_route_blacklisted(const char* neighbor_id) {
 }
 
 bool should_forward_frame(MeshFrame& frame) {
-    if (frame.header.ttl == 0 || frame.header.hop_count >= frame.header.ttl) {
-        g_metrics.ttl_drops++;
-        return false;
-    }
-    if (seen_before(frame)) {
+    const std::size_t src_len = strnlen(frame.header.src_node_id, sizeof(frame.header.src_node_id));
+    if (!forward_allowed(frame.header.ttl, frame.header.hop_count, frame.header.src_node_id, src_len,
+                         frame.header.seq_no)) {
         return false;
     }
     frame.header.hop_count = static_cast<uint8_t>(frame.header.hop_count + 1);
     return true;
 }
 
+bool should_forward_view(MeshFrameView& view) {
+    const auto field = [](MeshHeaderKey key) { return static_cast<uint8_t>(key); };
+    uint32_t ttl = 0;
+    uint32_t hop_count = 0;
+    uint32_t seq = 0;
+    const char* src = nullptr;
+    std::size_t src_len = 0;
+    if (!mesh_frame_view_uint(view, MeshMapKey::Header, field(MeshHeaderKey::Ttl), ttl) ||
+        !mesh_frame_view_uint(view, MeshMapKey::Header, field(MeshHeaderKey::HopCount), hop_count) ||
+        !mesh_frame_view_uint(view, MeshMapKey::Header, field(MeshHeaderKey::SeqNo), seq) ||
+        !mesh_frame_view_text(view, MeshMapKey::Header, field(MeshHeaderKey::SrcNodeId), src, src_len)) {
+        return false;
+    }
+    return forward_allowed(ttl & 0xFF, hop_count & 0xFF, src, src_len, seq);
+}
+
 MeshMetrics mesh_metrics() {
     return g_metrics;
 }
@@ -1,28 +1,35 @@
 #include "mesh_encode.hpp"
 #include "crypto.hpp"
+#include "mesh_schema.hpp"
 #include <algorithm>
+#include <cmath>
 #include <cstring>
 #include <cstdio>
+#include <iterator>
+#include <utility>
 
 namespace {
-// Minimal CBOR writer/reader tailored to the mesh schema.
+// CBOR codec generated from the field tables in mesh_schema.hpp.
 constexpr uint8_t kMajorUInt = 0u;
+constexpr uint8_t kMajorNegInt = 1u;
 constexpr uint8_t kMajorBytes = 2u;
 constexpr uint8_t kMajorText = 3u;
 constexpr uint8_t kMajorArray = 4u;
 constexpr uint8_t kMajorMap = 5u;
 constexpr uint8_t kMajorSimple = 7u;
+constexpr uint8_t kHalfFloatHead = 0xF9; // major 7, ai 25
+constexpr uint8_t kFloat32Head = 0xF8;   // major 7, ai 24, then simple value 26
 
 bool nonce_is_zero(const MeshSecurity& sec) {
     return std::all_of(sec.nonce.begin(), sec.nonce.end(), [](uint8_t b) { return b == 0; });
 }
 
-void derive_nonce(const MeshFrame& frame, std::array<uint8_t, kNonceLength>& out) {
+void derive_nonce(const MeshFrameHeader& header, std::array<uint8_t, kNonceLength>& out) {
     // Deterministic nonce: seq_no || first bytes of src_node_id.
     out.fill(0);
-    std::memcpy(out.data(), &frame.header.seq_no, std::min(sizeof(frame.header.seq_no), out.size()));
-    for (std::size_t i = 0; i < std::min(out.size() - sizeof(frame.header.seq_no), sizeof(frame.header.src_node_id)); ++i) {
-        out[sizeof(frame.header.seq_no) + i] ^= static_cast<uint8_t>(frame.header.src_node_id[i]);
+    std::memcpy(out.data(), &header.seq_no, std::min(sizeof(header.seq_no), out.size()));
+    for (std::size_t i = 0; i < std::min(out.size() - sizeof(header.seq_no), sizeof(header.src_node_id)); ++i) {
+        out[sizeof(header.seq_no) + i] ^= static_cast<uint8_t>(header.src_node_id[i]);
     }
 }
 
@@ -56,500 +63,741 @@ bool check_replay_and_update(const MeshFrame& frame) {
     return true;
 }
 
-struct CborWriter {
-    std::array<uint8_t, kMaxMeshFrameLen>& buf;
-    std::size_t idx = 0;
-
-    bool write_type(uint8_t major, uint64_t val) {
-        uint8_t tmp[9]{};
-        std::size_t len = 1;
-        if (val < 24) {
-            tmp[0] = static_cast<uint8_t>((major << 5) | val);
-            len = 1;
-        } else if (val <= 0xFF) {
-            tmp[0] = static_cast<uint8_t>((major << 5) | 24);
-            tmp[1] = static_cast<uint8_t>(val);
-            len = 2;
-        } else if (val <= 0xFFFF) {
-            tmp[0] = static_cast<uint8_t>((major << 5) | 25);
-            tmp[1] = static_cast<uint8_t>((val >> 8) & 0xFF);
-            tmp[2] = static_cast<uint8_t>(val & 0xFF);
-            len = 3;
-        } else if (val <= 0xFFFFFFFF) {
-            tmp[0] = static_cast<uint8_t>((major << 5) | 26);
-            tmp[1] = static_cast<uint8_t>((val >> 24) & 0xFF);
-            tmp[2] = static_cast<uint8_t>((val >> 16) & 0xFF);
-            tmp[3] = static_cast<uint8_t>((val >> 8) & 0xFF);
-            tmp[4] = static_cast<uint8_t>(val & 0xFF);
-            len = 5;
-        } else {
-            return false;
+
+template <typename T>
+T load(const uint8_t* p) {
+    T v;
+    std::memcpy(&v, p, sizeof(T));
+    return v;
+}
+
+template <typename T>
+void store(uint8_t* p, T v) {
+    std::memcpy(p, &v, sizeof(T));
+}
+
+// IEEE-754 binary32 -> binary16, round to nearest even; overflow goes to infinity.
+uint16_t float_to_half(float value) {
+    const uint32_t x = load<uint32_t>(reinterpret_cast<const uint8_t*>(&value));
+    const uint16_t sign = static_cast<uint16_t>((x >> 16) & 0x8000u);
+    const uint32_t mag = x & 0x7FFFFFFFu;
+    if (mag >= 0x7F800000u) {
+        return static_cast<uint16_t>(sign | 0x7C00u | (mag > 0x7F800000u ? 0x200u : 0u));
+    }
+    if (mag >= 0x477FF000u) { // rounds past 65504
+        return static_cast<uint16_t>(sign | 0x7C00u);
+    }
+    uint32_t h = 0;
+    uint32_t rem = 0;
+    uint32_t halfway = 0;
+    if (mag < 0x38800000u) { // below 2^-14: half subnormal or zero
+        if (mag < 0x33000000u) {
+            return sign;
         }
-        if (idx + len > buf.size()) return false;
-        std::memcpy(buf.data() + idx, tmp, len);
-        idx += len;
-        return true;
+        const uint32_t mant = (mag & 0x7FFFFFu) | 0x800000u;
+        const uint32_t shift = 126u - (mag >> 23);
+        h = mant >> shift;
+        rem = mant & ((1u << shift) - 1u);
+        halfway = 1u << (shift - 1u);
+    } else {
+        h = (mag - 0x38000000u) >> 13; // rebias the exponent from 127 to 15
+        rem = mag & 0x1FFFu;
+        halfway = 0x1000u;
     }
-    bool write_uint(uint32_t v) { return write_type(kMajorUInt, v); }
-    bool write_bytes(const uint8_t* data, std::size_t len) {
-        if (!write_type(kMajorBytes, len)) return false;
-        if (idx + len > buf.size()) return false;
-        std::memcpy(buf.data() + idx, data, len);
-        idx += len;
-        return true;
+    if (rem > halfway || (rem == halfway && (h & 1u) != 0)) {
+        ++h; // a carry into the exponent is still the right encoding
     }
-    bool write_text(const char* data, std::size_t len) {
-        if (!write_type(kMajorText, len)) return false;
-        if (idx + len > buf.size()) return false;
-        std::memcpy(buf.data() + idx, data, len);
-        idx += len;
-        return true;
+    return static_cast<uint16_t>(sign | h);
+}
+
+float half_to_float(uint16_t h) {
+    const uint32_t sign = static_cast<uint32_t>(h & 0x8000u) << 16;
+    const uint32_t exp = (h >> 10) & 0x1Fu;
+    const uint32_t mant = h & 0x3FFu;
+    if (exp == 0) {
+        const float sub = static_cast<float>(mant) * 5.9604645e-8f; // mant * 2^-24
+        return sign != 0 ? -sub : sub;
     }
-    bool write_float(float v) {
-        if (!write_type(kMajorSimple, 26)) return false; // 32-bit float
-        if (idx + sizeof(float) > buf.size()) return false;
-        std::memcpy(buf.data() + idx, &v, sizeof(float));
-        idx += sizeof(float);
-        return true;
+    const uint32_t x = sign | (exp == 0x1Fu ? 0x7F800000u : (exp + 112u) << 23) | (mant << 13);
+    float out;
+    std::memcpy(&out, &x, sizeof(out));
+    return out;
+}
+
+// Scaled rows: round(value * scale), saturated to int32; NaN encodes as 0.
+int32_t scaled_to_int(float value, float scale) {
+    const double v = static_cast<double>(value) * static_cast<double>(scale);
+    if (!(v == v)) {
+        return 0;
     }
-    bool write_map_start(std::size_t count) { return write_type(kMajorMap, count); }
-    bool write_array_start(std::size_t count) { return write_type(kMajorArray, count); }
-};
+    const double clamped = std::min(std::max(v, -2147483648.0), 2147483647.0);
+    return static_cast<int32_t>(std::lround(clamped));
+}
 
-struct CborReader {
-    const uint8_t* data;
-    std::size_t len;
-    std::size_t idx = 0;
-
-    bool read_type(uint8_t& major, uint64_t& val) {
-        if (idx >= len) return false;
-        const uint8_t ib = data[idx++];
-        major = ib >> 5;
-        const uint8_t ai = ib & 0x1F;
-        if (ai < 24) {
-            val = ai;
-            return true;
-        }
-        if (ai == 24) {
-            if (idx >= len) return false;
-            val = data[idx++];
-            return true;
-        }
-        if (ai == 25) {
-            if (idx + 1 >= len) return false;
-            val = static_cast<uint64_t>(data[idx] << 8 | data[idx + 1]);
-            idx += 2;
-            return true;
-        }
-        if (ai == 26) {
-            if (idx + 3 >= len) return false;
-            val = (static_cast<uint64_t>(data[idx]) << 24) |
-                  (static_cast<uint64_t>(data[idx + 1]) << 16) |
-                  (static_cast<uint64_t>(data[idx + 2]) << 8) |
-                  static_cast<uint64_t>(data[idx + 3]);
-            idx += 4;
+float int_to_scaled(int64_t value, float scale) {
+    return static_cast<float>(static_cast<double>(value) / static_cast<double>(scale));
+}
+
+template <std::size_t N>
+constexpr bool has_routes(const CborFieldDesc (&fields)[N]) {
+    for (std::size_t i = 0; i < N; ++i) {
+        if (fields[i].kind == CborField::Routes) {
             return true;
         }
+    }
+    return false;
+}
+
+// ---- Encoder: schema rows expanded at compile time, no per-field bounds checks.
+
+// Shortest-form head; the caller guarantees 5 bytes of room.
+inline uint8_t* put_head(uint8_t* p, uint8_t major, uint32_t val) {
+    const uint8_t mt = static_cast<uint8_t>(major << 5);
+    if (val < 24) {
+        p[0] = static_cast<uint8_t>(mt | val);
+        return p + 1;
+    }
+    if (val <= 0xFF) {
+        p[0] = static_cast<uint8_t>(mt | 24);
+        p[1] = static_cast<uint8_t>(val);
+        return p + 2;
+    }
+    if (val <= 0xFFFF) {
+        p[0] = static_cast<uint8_t>(mt | 25);
+        p[1] = static_cast<uint8_t>(val >> 8);
+        p[2] = static_cast<uint8_t>(val);
+        return p + 3;
+    }
+    p[0] = static_cast<uint8_t>(mt | 26);
+    p[1] = static_cast<uint8_t>(val >> 24);
+    p[2] = static_cast<uint8_t>(val >> 16);
+    p[3] = static_cast<uint8_t>(val >> 8);
+    p[4] = static_cast<uint8_t>(val);
+    return p + 5;
+}
+
+// Signed int as major 0 (n >= 0) or major 1 (-1 - n).
+inline uint8_t* put_int(uint8_t* p, int32_t v) {
+    return v >= 0 ? put_head(p, kMajorUInt, static_cast<uint32_t>(v))
+                  : put_head(p, kMajorNegInt, static_cast<uint32_t>(-1 - static_cast<int64_t>(v)));
+}
+
+template <const auto& Fields>
+uint8_t* put_map_unchecked(uint8_t* p, const uint8_t* base);
+
+template <const auto& Fields, std::size_t I>
+bool row_omitted(const uint8_t* base) {
+    constexpr CborFieldDesc f = Fields[I];
+    if constexpr (!f.omit_zero) {
+        (void)base;
         return false;
+    } else if constexpr (f.kind == CborField::U8) {
+        return base[f.offset] == 0;
+    } else {
+        static_assert(f.kind == CborField::U32, "omit_zero applies to uint rows");
+        return load<uint32_t>(base + f.offset) == 0;
     }
-    bool read_uint(uint32_t& out) {
-        uint8_t major = 0; uint64_t val = 0;
-        if (!read_type(major, val)) return false;
-        if (major != kMajorUInt) return false;
-        out = static_cast<uint32_t>(val);
+}
+
+// Whether a row differs from the keyframe by more than its deadband. Route
+// arrays are not compared and always count as moved.
+template <const auto& Fields, std::size_t I>
+bool row_moved(const uint8_t* base, const uint8_t* ref) {
+    constexpr CborFieldDesc f = Fields[I];
+    const uint8_t* a = base + f.offset;
+    const uint8_t* b = ref + f.offset;
+    if constexpr (f.deadband < 0) {
+        (void)a;
+        (void)b;
+        return false;
+    } else if constexpr (f.kind == CborField::F32 || f.kind == CborField::F16 || f.kind == CborField::Scaled) {
+        return !(std::fabs(load<float>(a) - load<float>(b)) <= f.deadband);
+    } else if constexpr (f.kind == CborField::U8 || f.kind == CborField::I8) {
+        return *a != *b;
+    } else if constexpr (f.kind == CborField::U32) {
+        return load<uint32_t>(a) != load<uint32_t>(b);
+    } else if constexpr (f.kind == CborField::Bool) {
+        return load<bool>(a) != load<bool>(b);
+    } else if constexpr (f.kind == CborField::Text) {
+        return std::strncmp(reinterpret_cast<const char*>(a), reinterpret_cast<const char*>(b), f.size) != 0;
+    } else if constexpr (f.kind == CborField::Bytes) {
+        return std::memcmp(a, b, f.size) != 0;
+    } else if constexpr (f.kind == CborField::RouteCount) {
+        return load<std::size_t>(a) != load<std::size_t>(b);
+    } else {
+        static_assert(f.kind == CborField::Routes, "unhandled CborField");
         return true;
     }
-    bool read_bytes(uint8_t* out_buf, std::size_t max_len, std::size_t& out_len) {
-        uint8_t major = 0; uint64_t val = 0;
-        if (!read_type(major, val)) return false;
-        if (major != kMajorBytes) return false;
-        if (idx + val > len || val > max_len) return false;
-        std::memcpy(out_buf, data + idx, static_cast<std::size_t>(val));
-        out_len = static_cast<std::size_t>(val);
-        idx += val;
-        return true;
+}
+
+// Rows (bit I for Fields[I]) a delta map writes: the ones that moved plus,
+// when any did, its kDeltaWithMap rows. 0 leaves the map out.
+template <const auto& Fields, std::size_t... I>
+uint32_t delta_rows(const uint8_t* base, const uint8_t* ref, std::index_sequence<I...>) {
+    constexpr uint32_t kWithMap = (0u | ... | (Fields[I].deadband < 0 ? 1u << I : 0u));
+    const uint32_t moved = (0u | ... | (row_moved<Fields, I>(base, ref) ? 1u << I : 0u));
+    return moved != 0 ? moved | kWithMap : 0;
+}
+
+template <const auto& Fields, std::size_t I>
+uint8_t* put_row(uint8_t* p, const uint8_t* base) {
+    constexpr CborFieldDesc f = Fields[I];
+    *p++ = f.key;
+    const uint8_t* src = base + f.offset;
+    if constexpr (f.kind == CborField::U8 || f.kind == CborField::I8) {
+        return put_head(p, kMajorUInt, *src);
+    } else if constexpr (f.kind == CborField::U32) {
+        return put_head(p, kMajorUInt, load<uint32_t>(src));
+    } else if constexpr (f.kind == CborField::Bool) {
+        *p = load<bool>(src) ? 1 : 0;
+        return p + 1;
+    } else if constexpr (f.kind == CborField::F32) {
+        p = put_head(p, kMajorSimple, 26);
+        std::memcpy(p, src, sizeof(float));
+        return p + sizeof(float);
+    } else if constexpr (f.kind == CborField::F16) {
+        const uint16_t h = float_to_half(load<float>(src));
+        p[0] = kHalfFloatHead;
+        p[1] = static_cast<uint8_t>(h >> 8);
+        p[2] = static_cast<uint8_t>(h);
+        return p + 3;
+    } else if constexpr (f.kind == CborField::Scaled) {
+        static_assert(f.scale > 0, "Scaled rows need a scale");
+        return put_int(p, scaled_to_int(load<float>(src), f.scale));
+    } else if constexpr (f.kind == CborField::Text) {
+        const std::size_t len = strnlen(reinterpret_cast<const char*>(src), f.size);
+        p = put_head(p, kMajorText, static_cast<uint32_t>(len));
+        std::memcpy(p, src, len);
+        return p + len;
+    } else if constexpr (f.kind == CborField::Bytes) {
+        p = put_head(p, kMajorBytes, f.size);
+        std::memcpy(p, src, f.size);
+        return p + f.size;
+    } else if constexpr (f.kind == CborField::Routes) {
+        const auto& routing = *reinterpret_cast<const MeshRoutingPayload*>(base);
+        const std::size_t count = std::min(routing.entry_count, kMaxRoutes);
+        p = put_head(p, kMajorArray, static_cast<uint32_t>(count));
+        for (std::size_t i = 0; i < count; ++i) {
+            p = put_map_unchecked<kSchemaRouteEntry>(p, reinterpret_cast<const uint8_t*>(&routing.entries[i]));
+        }
+        return p;
+    } else {
+        static_assert(f.kind == CborField::RouteCount, "unhandled CborField");
+        return put_head(p, kMajorUInt, static_cast<uint32_t>(load<std::size_t>(src)));
     }
-    bool read_text(char* out_buf, std::size_t max_len) {
-        uint8_t major = 0; uint64_t val = 0;
-        if (!read_type(major, val)) return false;
-        if (major != kMajorText) return false;
-        if (idx + val > len || val >= max_len) return false;
-        std::memcpy(out_buf, data + idx, static_cast<std::size_t>(val));
-        out_buf[val] = '\0';
-        idx += val;
+}
+
+template <const auto& Fields, std::size_t... I>
+uint8_t* put_rows(uint8_t* p, const uint8_t* base, std::index_sequence<I...>) {
+    const std::size_t omitted = (std::size_t{0} + ... + (row_omitted<Fields, I>(base) ? 1u : 0u));
+    p = put_head(p, kMajorMap, static_cast<uint32_t>(sizeof...(I) - omitted));
+    (void)((row_omitted<Fields, I>(base) ? p : (p = put_row<Fields, I>(p, base))), ...);
+    return p;
+}
+
+template <const auto& Fields, std::size_t... I>
+uint8_t* put_delta_rows(uint8_t* p, const uint8_t* base, uint32_t rows, std::index_sequence<I...>) {
+    p = put_head(p, kMajorMap, (0u + ... + ((rows >> I) & 1u)));
+    (void)(((rows >> I) & 1u ? (p = put_row<Fields, I>(p, base)) : p), ...);
+    return p;
+}
+
+template <const auto& Fields>
+uint8_t* put_map_unchecked(uint8_t* p, const uint8_t* base) {
+    static_assert(cbor_keys_dense(Fields), "schema rows must be keyed 1..N in order");
+    return put_rows<Fields>(p, base, std::make_index_sequence<std::size(Fields)>{});
+}
+
+struct CborCursor {
+    uint8_t* p;
+    uint8_t* end;
+    uint32_t maps = 0; // top-level maps written
+};
+
+// Writes `key` and its map after one room check against the map's worst-case
+// size. A map that might not fit is staged first, so frames that do fit near
+// the end of the buffer still encode. With `ref` set, only the rows that moved
+// from it are written (delta_rows), and a map with none is skipped.
+template <const auto& Fields>
+bool put_map(CborCursor& c, MeshMapKey key, const void* src, const void* ref = nullptr) {
+    constexpr std::size_t kStageLen =
+        1 + cbor_map_max_len(Fields) + (has_routes(Fields) ? kMaxRoutes * kSchemaRouteEntryMaxLen : 0);
+    constexpr auto kRows = std::make_index_sequence<std::size(Fields)>{};
+    const auto* base = static_cast<const uint8_t*>(src);
+    const uint32_t rows = ref != nullptr ? delta_rows<Fields>(base, static_cast<const uint8_t*>(ref), kRows) : 0;
+    if (ref != nullptr && rows == 0) {
         return true;
     }
-    bool read_float(float& out) {
-        uint8_t major = 0; uint64_t val = 0;
-        if (!read_type(major, val)) return false;
-        if (major != kMajorSimple || val != 26) return false;
-        if (idx + sizeof(float) > len) return false;
-        std::memcpy(&out, data + idx, sizeof(float));
-        idx += sizeof(float);
-        return true;
+    const auto put = [base, ref, rows, kRows](uint8_t* p) {
+        return ref == nullptr ? put_map_unchecked<Fields>(p, base) : put_delta_rows<Fields>(p, base, rows, kRows);
+    };
+    ++c.maps;
+    std::size_t max_len = 1 + cbor_map_max_len(Fields);
+    if constexpr (has_routes(Fields)) {
+        max_len += std::min(static_cast<const MeshRoutingPayload*>(src)->entry_count, kMaxRoutes) *
+                   kSchemaRouteEntryMaxLen;
     }
-    bool read_array_len(std::size_t& out_len) {
-        uint8_t major = 0; uint64_t val = 0;
-        if (!read_type(major, val)) return false;
-        if (major != kMajorArray) return false;
-        out_len = static_cast<std::size_t>(val);
+    const std::size_t room = static_cast<std::size_t>(c.end - c.p);
+    if (max_len <= room) {
+        *c.p = static_cast<uint8_t>(key);
+        c.p = put(c.p + 1);
         return true;
     }
-    bool read_map_len(std::size_t& out_len) {
-        uint8_t major = 0; uint64_t val = 0;
-        if (!read_type(major, val)) return false;
-        if (major != kMajorMap) return false;
-        out_len = static_cast<std::size_t>(val);
-        return true;
+    uint8_t staged[kStageLen];
+    staged[0] = static_cast<uint8_t>(key);
+    const std::size_t len = static_cast<std::size_t>(put(staged + 1) - staged);
+    if (len > room) {
+        return false;
     }
-    bool skip_value();
-};
-
-bool CborReader::skip_value() {
-    uint8_t major = 0; uint64_t val = 0;
-    const std::size_t start = idx;
-    if (!read_type(major, val)) return false;
-    switch (major) {
-        case kMajorUInt:
-        case 1: // negative ints unused
-            return true;
-        case kMajorBytes:
-        case kMajorText:
-            if (idx + val > len) return false;
-            idx += val;
-            return true;
-        case kMajorArray:
-            for (std::size_t i = 0; i < val; ++i) {
-                if (!skip_value()) return false;
-            }
-            return true;
-        case kMajorMap:
-            for (std::size_t i = 0; i < val; ++i) {
-                if (!skip_value()) return false; // key
-                if (!skip_value()) return false; // value
-            }
-            return true;
-        case kMajorSimple:
-            if (val == 26) {
-                if (idx + sizeof(float) > len) return false;
-                idx += sizeof(float);
-                return true;
-            }
-            return false;
-        default:
-            idx = start;
-            return false;
-    }
-}
-
-bool encode_routing(CborWriter& w, const MeshRoutingPayload& r) {
-    if (!w.write_map_start(4)) return false;
-    if (!w.write_uint(1) || !w.write_uint(r.epoch_ms)) return false;
-    if (!w.write_uint(2) || !w.write_uint(r.version)) return false;
-    if (!w.write_uint(3)) return false;
-    if (!w.write_array_start(r.entry_count)) return false;
-    for (std::size_t i = 0; i < r.entry_count; ++i) {
-        const auto& e = r.entries[i];
-        if (!w.write_map_start(4)) return false;
-        if (!w.write_uint(1) || !w.write_text(e.neighbor_id, strnlen(e.neighbor_id, kMaxNodeIdLength))) return false;
-        if (!w.write_uint(2) || !w.write_uint(static_cast<uint32_t>(static_cast<int32_t>(e.rssi_dbm) & 0xFF))) return false;
-        if (!w.write_uint(3) || !w.write_uint(e.link_quality)) return false;
-        if (!w.write_uint(4) || !w.write_uint(e.cost)) return false;
-    }
-    if (!w.write_uint(4) || !w.write_uint(static_cast<uint32_t>(r.entry_count))) return false;
+    std::memcpy(c.p, staged, len);
+    c.p += len;
     return true;
 }
 
-bool decode_routing(CborReader& r, MeshRoutingPayload& out) {
-    std::size_t map_len = 0;
-    if (!r.read_map_len(map_len)) return false;
-    for (std::size_t i = 0; i < map_len; ++i) {
-        uint32_t key = 0;
-        if (!r.read_uint(key)) return false;
-        switch (key) {
-            case 1: r.read_uint(out.epoch_ms); break;
-            case 2: r.read_uint(out.version); break;
-            case 3: {
-                std::size_t arr_len = 0;
-                if (!r.read_array_len(arr_len)) return false;
-                out.entry_count = std::min<std::size_t>(arr_len, kMaxRoutes);
-                for (std::size_t j = 0; j < out.entry_count; ++j) {
-                    std::size_t ent_map = 0;
-                    if (!r.read_map_len(ent_map)) return false;
-                    for (std::size_t k = 0; k < ent_map; ++k) {
-                        uint32_t ent_key = 0;
-                        if (!r.read_uint(ent_key)) return false;
-                        switch (ent_key) {
-                            case 1: r.read_text(out.entries[j].neighbor_id, kMaxNodeIdLength); break;
-                            case 2: {
-                                uint32_t tmp = 0; r.read_uint(tmp);
-                                out.entries[j].rssi_dbm = static_cast<int8_t>(tmp & 0xFF);
-                                break;
-                            }
-                            case 3: { uint32_t tmp = 0; r.read_uint(tmp); out.entries[j].link_quality = static_cast<uint8_t>(tmp & 0xFF); break; }
-                            case 4: { uint32_t tmp = 0; r.read_uint(tmp); out.entries[j].cost = static_cast<uint8_t>(tmp & 0xFF); break; }
-                            default: r.skip_value(); break;
-                        }
-                    }
-                }
-                // Skip any remaining entries beyond capacity.
-                for (std::size_t j = out.entry_count; j < arr_len; ++j) {
-                    r.skip_value();
+// ---- Decoder: cursor passed by value so field stores cannot alias it; every
+// reader returns the advanced cursor, or nullptr on malformed input.
+
+// Reads a head of the expected major type (values up to 32 bits).
+inline const uint8_t* get_head(const uint8_t* p, const uint8_t* end, uint8_t major, uint32_t& val) {
+    if (p == end || *p >> 5 != major) return nullptr;
+    const uint8_t ai = *p++ & 0x1F;
+    if (ai < 24) {
+        val = ai;
+        return p;
+    }
+    if (ai == 24 && end - p >= 1) {
+        val = p[0];
+        return p + 1;
+    }
+    if (ai == 25 && end - p >= 2) {
+        val = static_cast<uint32_t>(p[0] << 8 | p[1]);
+        return p + 2;
+    }
+    if (ai == 26 && end - p >= 4) {
+        val = static_cast<uint32_t>(p[0]) << 24 | static_cast<uint32_t>(p[1]) << 16 |
+              static_cast<uint32_t>(p[2]) << 8 | p[3];
+        return p + 4;
+    }
+    return nullptr;
+}
+
+// Skips `items` consecutive values. Containers add their children to the
+// pending count instead of recursing, so skipping is one loop over the bytes.
+const uint8_t* skip_items(const uint8_t* p, const uint8_t* end, uint32_t items) {
+    while (items != 0) {
+        if (p == end) return nullptr;
+        const uint8_t initial = *p;
+        const uint8_t major = initial >> 5;
+        uint32_t val = 0;
+        p = get_head(p, end, major, val);
+        if (p == nullptr) return nullptr;
+        --items;
+        switch (major) {
+            case kMajorUInt:
+            case kMajorNegInt:
+                break;
+            case kMajorBytes:
+            case kMajorText:
+                if (val > static_cast<std::size_t>(end - p)) return nullptr;
+                p += val;
+                break;
+            case kMajorArray:
+            case kMajorMap: {
+                // Every child takes at least one byte, so a count beyond the
+                // remaining input is malformed; this also bounds `items`.
+                const uint32_t children = major == kMajorMap ? 2 * val : val;
+                if (val > static_cast<std::size_t>(end - p) || children > static_cast<std::size_t>(end - p)) {
+                    return nullptr;
                 }
+                items += children;
                 break;
             }
-            case 4: {
-                uint32_t cnt = 0; r.read_uint(cnt);
-                out.entry_count = std::min<std::size_t>(cnt, out.entry_count);
+            case kMajorSimple:
+                // Half-floats end with their head; float32 fields are simple(26) + 4 bytes.
+                if (initial == kHalfFloatHead) break;
+                if (initial != kFloat32Head || val != 26 || end - p < static_cast<std::ptrdiff_t>(sizeof(float))) {
+                    return nullptr;
+                }
+                p += sizeof(float);
                 break;
-            }
             default:
-                r.skip_value();
-                break;
+                return nullptr;
         }
     }
-    return true;
+    return p;
+}
+
+const uint8_t* skip_value(const uint8_t* p, const uint8_t* end) {
+    return skip_items(p, end, 1);
+}
+
+template <const auto& Fields>
+const uint8_t* get_map(const uint8_t* p, const uint8_t* end, uint8_t* base);
+
+template <const auto& Fields, std::size_t I>
+const uint8_t* get_row(const uint8_t* p, const uint8_t* end, uint8_t* base) {
+    constexpr CborFieldDesc f = Fields[I];
+    uint8_t* dst = base + f.offset;
+    uint32_t v = 0;
+    if constexpr (f.kind == CborField::F32) {
+        if (end - p < static_cast<std::ptrdiff_t>(2 + sizeof(float)) || p[0] != kFloat32Head || p[1] != 26) {
+            return nullptr;
+        }
+        std::memcpy(dst, p + 2, sizeof(float));
+        return p + 2 + sizeof(float);
+    } else if constexpr (f.kind == CborField::F16) {
+        if (end - p < 3 || p[0] != kHalfFloatHead) return nullptr;
+        store<float>(dst, half_to_float(static_cast<uint16_t>(p[1] << 8 | p[2])));
+        return p + 3;
+    } else if constexpr (f.kind == CborField::Scaled) {
+        if (p == end || *p >> 5 > kMajorNegInt) return nullptr;
+        const uint8_t major = *p >> 5;
+        p = get_head(p, end, major, v);
+        if (p == nullptr) return nullptr;
+        store<float>(dst, int_to_scaled(major == kMajorUInt ? int64_t{v} : -1 - int64_t{v}, f.scale));
+        return p;
+    } else if constexpr (f.kind == CborField::Text) {
+        p = get_head(p, end, kMajorText, v);
+        if (p == nullptr || v >= f.size || v > static_cast<std::size_t>(end - p)) return nullptr;
+        std::memcpy(dst, p, v);
+        dst[v] = '\0';
+        return p + v;
+    } else if constexpr (f.kind == CborField::Bytes) {
+        p = get_head(p, end, kMajorBytes, v);
+        if (p == nullptr || v > f.size || v > static_cast<std::size_t>(end - p)) return nullptr;
+        std::memcpy(dst, p, v);
+        return p + v;
+    } else if constexpr (f.kind == CborField::Routes) {
+        auto& routing = *reinterpret_cast<MeshRoutingPayload*>(base);
+        p = get_head(p, end, kMajorArray, v);
+        if (p == nullptr) return nullptr;
+        const std::size_t count = std::min<std::size_t>(v, kMaxRoutes);
+        routing.entry_count = count;
+        for (std::size_t i = 0; i < count && p != nullptr; ++i) {
+            p = get_map<kSchemaRouteEntry>(p, end, reinterpret_cast<uint8_t*>(&routing.entries[i]));
+        }
+        // Skip any remaining entries beyond capacity.
+        for (std::size_t i = count; i < v && p != nullptr; ++i) {
+            p = skip_value(p, end);
+        }
+        return p;
+    } else {
+        p = get_head(p, end, kMajorUInt, v);
+        if (p == nullptr) return nullptr;
+        if constexpr (f.kind == CborField::U8 || f.kind == CborField::I8) {
+            *dst = static_cast<uint8_t>(v & 0xFF);
+        } else if constexpr (f.kind == CborField::U32) {
+            store<uint32_t>(dst, v);
+        } else if constexpr (f.kind == CborField::Bool) {
+            store<bool>(dst, v != 0);
+        } else {
+            static_assert(f.kind == CborField::RouteCount, "unhandled CborField");
+            store<std::size_t>(dst, std::min<std::size_t>(v, load<std::size_t>(dst)));
+        }
+        return p;
+    }
+}
+
+// Frames from encode_mesh_frame list rows in key order, so the leading run of
+// in-order keys costs one byte compare each. `done` counts the entries read.
+template <const auto& Fields, std::size_t... I>
+const uint8_t* get_in_order(const uint8_t* p, const uint8_t* end, uint8_t* base, uint32_t count, uint32_t& done,
+                            std::index_sequence<I...>) {
+    (void)((done < count && p != end && *p == Fields[I].key &&
+            (++done, p = get_row<Fields, I>(p + 1, end, base)) != nullptr) &&
+           ...);
+    return p;
+}
+
+// Expands to a flat switch over the map's keys; unknown keys are skipped.
+template <const auto& Fields, std::size_t... I>
+const uint8_t* get_keyed(const uint8_t* p, const uint8_t* end, uint8_t* base, uint32_t key,
+                         std::index_sequence<I...>) {
+    const bool known = ((key == I + 1 && (p = get_row<Fields, I>(p, end, base), true)) || ...);
+    return known ? p : skip_value(p, end);
+}
+
+template <const auto& Fields>
+const uint8_t* get_map(const uint8_t* p, const uint8_t* end, uint8_t* base) {
+    static_assert(cbor_keys_dense(Fields), "schema rows must be keyed 1..N in order");
+    constexpr auto kRows = std::make_index_sequence<std::size(Fields)>{};
+    uint32_t count = 0;
+    p = get_head(p, end, kMajorMap, count);
+    if (p == nullptr) return nullptr;
+    uint32_t done = 0;
+    p = get_in_order<Fields>(p, end, base, count, done, kRows);
+    for (; done < count && p != nullptr; ++done) {
+        uint32_t key = 0;
+        p = get_head(p, end, kMajorUInt, key);
+        p = p != nullptr ? get_keyed<Fields>(p, end, base, key, kRows) : nullptr;
+    }
+    return p;
+}
+
+template <const auto& Fields, typename T>
+const uint8_t* get_map(const uint8_t* p, const uint8_t* end, T& out) {
+    return get_map<Fields>(p, end, reinterpret_cast<uint8_t*>(&out));
+}
+
+// Decodes the top-level map `map` into its member of `frame` using the
+// schema of `version`; unknown keys are skipped.
+const uint8_t* get_section(const uint8_t* p, const uint8_t* end, MeshMapKey map, uint8_t version, MeshFrame& frame) {
+    if (version == kMeshSchemaV2) {
+        switch (map) {
+            case MeshMapKey::Rf: return get_map<kSchemaRfV2>(p, end, frame.telemetry.rf_event);
+            case MeshMapKey::Gps: return get_map<kSchemaGpsV2>(p, end, frame.telemetry.gps);
+            case MeshMapKey::Health: return get_map<kSchemaHealthV2>(p, end, frame.telemetry.health);
+            default: break;
+        }
+    }
+    switch (map) {
+        case MeshMapKey::Header: return get_map<kSchemaHeader>(p, end, frame.header);
+        case MeshMapKey::Security: return get_map<kSchemaSecurity>(p, end, frame.security);
+        case MeshMapKey::Counters: return get_map<kSchemaCounters>(p, end, frame.counters);
+        case MeshMapKey::Rf: return get_map<kSchemaRf>(p, end, frame.telemetry.rf_event);
+        case MeshMapKey::Gps: return get_map<kSchemaGps>(p, end, frame.telemetry.gps);
+        case MeshMapKey::Health: return get_map<kSchemaHealth>(p, end, frame.telemetry.health);
+        case MeshMapKey::Routing: return get_map<kSchemaRouting>(p, end, frame.routing);
+        case MeshMapKey::Fault: return get_map<kSchemaFault>(p, end, frame.fault);
+        case MeshMapKey::Ota: return get_map<kSchemaOta>(p, end, frame.ota);
+    }
+    return skip_value(p, end);
+}
+
+template <const auto& Fields>
+float row_scale(uint8_t key) {
+    return key >= 1 && key <= std::size(Fields) ? Fields[key - 1].scale : 0.0f;
+}
+
+// Scale of a Scaled field, or 0 when the field is not one.
+float field_scale(MeshMapKey map, uint8_t version, uint8_t key) {
+    if (version != kMeshSchemaV2) return 0.0f;
+    switch (map) {
+        case MeshMapKey::Rf: return row_scale<kSchemaRfV2>(key);
+        case MeshMapKey::Gps: return row_scale<kSchemaGpsV2>(key);
+        case MeshMapKey::Health: return row_scale<kSchemaHealthV2>(key);
+        default: return 0.0f;
+    }
+}
+
+// Indexes the top-level maps after the header in one pass, once per view.
+// A malformed tail leaves those maps unindexed; the header stays usable.
+void view_index_tail(MeshFrameView& view) {
+    if (view.tail == 0) return;
+    const uint8_t* end = view.data + view.len;
+    const uint8_t* p = view.data + view.tail;
+    for (uint32_t i = 0; i < view.tail_count && p != nullptr; ++i) {
+        uint32_t key = 0;
+        p = get_head(p, end, kMajorUInt, key);
+        if (p == nullptr) break;
+        if (key < 16 && (view.layout & (1u << key)) != 0) {
+            view.maps[key] = static_cast<uint16_t>(p - view.data);
+        }
+        p = skip_value(p, end);
+    }
+    if (p == nullptr) {
+        std::fill(view.maps.begin() + 1 + static_cast<std::size_t>(MeshMapKey::Header), view.maps.end(), 0);
+    }
+    view.tail = 0;
+}
+
+// Value of field `key` in the view's map, or nullptr. Header fields were
+// located by mesh_frame_view_open; other maps are walked key by key.
+const uint8_t* view_field(MeshFrameView& view, MeshMapKey map, uint8_t key) {
+    if (view.data == nullptr) return nullptr;
+    if (map == MeshMapKey::Header) {
+        return key < view.header.size() && view.header[key] != 0 ? view.data + view.header[key] : nullptr;
+    }
+    if (!mesh_frame_view_has(view, map)) return nullptr;
+    const uint8_t* end = view.data + view.len;
+    uint32_t count = 0;
+    const uint8_t* p = get_head(view.data + view.maps[static_cast<std::size_t>(map)], end, kMajorMap, count);
+    for (uint32_t i = 0; i < count && p != nullptr; ++i) {
+        uint32_t k = 0;
+        p = get_head(p, end, kMajorUInt, k);
+        if (p != nullptr && k == key) return p;
+        p = p != nullptr ? skip_value(p, end) : nullptr;
+    }
+    return nullptr;
+}
+
+// Writes the CBOR body of `frame` into [p, end), with `security` in place of
+// frame.security so senders can fill in the nonce without copying the frame.
+// With `keyframe` set, every map after the header is written as a delta
+// against it. Returns the body length, or 0 if it does not fit.
+std::size_t encode_body(const MeshFrame& frame, const MeshSecurity& security, uint8_t* p, uint8_t* end,
+                        const MeshFrame* keyframe) {
+    static_assert(kMeshMapCount < 24, "top-level map head is a single byte");
+    uint8_t* const start = p;
+    CborCursor c{p + 1, end};
+    const uint16_t layout = mesh_layout(frame.header.msg_type);
+    const auto carries = [layout](MeshMapKey key) { return (layout & mesh_map_bit(key)) != 0; };
+    // The keyframe's copy of a member of `frame`, or nullptr for a full frame.
+    const auto ref = [&frame, keyframe](const auto& member) -> const void* {
+        if (keyframe == nullptr) return nullptr;
+        const auto offset = reinterpret_cast<const uint8_t*>(&member) - reinterpret_cast<const uint8_t*>(&frame);
+        return reinterpret_cast<const uint8_t*>(keyframe) + offset;
+    };
+    const bool v2 = frame.header.version == kMeshSchemaV2;
+    const MeshTelemetryPayload& t = frame.telemetry;
+    const bool ok =
+        put_map<kSchemaHeader>(c, MeshMapKey::Header, &frame.header) &&
+        put_map<kSchemaSecurity>(c, MeshMapKey::Security, &security, ref(frame.security)) &&
+        put_map<kSchemaCounters>(c, MeshMapKey::Counters, &frame.counters, ref(frame.counters)) &&
+        (!carries(MeshMapKey::Rf) ||
+         (v2 ? put_map<kSchemaRfV2>(c, MeshMapKey::Rf, &t.rf_event, ref(t.rf_event))
+             : put_map<kSchemaRf>(c, MeshMapKey::Rf, &t.rf_event, ref(t.rf_event)))) &&
+        (!carries(MeshMapKey::Gps) || (v2 ? put_map<kSchemaGpsV2>(c, MeshMapKey::Gps, &t.gps, ref(t.gps))
+                                          : put_map<kSchemaGps>(c, MeshMapKey::Gps, &t.gps, ref(t.gps)))) &&
+        (!carries(MeshMapKey::Health) ||
+         (v2 ? put_map<kSchemaHealthV2>(c, MeshMapKey::Health, &t.health, ref(t.health))
+             : put_map<kSchemaHealth>(c, MeshMapKey::Health, &t.health, ref(t.health)))) &&
+        (!carries(MeshMapKey::Routing) ||
+         put_map<kSchemaRouting>(c, MeshMapKey::Routing, &frame.routing, ref(frame.routing))) &&
+        (!carries(MeshMapKey::Fault) || put_map<kSchemaFault>(c, MeshMapKey::Fault, &frame.fault, ref(frame.fault))) &&
+        (!carries(MeshMapKey::Ota) || put_map<kSchemaOta>(c, MeshMapKey::Ota, &frame.ota, ref(frame.ota)));
+    if (!ok || start == end) return 0;
+    put_head(start, kMajorMap, c.maps);
+    return static_cast<std::size_t>(c.p - start);
 }
 } // namespace
 
 EncodedFrame encode_mesh_frame(const MeshFrame& frame) {
     EncodedFrame out{};
-    CborWriter w{out.bytes};
-
-    // Top-level map keys: 1=header,2=security,3=counters,4=rf,5=gps,6=health,7=routing,8=fault,9=ota
-    if (!w.write_map_start(9)) return out;
-
-    // Header
-    if (!w.write_uint(1) || !w.write_map_start(7)) return out;
-    if (!w.write_uint(1) || !w.write_uint(frame.header.version)) return out;
-    if (!w.write_uint(2) || !w.write_uint(static_cast<uint8_t>(frame.header.msg_type))) return out;
-    if (!w.write_uint(3) || !w.write_uint(frame.header.ttl)) return out;
-    if (!w.write_uint(4) || !w.write_uint(frame.header.hop_count)) return out;
-    if (!w.write_uint(5) || !w.write_uint(frame.header.seq_no)) return out;
-    if (!w.write_uint(6) || !w.write_text(frame.header.src_node_id, strnlen(frame.header.src_node_id, kMaxNodeIdLength))) return out;
-    if (!w.write_uint(7) || !w.write_text(frame.header.dest_node_id, strnlen(frame.header.dest_node_id, kMaxNodeIdLength))) return out;
-
-    // Security
-    if (!w.write_uint(2) || !w.write_map_start(3)) return out;
-    if (!w.write_uint(1) || !w.write_uint(frame.security.encrypted ? 1 : 0)) return out;
-    if (!w.write_uint(2) || !w.write_bytes(frame.security.nonce.data(), frame.security.nonce.size())) return out;
-    if (!w.write_uint(3) || !w.write_bytes(frame.security.auth_tag.data(), frame.security.auth_tag.size())) return out;
-
-    // Counters
-    if (!w.write_uint(3) || !w.write_map_start(2)) return out;
-    if (!w.write_uint(1) || !w.write_uint(frame.counters.tx_counter)) return out;
-    if (!w.write_uint(2) || !w.write_uint(frame.counters.replay_window)) return out;
-
-    // RF
-    if (!w.write_uint(4) || !w.write_map_start(6)) return out;
-    if (!w.write_uint(1) || !w.write_uint(frame.telemetry.rf_event.timestamp_ms)) return out;
-    if (!w.write_uint(2) || !w.write_uint(frame.telemetry.rf_event.center_freq_hz)) return out;
-    if (!w.write_uint(3) || !w.write_float(frame.telemetry.rf_event.features.avg_dbm)) return out;
-    if (!w.write_uint(4) || !w.write_float(frame.telemetry.rf_event.features.peak_dbm)) return out;
-    if (!w.write_uint(5) || !w.write_float(frame.telemetry.rf_event.anomaly_score)) return out;
-    if (!w.write_uint(6) || !w.write_uint(frame.telemetry.rf_event.model_version)) return out;
-
-    // GPS
-    if (!w.write_uint(5) || !w.write_map_start(10)) return out;
-    if (!w.write_uint(1) || !w.write_uint(frame.telemetry.gps.timestamp_ms)) return out;
-    if (!w.write_uint(2) || !w.write_float(frame.telemetry.gps.latitude_deg)) return out;
-    if (!w.write_uint(3) || !w.write_float(frame.telemetry.gps.longitude_deg)) return out;
-    if (!w.write_uint(4) || !w.write_float(frame.telemetry.gps.altitude_m)) return out;
-    if (!w.write_uint(5) || !w.write_uint(frame.telemetry.gps.num_sats)) return out;
-    if (!w.write_uint(6) || !w.write_float(frame.telemetry.gps.hdop)) return out;
-    if (!w.write_uint(7) || !w.write_uint(frame.telemetry.gps.valid_fix ? 1 : 0)) return out;
-    if (!w.write_uint(8) || !w.write_uint(frame.telemetry.gps.jamming_detected ? 1 : 0)) return out;
-    if (!w.write_uint(9) || !w.write_uint(frame.telemetry.gps.spoof_detected ? 1 : 0)) return out;
-    if (!w.write_uint(10) || !w.write_float(frame.telemetry.gps.cn0_db_hz_avg)) return out;
-
-    // Health
-    if (!w.write_uint(6) || !w.write_map_start(5)) return out;
-    if (!w.write_uint(1) || !w.write_uint(frame.telemetry.health.timestamp_ms)) return out;
-    if (!w.write_uint(2) || !w.write_float(frame.telemetry.health.battery_v)) return out;
-    if (!w.write_uint(3) || !w.write_float(frame.telemetry.health.temp_c)) return out;
-    if (!w.write_uint(4) || !w.write_float(frame.telemetry.health.imu_tilt_deg)) return out;
-    if (!w.write_uint(5) || !w.write_uint(frame.telemetry.health.tamper_flag ? 1 : 0)) return out;
-
-    // Routing
-    if (!w.write_uint(7)) return out;
-    if (!encode_routing(w, frame.routing)) return out;
-
-    // Fault
-    if (!w.write_uint(8) || !w.write_map_start(4)) return out;
-    if (!w.write_uint(1) || !w.write_uint(frame.fault.fault_active ? 1 : 0)) return out;
-    if (!w.write_uint(2) || !w.write_uint(frame.fault.counters.watchdog_resets)) return out;
-    if (!w.write_uint(3) || !w.write_uint(frame.fault.counters.ota_failures)) return out;
-    if (!w.write_uint(4) || !w.write_uint(frame.fault.counters.tamper_events)) return out;
-
-    // OTA
-    if (!w.write_uint(9) || !w.write_map_start(4)) return out;
-    if (!w.write_uint(1) || !w.write_uint(static_cast<uint8_t>(frame.ota.state))) return out;
-    if (!w.write_uint(2) || !w.write_uint(frame.ota.current_offset)) return out;
-    if (!w.write_uint(3) || !w.write_uint(frame.ota.total_size)) return out;
-    if (!w.write_uint(4) || !w.write_uint(frame.ota.signature_valid ? 1 : 0)) return out;
-
-    out.len = w.idx;
+    out.len = encode_body(frame, frame.security, out.bytes.data(), out.bytes.data() + out.bytes.size(), nullptr);
     return out;
 }
 
-static bool decode_mesh_frame_clear(const EncodedFrame& enc, MeshFrame& frame) {
-    CborReader r{enc.bytes.data(), enc.len};
-    std::size_t top_len = 0;
-    if (!r.read_map_len(top_len)) return false;
-    for (std::size_t i = 0; i < top_len; ++i) {
+EncodedFrame encode_mesh_delta(const MeshFrame& frame, const MeshFrame& keyframe) {
+    EncodedFrame out{};
+    out.len = encode_body(frame, frame.security, out.bytes.data(), out.bytes.data() + out.bytes.size(), &keyframe);
+    return out;
+}
+
+bool decode_mesh_frame_clear(const EncodedFrame& enc, MeshFrame& frame) {
+    if (enc.len > enc.bytes.size()) return false;
+    const uint8_t* p = enc.bytes.data();
+    const uint8_t* end = p + enc.len;
+    uint32_t count = 0;
+    p = get_head(p, end, kMajorMap, count);
+    // The header leads every frame; its msg_type selects which maps are read
+    // and its version the schema they are read with.
+    if (p == nullptr || count == 0 || p == end || *p != static_cast<uint8_t>(MeshMapKey::Header)) return false;
+    p = get_map<kSchemaHeader>(p + 1, end, frame.header);
+    const uint16_t layout =
+        p != nullptr ? static_cast<uint16_t>(mesh_layout(frame.header.msg_type) & ~mesh_map_bit(MeshMapKey::Header)) : 0;
+    for (uint32_t i = 1; i < count && p != nullptr; ++i) {
         uint32_t key = 0;
-        if (!r.read_uint(key)) return false;
-        switch (key) {
-            case 1: { // header
-                std::size_t mlen = 0;
-                if (!r.read_map_len(mlen)) return false;
-                for (std::size_t j = 0; j < mlen; ++j) {
-                    uint32_t hk = 0; r.read_uint(hk);
-                    switch (hk) {
-                        case 1: { uint32_t v = 0; r.read_uint(v); frame.header.version = static_cast<uint8_t>(v & 0xFF); break; }
-                        case 2: { uint32_t mt = 0; r.read_uint(mt); frame.header.msg_type = static_cast<MeshMsgType>(mt); break; }
-                        case 3: { uint32_t v = 0; r.read_uint(v); frame.header.ttl = static_cast<uint8_t>(v & 0xFF); break; }
-                        case 4: { uint32_t v = 0; r.read_uint(v); frame.header.hop_count = static_cast<uint8_t>(v & 0xFF); break; }
-                        case 5: r.read_uint(frame.header.seq_no); break;
-                        case 6: r.read_text(frame.header.src_node_id, kMaxNodeIdLength); break;
-                        case 7: r.read_text(frame.header.dest_node_id, kMaxNodeIdLength); break;
-                        default: r.skip_value(); break;
-                    }
-                }
-                break;
-            }
-            case 2: { // security
-                std::size_t mlen = 0;
-                if (!r.read_map_len(mlen)) return false;
-                for (std::size_t j = 0; j < mlen; ++j) {
-                    uint32_t sk = 0; r.read_uint(sk);
-                    switch (sk) {
-                        case 1: { uint32_t encf = 0; r.read_uint(encf); frame.security.encrypted = encf != 0; break; }
-                        case 2: {
-                            std::size_t l = 0;
-                            if (!r.read_bytes(frame.security.nonce.data(), frame.security.nonce.size(), l)) return false;
-                            break;
-                        }
-                        case 3: {
-                            std::size_t l = 0;
-                            if (!r.read_bytes(frame.security.auth_tag.data(), frame.security.auth_tag.size(), l)) return false;
-                            break;
-                        }
-                        default: r.skip_value(); break;
-                    }
-                }
-                break;
-            }
-            case 3: { // counters
-                std::size_t mlen = 0;
-                if (!r.read_map_len(mlen)) return false;
-                for (std::size_t j = 0; j < mlen; ++j) {
-                    uint32_t ck = 0; r.read_uint(ck);
-                    switch (ck) {
-                        case 1: r.read_uint(frame.counters.tx_counter); break;
-                        case 2: r.read_uint(frame.counters.replay_window); break;
-                        default: r.skip_value(); break;
-                    }
-                }
-                break;
-            }
-            case 4: { // rf
-                std::size_t mlen = 0;
-                if (!r.read_map_len(mlen)) return false;
-                for (std::size_t j = 0; j < mlen; ++j) {
-                    uint32_t rk = 0; r.read_uint(rk);
-                    switch (rk) {
-                        case 1: r.read_uint(frame.telemetry.rf_event.timestamp_ms); break;
-                        case 2: r.read_uint(frame.telemetry.rf_event.center_freq_hz); break;
-                        case 3: r.read_float(frame.telemetry.rf_event.features.avg_dbm); break;
-                        case 4: r.read_float(frame.telemetry.rf_event.features.peak_dbm); break;
-                        case 5: r.read_float(frame.telemetry.rf_event.anomaly_score); break;
-                        case 6: { uint32_t mv = 0; r.read_uint(mv); frame.telemetry.rf_event.model_version = static_cast<uint8_t>(mv); break; }
-                        default: r.skip_value(); break;
-                    }
-                }
-                break;
-            }
-            case 5: { // gps
-                std::size_t mlen = 0;
-                if (!r.read_map_len(mlen)) return false;
-                for (std::size_t j = 0; j < mlen; ++j) {
-                    uint32_t gk = 0; r.read_uint(gk);
-                    switch (gk) {
-                        case 1: r.read_uint(frame.telemetry.gps.timestamp_ms); break;
-                        case 2: r.read_float(frame.telemetry.gps.latitude_deg); break;
-                        case 3: r.read_float(frame.telemetry.gps.longitude_deg); break;
-                        case 4: r.read_float(frame.telemetry.gps.altitude_m); break;
-                        case 5: { uint32_t ns = 0; r.read_uint(ns); frame.telemetry.gps.num_sats = static_cast<uint8_t>(ns); break; }
-                        case 6: r.read_float(frame.telemetry.gps.hdop); break;
-                        case 7: { uint32_t vf = 0; r.read_uint(vf); frame.telemetry.gps.valid_fix = vf != 0; break; }
-                        case 8: { uint32_t jm = 0; r.read_uint(jm); frame.telemetry.gps.jamming_detected = jm != 0; break; }
-                        case 9: { uint32_t sp = 0; r.read_uint(sp); frame.telemetry.gps.spoof_detected = sp != 0; break; }
-                        case 10: r.read_float(frame.telemetry.gps.cn0_db_hz_avg); break;
-                        default: r.skip_value(); break;
-                    }
-                }
-                break;
-            }
-            case 6: { // health
-                std::size_t mlen = 0;
-                if (!r.read_map_len(mlen)) return false;
-                for (std::size_t j = 0; j < mlen; ++j) {
-                    uint32_t hk = 0; r.read_uint(hk);
-                    switch (hk) {
-                        case 1: r.read_uint(frame.telemetry.health.timestamp_ms); break;
-                        case 2: r.read_float(frame.telemetry.health.battery_v); break;
-                        case 3: r.read_float(frame.telemetry.health.temp_c); break;
-                        case 4: r.read_float(frame.telemetry.health.imu_tilt_deg); break;
-                        case 5: { uint32_t tf = 0; r.read_uint(tf); frame.telemetry.health.tamper_flag = tf != 0; break; }
-                        default: r.skip_value(); break;
-                    }
-                }
-                break;
-            }
-            case 7: // routing
-                if (!decode_routing(r, frame.routing)) return false;
-                break;
-            case 8: { // fault
-                std::size_t mlen = 0;
-                if (!r.read_map_len(mlen)) return false;
-                for (std::size_t j = 0; j < mlen; ++j) {
-                    uint32_t fk = 0; r.read_uint(fk);
-                    switch (fk) {
-                        case 1: { uint32_t fa = 0; r.read_uint(fa); frame.fault.fault_active = fa != 0; break; }
-                        case 2: r.read_uint(frame.fault.counters.watchdog_resets); break;
-                        case 3: r.read_uint(frame.fault.counters.ota_failures); break;
-                        case 4: r.read_uint(frame.fault.counters.tamper_events); break;
-                        default: r.skip_value(); break;
-                    }
-                }
-                break;
-            }
-            case 9: { // ota
-                std::size_t mlen = 0;
-                if (!r.read_map_len(mlen)) return false;
-                for (std::size_t j = 0; j < mlen; ++j) {
-                    uint32_t ok = 0; r.read_uint(ok);
-                    switch (ok) {
-                        case 1: { uint32_t st = 0; r.read_uint(st); frame.ota.state = static_cast<OtaState>(st); break; }
-                        case 2: r.read_uint(frame.ota.current_offset); break;
-                        case 3: r.read_uint(frame.ota.total_size); break;
-                        case 4: { uint32_t sv = 0; r.read_uint(sv); frame.ota.signature_valid = sv != 0; break; }
-                        default: r.skip_value(); break;
-                    }
-                }
-                break;
-            }
-            default:
-                r.skip_value();
-                break;
+        p = get_head(p, end, kMajorUInt, key);
+        if (p == nullptr) break;
+        // Maps outside the type's layout, including a repeated header or the
+        // extra maps of older all-section frames, are skipped.
+        const auto map = static_cast<MeshMapKey>(key);
+        p = key < 16 && (layout & (1u << key)) != 0 ? get_section(p, end, map, frame.header.version, frame)
+                                                    : skip_value(p, end);
+    }
+    return p != nullptr;
+}
+
+bool mesh_frame_view_open(const uint8_t* data, std::size_t len, MeshFrameView& view) {
+    view = MeshFrameView{};
+    if (data == nullptr || len > kMaxMeshFrameLen) return false;
+    const uint8_t* end = data + len;
+    uint32_t count = 0;
+    const uint8_t* p = get_head(data, end, kMajorMap, count);
+    if (p == nullptr || count == 0 || p == end || *p != static_cast<uint8_t>(MeshMapKey::Header)) return false;
+    const uint8_t* header = ++p;
+    uint32_t fields = 0;
+    p = get_head(p, end, kMajorMap, fields);
+    for (uint32_t i = 0; i < fields && p != nullptr; ++i) {
+        uint32_t key = 0;
+        p = get_head(p, end, kMajorUInt, key);
+        if (p == nullptr) break;
+        if (key < view.header.size()) {
+            view.header[key] = static_cast<uint16_t>(p - data);
         }
+        p = skip_value(p, end);
+    }
+    uint32_t msg_type = 0;
+    uint32_t version = kMeshSchemaV1;
+    const uint16_t type_at = view.header[static_cast<uint8_t>(MeshHeaderKey::MsgType)];
+    const uint16_t version_at = view.header[static_cast<uint8_t>(MeshHeaderKey::Version)];
+    if (p == nullptr || type_at == 0 || get_head(data + type_at, end, kMajorUInt, msg_type) == nullptr ||
+        (version_at != 0 && get_head(data + version_at, end, kMajorUInt, version) == nullptr)) {
+        view = MeshFrameView{};
+        return false;
+    }
+    view.version = static_cast<uint8_t>(version & 0xFF);
+    view.data = data;
+    view.len = len;
+    view.maps[static_cast<std::size_t>(MeshMapKey::Header)] = static_cast<uint16_t>(header - data);
+    view.layout = static_cast<uint16_t>(mesh_layout(static_cast<MeshMsgType>(msg_type & 0xFF)) &
+                                        ~mesh_map_bit(MeshMapKey::Header));
+    view.tail = count > 1 ? static_cast<uint16_t>(p - data) : 0;
+    view.tail_count = static_cast<uint16_t>(count - 1);
+    return true;
+}
+
+bool mesh_frame_view_has(MeshFrameView& view, MeshMapKey map) {
+    const auto idx = static_cast<std::size_t>(map);
+    if (idx >= view.maps.size()) return false;
+    if (map != MeshMapKey::Header) {
+        view_index_tail(view);
+    }
+    return view.maps[idx] != 0;
+}
+
+bool mesh_frame_view_uint(MeshFrameView& view, MeshMapKey map, uint8_t key, uint32_t& out) {
+    const uint8_t* p = view_field(view, map, key);
+    return p != nullptr && get_head(p, view.data + view.len, kMajorUInt, out) != nullptr;
+}
+
+bool mesh_frame_view_float(MeshFrameView& view, MeshMapKey map, uint8_t key, float& out) {
+    const uint8_t* p = view_field(view, map, key);
+    if (p == nullptr) return false;
+    // skip_value already checked the payload bytes while indexing.
+    if (p[0] == kFloat32Head) {
+        std::memcpy(&out, p + 2, sizeof(float));
+        return true;
+    }
+    if (p[0] == kHalfFloatHead) {
+        out = half_to_float(static_cast<uint16_t>(p[1] << 8 | p[2]));
+        return true;
     }
+    const uint8_t major = *p >> 5;
+    const float scale = field_scale(map, view.version, key);
+    uint32_t v = 0;
+    if (scale <= 0 || major > kMajorNegInt || get_head(p, view.data + view.len, major, v) == nullptr) return false;
+    out = int_to_scaled(major == kMajorUInt ? int64_t{v} : -1 - int64_t{v}, scale);
+    return true;
+}
+
+bool mesh_frame_view_text(MeshFrameView& view, MeshMapKey map, uint8_t key, const char*& out,
+                          std::size_t& len) {
+    const uint8_t* p = view_field(view, map, key);
+    uint32_t n = 0;
+    p = p != nullptr ? get_head(p, view.data + view.len, kMajorText, n) : nullptr;
+    if (p == nullptr) return false;
+    out = reinterpret_cast<const char*>(p);
+    len = n;
     return true;
 }
 
+bool mesh_frame_view_decode(MeshFrameView& view, MeshMapKey map, MeshFrame& out) {
+    if (!mesh_frame_view_has(view, map)) return false;
+    const auto idx = static_cast<std::size_t>(map);
+    return get_section(view.data + view.maps[idx], view.data + view.len, map, view.version, out) != nullptr;
+}
+
 bool decode_mesh_frame(const EncryptedFrame& enc, const AesGcmKey& key, MeshFrame& out) {
     EncodedFrame clear{};
+    if (!decrypt_mesh_frame(enc, key, clear) || !decode_mesh_frame_clear(clear, out)) {
+        return false;
+    }
+    return check_replay_and_update(out);
+}
+
+bool decrypt_mesh_frame(const EncryptedFrame& enc, const AesGcmKey& key, EncodedFrame& clear) {
     if (enc.len < kNonceLength + kAuthTagLength) return false;
     const uint8_t* nonce = enc.bytes.data();
     const uint8_t* tag = enc.bytes.data() + kNonceLength;
@@ -570,40 +818,35 @@ bool decode_mesh_frame(const EncryptedFrame& enc, const AesGcmKey& key, MeshFram
     );
     if (!res.ok) return false;
     clear.len = res.ciphertext_len;
-    if (!decode_mesh_frame_clear(clear, out)) {
-        return false;
-    }
-    return check_replay_and_update(out);
+    return true;
 }
 
-EncryptedFrame encrypt_mesh_frame(const MeshFrame& frame, const AesGcmKey& key) {
-    MeshFrame framed = frame;
-    if (nonce_is_zero(framed.security)) {
-        derive_nonce(framed, framed.security.nonce);
+bool encrypt_mesh_frame_into(const MeshFrame& frame, const AesGcmKey& key, EncryptedFrame& out,
+                             const MeshFrame* keyframe) {
+    // Layout: [nonce || auth_tag || ciphertext]. The body is encoded at the
+    // ciphertext offset and encrypted in place.
+    constexpr std::size_t kOverhead = kNonceLength + kAuthTagLength;
+    static_assert(kOverhead + kMaxMeshFrameLen <= kMaxCipherLen, "ciphertext offset leaves room for a full body");
+    MeshSecurity security = frame.security;
+    if (nonce_is_zero(security)) {
+        derive_nonce(frame.header, security.nonce);
     }
-
-    EncodedFrame clear = encode_mesh_frame(framed);
-    EncryptedFrame out{};
-    // Layout: [nonce || auth_tag || ciphertext]
-    const std::size_t overhead = kNonceLength + kAuthTagLength;
-    if (clear.len == 0 || clear.len + overhead > out.bytes.size()) {
-        out.len = 0;
-        return out;
+    out.len = 0;
+    uint8_t* body = out.bytes.data() + kOverhead;
+    // Bodies stay within kMaxMeshFrameLen so receivers can decrypt into an EncodedFrame.
+    const std::size_t len = encode_body(frame, security, body, body + kMaxMeshFrameLen, keyframe);
+    if (len == 0) {
+        return false;
     }
+    std::memcpy(out.bytes.data(), security.nonce.data(), kNonceLength);
+    const AesGcmResult res = aes_gcm_encrypt(body, len, key, security.nonce.data(), kNonceLength, body, len,
+                                             out.bytes.data() + kNonceLength, kAuthTagLength);
+    out.len = res.ok ? res.ciphertext_len + kOverhead : 0;
+    return res.ok;
+}
 
-    std::memcpy(out.bytes.data(), framed.security.nonce.data(), framed.security.nonce.size());
-
-    AesGcmResult res = aes_gcm_encrypt(
-        clear.bytes.data(),
-        clear.len,
-        key,
-        framed.security.nonce.data(),
-        framed.security.nonce.size(),
-        out.bytes.data() + overhead, // reserve space for nonce+tag
-        out.bytes.size() - overhead,
-        out.bytes.data() + kNonceLength,
-        kAuthTagLength
-    );
-    out.len = res.ok ? res.ciphertext_len + overhead : 0;
+EncryptedFrame encrypt_mesh_frame(const MeshFrame& frame, const AesGcmKey& key) {
+    EncryptedFrame out;
+    encrypt_mesh_frame_into(frame, key, out);
     return out;
 }
@@ -0,0 +1,160 @@
+#include "mesh_fragment.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace {
+struct ReassemblySlot {
+    bool used;
+    uint16_t link_id;
+    uint16_t tag;
+    uint8_t count;
+    uint16_t have;       // bit i set once fragment i is in
+    uint32_t started_ms; // arrival of the first fragment
+    std::size_t len;     // frame length, known once the last fragment is in
+    EncryptedFrame frame;
+};
+
+std::array<ReassemblySlot, kReassemblySlots> g_slots{};
+FragmentStats g_stats{};
+
+uint16_t fnv16(const uint8_t* data, std::size_t len) {
+    uint32_t h = 2166136261u;
+    for (std::size_t i = 0; i < len; ++i) {
+        h ^= data[i];
+        h *= 16777619u;
+    }
+    return static_cast<uint16_t>((h >> 16) ^ (h & 0xFFFF));
+}
+
+// Sealed frames lead with their nonce, which is unique per frame and the same
+// on every retry.
+uint16_t frame_tag(const EncryptedFrame& frame) {
+    return fnv16(frame.bytes.data(), std::min(frame.len, kNonceLength));
+}
+
+void expire_slots(uint32_t now_ms) {
+    for (auto& s : g_slots) {
+        if (s.used && now_ms - s.started_ms >= kReassemblyTimeoutMs) {
+            s.used = false;
+            g_stats.timeouts++;
+        }
+    }
+}
+
+ReassemblySlot* find_slot(uint16_t link_id, uint16_t tag) {
+    for (auto& s : g_slots) {
+        if (s.used && s.link_id == link_id && s.tag == tag) {
+            return &s;
+        }
+    }
+    return nullptr;
+}
+
+// A free slot, or else the one started longest ago.
+ReassemblySlot& claim_slot() {
+    for (auto& s : g_slots) {
+        if (!s.used) {
+            return s;
+        }
+    }
+    g_stats.evictions++;
+    return *std::min_element(g_slots.begin(), g_slots.end(), [](const ReassemblySlot& a, const ReassemblySlot& b) {
+        return a.started_ms < b.started_ms;
+    });
+}
+} // namespace
+
+uint16_t mesh_link_id(const char* node_id) {
+    return fnv16(reinterpret_cast<const uint8_t*>(node_id), strnlen(node_id, kMaxNodeIdLength));
+}
+
+std::size_t mesh_fragment_count(std::size_t len) {
+    return (len + kFragmentPayload - 1) / kFragmentPayload;
+}
+
+bool mesh_fragment_build(const EncryptedFrame& frame, uint16_t link_id, std::size_t index, LinkPacket& out) {
+    const std::size_t count = mesh_fragment_count(frame.len);
+    if (frame.len > frame.bytes.size() || index >= count || count > 16) {
+        return false;
+    }
+    const std::size_t offset = index * kFragmentPayload;
+    const std::size_t payload = std::min(kFragmentPayload, frame.len - offset);
+    const uint16_t tag = frame_tag(frame);
+    out.bytes[0] = static_cast<uint8_t>(link_id >> 8);
+    out.bytes[1] = static_cast<uint8_t>(link_id);
+    out.bytes[2] = static_cast<uint8_t>(tag >> 8);
+    out.bytes[3] = static_cast<uint8_t>(tag);
+    out.bytes[4] = static_cast<uint8_t>(index << 4 | (count - 1));
+    std::memcpy(out.bytes.data() + kFragmentHeaderLen, frame.bytes.data() + offset, payload);
+    out.len = kFragmentHeaderLen + payload;
+    return true;
+}
+
+void mesh_fragment_reset() {
+    g_slots = {};
+    g_stats = {};
+}
+
+bool mesh_fragment_receive(const uint8_t* data, std::size_t len, uint32_t now_ms, EncryptedFrame& out) {
+    expire_slots(now_ms);
+    if (data == nullptr || len <= kFragmentHeaderLen || len > kLinkMtu) {
+        g_stats.invalid++;
+        return false;
+    }
+    const uint16_t link_id = static_cast<uint16_t>(data[0] << 8 | data[1]);
+    const uint16_t tag = static_cast<uint16_t>(data[2] << 8 | data[3]);
+    const std::size_t index = data[4] >> 4;
+    const std::size_t count = (data[4] & 0x0F) + 1u;
+    const uint8_t* payload = data + kFragmentHeaderLen;
+    const std::size_t payload_len = len - kFragmentHeaderLen;
+    const bool last = index + 1 == count;
+    if (index >= count || count > kMaxFragments || (!last && payload_len != kFragmentPayload) ||
+        index * kFragmentPayload + payload_len > kMaxCipherLen) {
+        g_stats.invalid++;
+        return false;
+    }
+    if (count == 1) {
+        std::memcpy(out.bytes.data(), payload, payload_len);
+        out.len = payload_len;
+        return true;
+    }
+
+    ReassemblySlot* slot = find_slot(link_id, tag);
+    if (slot != nullptr && slot->count != count) {
+        // Same sender and tag but a different frame shape: drop both.
+        slot->used = false;
+        g_stats.invalid++;
+        return false;
+    }
+    if (slot == nullptr) {
+        slot = &claim_slot();
+        slot->used = true;
+        slot->link_id = link_id;
+        slot->tag = tag;
+        slot->count = static_cast<uint8_t>(count);
+        slot->have = 0;
+        slot->started_ms = now_ms;
+        slot->len = 0;
+    }
+    const uint16_t bit = static_cast<uint16_t>(1u << index);
+    if ((slot->have & bit) != 0) {
+        return false;
+    }
+    std::memcpy(slot->frame.bytes.data() + index * kFragmentPayload, payload, payload_len);
+    slot->have = static_cast<uint16_t>(slot->have | bit);
+    if (last) {
+        slot->len = index * kFragmentPayload + payload_len;
+    }
+    if (slot->have != (1u << count) - 1) {
+        return false;
+    }
+    std::memcpy(out.bytes.data(), slot->frame.bytes.data(), slot->len);
+    out.len = slot->len;
+    slot->used = false;
+    g_stats.reassembled++;
+    return true;
+}
+
+FragmentStats mesh_fragment_stats() {
+    return g_stats;
+}
@@ -1,54 +1,338 @@
 #include "model_inference.hpp"
+#include "autoencoder.hpp"
+#include "dsp_kernels.hpp"
+#include "fft.hpp"
+#include "fft_q15.hpp"
+#include "goertzel.hpp"
+#include "window_profile.hpp"
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <complex>
-#include <numeric>
 #include <vector>
 
 namespace {
 std::vector<float> g_fft_mags;
+std::vector<std::complex<float>> g_fft_scratch;
+std::vector<int16_t> g_q15_scratch;
+FftPlan g_fft_plan;
+FftPlanQ15 g_q15_plan;
+GoertzelBank g_goertzel;
+std::array<float, kMaxGoertzelBins> g_goertzel_mags{};
+std::size_t g_fft_size = 0;
+FftPlan g_feature_plan;
+std::array<std::complex<float>, kFeatureFftSize / 2 + 1> g_feature_spectrum{};
+#ifdef OL_FIXED_POINT_DSP
+RfFeatureBackend g_backend = RfFeatureBackend::FixedQ15;
+#else
+RfFeatureBackend g_backend = RfFeatureBackend::RealFft;
+#endif
+// Band sweeps: 0 = node-wide backend, else 1 + RfFeatureBackend (BandConfig).
+std::array<uint8_t, kMaxBands> g_band_backend{};
+std::array<GoertzelBank, kMaxBands> g_band_banks;
+std::size_t g_band = kMaxBands;
+
+static_assert(kFeatureBins == kAutoencoderInputs, "feature vector must match the model input");
+
+// log2(1e-6) in Q16: same floor as the float path's std::max(x, 1e-6f).
+constexpr int32_t kLog2FloorQ16 = -1306235;
+// 20 * log10(2) in Q16, converts log2 to dB.
+constexpr int64_t kDbPerLog2Q16 = 394566;
+
+std::size_t plan_size(std::size_t fft_size) {
+    return std::min(fft_next_pow2(std::max<std::size_t>(fft_size, 2)), kMaxFftSize);
+}
+
+// FFT tables for `backend` at n points; the node-wide size is left alone.
+// False if n cannot be planned (not a power of two, or above kMaxFftSize).
+bool prepare_tables(RfFeatureBackend backend, std::size_t n) {
+    if (backend == RfFeatureBackend::FixedQ15) {
+        // Float tables are never touched on the fixed-point path.
+        if (!fft_plan_init_q15(g_q15_plan, n)) {
+            return false;
+        }
+        g_q15_scratch.reserve(n + 2);
+        return true;
+    }
+    if (!fft_plan_init(g_fft_plan, n)) {
+        return false;
+    }
+    // The real path only needs the n/2 + 1 packed bins; the complex path needs all n.
+    g_fft_scratch.reserve(backend == RfFeatureBackend::ComplexFft ? n : n / 2 + 1);
+    g_fft_mags.reserve(n / 2 + 1);
+    return true;
+}
+
+void prepare_fft(std::size_t fft_size) {
+    const std::size_t n = plan_size(fft_size);
+    g_fft_size = n;
+    if (g_backend == RfFeatureBackend::GoertzelBank && g_goertzel.bin_count != 0) {
+        // No FFT tables; only re-target the bank if the window length changed.
+        if (g_goertzel.n != n) {
+            goertzel_bank_init(g_goertzel, g_goertzel.bins.data(), g_goertzel.bin_count, n);
+        }
+        return;
+    }
+    prepare_tables(g_backend, n);
 }
 
+// The selected band's bank if it has one, else the node-wide bank.
+const GoertzelBank& active_bank() {
+    if (g_band < kMaxBands && g_band_banks[g_band].bin_count != 0) {
+        return g_band_banks[g_band];
+    }
+    return g_goertzel;
+}
+
+float q16_to_float(int32_t v) {
+    return static_cast<float>(v) / 65536.0f;
+}
+
+int32_t log2_to_db_q16(int32_t log2_q) {
+    return static_cast<int32_t>((static_cast<int64_t>(log2_q) * kDbPerLog2Q16) >> 16);
+}
+
+// Integer-only twin of the float feature path: Q15 real FFT, integer magnitudes,
+// and log2-domain dB. Output is bit-exact on every host.
+RfFeatures extract_rf_features_q15(const int16_t* samples, std::size_t count) {
+    RfFeatures features{};
+    const std::size_t N = count;
+    const std::size_t fft_n = std::max<std::size_t>(fft_next_pow2(N), 2);
+    // A window the plan cannot cover gets empty features, never a stale spectrum.
+    if (fft_n > g_q15_plan.size && !prepare_tables(RfFeatureBackend::FixedQ15, fft_n)) {
+        return features;
+    }
+
+    g_q15_scratch.resize(fft_n + 2);
+    int exponent = 0;
+    if (!fft_real_q15(g_q15_plan, samples, N, fft_n, g_q15_scratch.data(), exponent)) {
+        return features;
+    }
+
+    const std::size_t bins = fft_n / 2 + 1;
+    uint32_t peak_sq = 0;
+    uint64_t sum_mag_q8 = 0;
+    for (std::size_t k = 0; k < bins; ++k) {
+        const int32_t re = g_q15_scratch[2 * k];
+        const int32_t im = g_q15_scratch[2 * k + 1];
+        const uint32_t mag_sq = static_cast<uint32_t>(re * re) + static_cast<uint32_t>(im * im);
+        peak_sq = std::max(peak_sq, mag_sq);
+        sum_mag_q8 += isqrt_u64(static_cast<uint64_t>(mag_sq) << 16);
+    }
+
+    // True magnitude = stored * 2^exponent / N.
+    const int32_t log2_scale = exponent * 65536 - log2_q16(N);
+    int32_t log2_peak = kLog2FloorQ16;
+    int32_t log2_avg = kLog2FloorQ16;
+    if (peak_sq != 0) {
+        log2_peak = std::max(log2_q16(peak_sq) / 2 + log2_scale, kLog2FloorQ16);
+    }
+    if (sum_mag_q8 != 0) {
+        log2_avg = std::max(log2_q16(sum_mag_q8) - 8 * 65536 - log2_q16(bins) + log2_scale, kLog2FloorQ16);
+    }
+
+    features.avg_dbm = q16_to_float(log2_to_db_q16(log2_avg) - 30 * 65536);
+    features.peak_dbm = q16_to_float(log2_to_db_q16(log2_peak) - 20 * 65536);
+    return features;
+}
+
+// Bins stay anchored to the bank's spectrum size so a watched channel keeps
+// its frequency; shorter windows are zero-padded, longer ones truncated.
+RfFeatures extract_rf_features_goertzel(const GoertzelBank& bank, const int16_t* samples, std::size_t count) {
+    const std::size_t N = std::min<std::size_t>(count, bank.n);
+    const MagnitudeStats stats = goertzel_bank_run(bank, samples, N,
+                                                   1.0f / static_cast<float>(N), g_goertzel_mags.data());
+    return features_from_magnitude_stats(stats, bank.bin_count);
+}
+} // namespace
+
 void init_model_inference() {
-    g_fft_mags.reserve(kMaxRfSamples);
+    prepare_fft(kMaxRfSamples);
+    fft_plan_init(g_feature_plan, kFeatureFftSize);
 }
 
-// Simple O(N^2) DFT magnitude for embedded portability when no FFT lib is present.
-static void compute_fft_mag(const RFSampleWindow& window, std::vector<float>& mags_out) {
-    const std::size_t N = window.sample_count;
-    mags_out.assign(N / 2 + 1, 0.0f);
-    const float invN = 1.0f / static_cast<float>(N);
+bool init_model_inference(const NodeConfig& cfg) {
+    fft_plan_init(g_feature_plan, kFeatureFftSize);
+    // If the profile cannot be allocated, capture keeps the previous (or
+    // default) window length; size everything to what will actually arrive.
+    const bool selected = window_profile_select(cfg.fft_size);
+    const std::size_t n = window_profile().samples;
+    g_fft_size = n;
+    if (cfg.watch_bin_count != 0 &&
+        set_goertzel_bins(cfg.watch_bins.data(), std::min<std::size_t>(cfg.watch_bin_count, cfg.watch_bins.size()))) {
+        g_backend = RfFeatureBackend::GoertzelBank;
+    }
+    prepare_fft(n);
+    return selected;
+}
+
+bool set_goertzel_bins(const uint16_t* bins, std::size_t count) {
+    const std::size_t n = g_fft_size != 0 ? g_fft_size : kMaxRfSamples;
+    return goertzel_bank_init(g_goertzel, bins, count, n);
+}
+
+void set_rf_feature_backend(RfFeatureBackend backend) {
+    g_backend = backend;
+    if (g_fft_size != 0) {
+        prepare_fft(g_fft_size);
+    }
+}
+
+RfFeatureBackend rf_feature_backend() {
+    if (g_band < kMaxBands && g_band_backend[g_band] != 0) {
+        return static_cast<RfFeatureBackend>(g_band_backend[g_band] - 1);
+    }
+    return g_backend;
+}
+
+bool set_band_feature_backend(uint8_t band, const BandConfig& cfg) {
+    if (band >= kMaxBands) {
+        return false;
+    }
+    g_band_backend[band] = 0;
+    g_band_banks[band] = GoertzelBank{};
+    const uint8_t choice = cfg.feature_backend != 0 ? cfg.feature_backend
+        : cfg.watch_bin_count != 0 ? static_cast<uint8_t>(1 + static_cast<uint8_t>(RfFeatureBackend::GoertzelBank))
+        : 0;
+    if (choice == 0) {
+        return true;
+    }
+    if (choice - 1 > static_cast<uint8_t>(RfFeatureBackend::GoertzelBank)) {
+        return false;
+    }
+    const auto backend = static_cast<RfFeatureBackend>(choice - 1);
+    const std::size_t n = cfg.fft_size != 0 ? cfg.fft_size : (g_fft_size != 0 ? g_fft_size : kMaxRfSamples);
+    if (backend == RfFeatureBackend::GoertzelBank) {
+        const std::size_t count = std::min<std::size_t>(cfg.watch_bin_count, cfg.watch_bins.size());
+        if (!goertzel_bank_init(g_band_banks[band], cfg.watch_bins.data(), count, n)) {
+            g_band_banks[band] = GoertzelBank{};
+            return false;
+        }
+    } else {
+        // Grow only: the node-wide windows may be longer than this band's.
+        const std::size_t plan = plan_size(n);
+        const std::size_t have = backend == RfFeatureBackend::FixedQ15 ? g_q15_plan.size : g_fft_plan.size;
+        if (have < plan) {
+            prepare_tables(backend, plan);
+        }
+    }
+    g_band_backend[band] = choice;
+    return true;
+}
+
+void select_rf_feature_band(uint8_t band) {
+    g_band = band;
+}
 
-    for (std::size_t k = 0; k < mags_out.size(); ++k) {
-        std::complex<float> acc{0.0f, 0.0f};
+// Radix-2 FFT magnitude; non power-of-two windows are zero-padded to the next size.
+// Magnitudes, max and sum come out of one vectorized pass. False if the window
+// needs a transform larger than kMaxFftSize (or the transform fails), so a
+// stale spectrum is never reported.
+static bool compute_fft_mag(const int16_t* samples, std::size_t count, std::vector<float>& mags_out,
+                            MagnitudeStats& stats) {
+    const std::size_t N = count;
+    const std::size_t fft_n = std::max<std::size_t>(fft_next_pow2(N), 2);
+    const RfFeatureBackend backend = rf_feature_backend();
+    // Window larger than the configured plan; grow once.
+    if (fft_n > g_fft_plan.size && !prepare_tables(backend, fft_n)) {
+        return false;
+    }
+
+    bool ok = false;
+    if (backend == RfFeatureBackend::ComplexFft) {
+        g_fft_scratch.assign(fft_n, std::complex<float>{0.0f, 0.0f});
         for (std::size_t n = 0; n < N; ++n) {
-            const float angle = -2.0f * 3.14159265f * static_cast<float>(k * n) * invN;
-            const float sample = static_cast<float>(window.samples[n]);
-            acc += std::complex<float>(sample * std::cos(angle), sample * std::sin(angle));
+            g_fft_scratch[n] = {static_cast<float>(samples[n]), 0.0f};
         }
-        mags_out[k] = std::abs(acc) * invN;
+        ok = fft_complex(g_fft_plan, g_fft_scratch.data(), fft_n);
+    } else {
+        g_fft_scratch.resize(fft_n / 2 + 1);
+        ok = fft_real(g_fft_plan, samples, N, fft_n, g_fft_scratch.data());
+    }
+    if (!ok) {
+        return false;
     }
+
+    const float invN = 1.0f / static_cast<float>(N);
+    mags_out.resize(fft_n / 2 + 1);
+    stats = dsp_magnitude_stats(g_fft_scratch.data(), mags_out.size(), invN, mags_out.data());
+    return true;
 }
 
 RfFeatures extract_rf_features(const RFSampleWindow& window) {
+    return extract_rf_features(window.samples.data(), std::min(window.sample_count, kMaxRfSamples));
+}
+
+RfFeatures extract_rf_features(const int16_t* samples, std::size_t count) {
     RfFeatures features{};
 
-    if (window.sample_count == 0) {
+    if (samples == nullptr || count == 0) {
         return features;
     }
+    const RfFeatureBackend backend = rf_feature_backend();
+    if (backend == RfFeatureBackend::FixedQ15) {
+        return extract_rf_features_q15(samples, count);
+    }
+    const GoertzelBank& bank = active_bank();
+    if (backend == RfFeatureBackend::GoertzelBank && bank.bin_count != 0) {
+        return extract_rf_features_goertzel(bank, samples, count);
+    }
+    // Full capture windows go through the fixed-size specialization.
+    if (backend == RfFeatureBackend::RealFft && count == window_profile().samples) {
+        return features_from_magnitude_stats(window_profile_spectrum(samples), window_profile().bins);
+    }
 
-    compute_fft_mag(window, g_fft_mags);
-    const auto max_it = std::max_element(g_fft_mags.begin(), g_fft_mags.end());
-    const float peak = (max_it != g_fft_mags.end()) ? *max_it : 0.0f;
-    const float avg = std::accumulate(g_fft_mags.begin(), g_fft_mags.end(), 0.0f) /
-                      static_cast<float>(g_fft_mags.size());
+    MagnitudeStats stats{};
+    if (!compute_fft_mag(samples, count, g_fft_mags, stats)) {
+        return features;
+    }
+    return features_from_magnitude_stats(stats, g_fft_mags.size());
+}
+
+RfFeatures features_from_magnitude_stats(const MagnitudeStats& stats, std::size_t bin_count) {
+    RfFeatures features{};
+    if (bin_count == 0) {
+        return features;
+    }
+    const float peak = stats.max;
+    const float avg = stats.sum / static_cast<float>(bin_count);
 
     // Placeholder scaling to dBm-ish values for visualization.
-    features.avg_dbm = 20.0f * std::log10(std::max(avg, 1e-6f)) - 30.0f;
-    features.peak_dbm = 20.0f * std::log10(std::max(peak, 1e-6f)) - 20.0f;
+    features.avg_dbm = 20.0f * dsp_log10(std::max(avg, 1e-6f)) - 30.0f;
+    features.peak_dbm = 20.0f * dsp_log10(std::max(peak, 1e-6f)) - 20.0f;
     return features;
 }
 
+bool extract_rf_feature_vector(const RFSampleWindow& window, RfFeatureVector& out) {
+    return extract_rf_feature_vector(window.samples.data(), std::min(window.sample_count, kMaxRfSamples), out);
+}
+
+bool extract_rf_feature_vector(const int16_t* samples, std::size_t count, RfFeatureVector& out) {
+    if (g_feature_plan.size == 0) {
+        fft_plan_init(g_feature_plan, kFeatureFftSize); // callers that skipped init_model_inference
+    }
+    count = std::min(count, kFeatureFftSize);
+    if (!fft_real(g_feature_plan, samples, count, kFeatureFftSize, g_feature_spectrum.data())) {
+        return false;
+    }
+    feature_vector_from_spectrum(g_feature_spectrum.data(), 1, out);
+    return true;
+}
+
+void feature_vector_from_spectrum(const std::complex<float>* spectrum, std::size_t stride, RfFeatureVector& out) {
+    constexpr float kScale = 1.0f / kAdcFullScale;
+    float max_log = 0.0f;
+    for (std::size_t k = 0; k < kFeatureBins; ++k) {
+        const float mag = std::abs(spectrum[k * stride]) * kScale + 1e-6f;
+        out.bins[k] = std::log1p(mag);
+        max_log = std::max(max_log, out.bins[k]);
+    }
+    const float inv = 1.0f / (max_log + 1e-6f);
+    for (float& v : out.bins) {
+        v *= inv;
+    }
+}
+
 float run_model_inference(const RfFeatures& features) {
     // Toy anomaly score: normalized difference between peak and average
     const float delta = features.peak_dbm - features.avg_dbm;
@@ -61,3 +345,14 @@ float run_model_inference(const RfFeatures& features) {
     }
     return normalized;
 }
+
+float run_model_inference(const float* features, std::size_t count) {
+    if (features == nullptr || count != kAutoencoderInputs) {
+        return 0.0f;
+    }
+    return autoencoder_anomaly_score(autoencoder_reconstruction_error(features));
+}
+
+float run_model_inference(const RfFeatureVector& features) {
+    return run_model_inference(features.bins.data(), features.bins.size());
+}
@@ -0,0 +1,83 @@
+#include "prescreen.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+// Floor EWMA weight per quiet window, and a lower bound of ~1 LSB RMS so a
+// silent input does not turn every dither step into an excursion.
+constexpr float kFloorAlpha = 1.0f / 16.0f;
+constexpr float kMinFloor = 1.0f;
+
+float db_ratio(float db) {
+    return std::pow(10.0f, db / 10.0f);
+}
+} // namespace
+
+float window_ac_energy(const int16_t* samples, std::size_t count) {
+    if (samples == nullptr || count == 0) {
+        return 0.0f;
+    }
+    int64_t sum = 0;
+    int64_t sum_sq = 0;
+    for (std::size_t i = 0; i < count; ++i) {
+        const int32_t v = samples[i];
+        sum += v;
+        sum_sq += v * v;
+    }
+    const double n = static_cast<double>(count);
+    const double mean = static_cast<double>(sum) / n;
+    return static_cast<float>(std::max(static_cast<double>(sum_sq) / n - mean * mean, 0.0));
+}
+
+PrescreenDecision prescreen_update(PrescreenState& st, const PrescreenConfig& cfg, float energy,
+                                   PrescreenStats* stats) {
+    PrescreenDecision decision = PrescreenDecision::Skip;
+    if (!st.seeded) {
+        // First window seeds the floor and always gets a full scan.
+        st.noise_floor = std::max(energy, kMinFloor);
+        st.seeded = true;
+        st.since_full_scan = 0;
+        decision = PrescreenDecision::ForcedScan;
+    } else {
+        const float trigger = st.noise_floor * db_ratio(cfg.trigger_db);
+        const float release = st.noise_floor * db_ratio(std::min(cfg.release_db, cfg.trigger_db));
+        if (!st.escalated) {
+            if (energy > trigger) {
+                st.escalated = true;
+                st.hold_left = cfg.hold_windows;
+                if (stats != nullptr) {
+                    stats->triggers++;
+                }
+            } else {
+                st.noise_floor = std::max(st.noise_floor + kFloorAlpha * (energy - st.noise_floor), kMinFloor);
+            }
+        } else if (energy > release) {
+            st.hold_left = cfg.hold_windows;
+        } else if (st.hold_left > 0) {
+            st.hold_left--;
+        }
+        if (st.escalated && energy <= release && st.hold_left == 0) {
+            st.escalated = false;
+        }
+
+        if (st.escalated) {
+            decision = PrescreenDecision::Escalate;
+        } else if (cfg.full_scan_every != 0 && st.since_full_scan + 1u >= cfg.full_scan_every) {
+            decision = PrescreenDecision::ForcedScan;
+        }
+    }
+
+    if (decision == PrescreenDecision::Skip) {
+        st.since_full_scan++;
+    } else {
+        st.since_full_scan = 0;
+    }
+    if (stats != nullptr) {
+        stats->windows++;
+        stats->skipped += decision == PrescreenDecision::Skip ? 1 : 0;
+        stats->escalated += decision == PrescreenDecision::Escalate ? 1 : 0;
+        stats->forced_scans += decision == PrescreenDecision::ForcedScan ? 1 : 0;
+    }
+    return decision;
+}
@@ -15,6 +15,7 @@ RadioTransport g_transport_mode = RadioTransport::EspNow;
 
 #ifdef ESP_PLATFORM
 constexpr std::size_t kEspNowMaxPayload = 250; // ESP-NOW per-packet payload limit
+static_assert(kLinkMtu <= kEspNowMaxPayload, "link packets fit one ESP-NOW payload");
 const uint8_t kBroadcastAddr[6] = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF};
 bool g_radio_ready = false;
 
@@ -26,16 +27,16 @@ bool check_esp(esp_err_t err, const char* msg) {
     return true;
 }
 
-bool send_espnow(const EncryptedFrame& frame) {
+bool send_espnow(const LinkPacket& packet) {
     if (!g_radio_ready) {
         ESP_LOGW("RADIO", "send dropped: radio not ready");
         return false;
     }
-    if (frame.len == 0 || frame.len > kEspNowMaxPayload) {
-        ESP_LOGW("RADIO", "send dropped: len=%zu exceeds ESP-NOW limit %zu", frame.len, kEspNowMaxPayload);
+    if (packet.len == 0 || packet.len > kEspNowMaxPayload) {
+        ESP_LOGW("RADIO", "send dropped: len=%zu exceeds ESP-NOW limit %zu", packet.len, kEspNowMaxPayload);
         return false;
     }
-    const esp_err_t err = esp_now_send(kBroadcastAddr, frame.bytes.data(), frame.len);
+    const esp_err_t err = esp_now_send(kBroadcastAddr, packet.bytes.data(), packet.len);
     if (err != ESP_OK) {
         ESP_LOGW("RADIO", "esp_now_send failed: %s", esp_err_to_name(err));
         return false;
@@ -43,16 +44,16 @@ bool send_espnow(const EncryptedFrame& frame) {
     return true;
 }
 
-bool send_wifi_raw(const EncryptedFrame& frame) {
+bool send_wifi_raw(const LinkPacket& packet) {
     if (!g_radio_ready) {
         ESP_LOGW("RADIO", "wifi raw send dropped: radio not ready");
         return false;
     }
-    if (frame.len == 0 || frame.len > kMaxCipherLen) {
-        ESP_LOGW("RADIO", "wifi raw send dropped: invalid len=%zu", frame.len);
+    if (packet.len == 0 || packet.len > kLinkMtu) {
+        ESP_LOGW("RADIO", "wifi raw send dropped: invalid len=%zu", packet.len);
         return false;
     }
-    const esp_err_t err = esp_wifi_80211_tx(WIFI_IF_STA, frame.bytes.data(), frame.len, false);
+    const esp_err_t err = esp_wifi_80211_tx(WIFI_IF_STA, packet.bytes.data(), packet.len, false);
     if (err != ESP_OK) {
         ESP_LOGW("RADIO", "esp_wifi_80211_tx failed: %s", esp_err_to_name(err));
         return false;
@@ -60,29 +61,29 @@ bool send_wifi_raw(const EncryptedFrame& frame) {
     return true;
 }
 
-bool send_lora(const EncryptedFrame& frame) {
+bool send_lora(const LinkPacket& packet) {
 #ifdef CONFIG_OL_LORA_SUPPORTED
     // Placeholder: integrate with actual LoRa driver.
     // Return false to signal retry if not wired.
-    (void)frame;
+    (void)packet;
     ESP_LOGW("RADIO", "LoRa path selected but not implemented");
     return false;
 #else
-    (void)frame;
+    (void)packet;
     ESP_LOGW("RADIO", "LoRa transport not compiled in");
     return false;
 #endif
 }
 
-bool driver_send(const EncryptedFrame& frame) {
+bool driver_send(const LinkPacket& packet) {
     switch (g_transport_mode) {
         case RadioTransport::WifiRaw:
-            return send_wifi_raw(frame);
+            return send_wifi_raw(packet);
         case RadioTransport::LoRa:
-            return send_lora(frame);
+            return send_lora(packet);
         case RadioTransport::EspNow:
         default:
-            return send_espnow(frame);
+            return send_espnow(packet);
     }
 }
 
@@ -102,8 +103,8 @@ bool init_espnow() {
     return true;
 }
 #else
-bool driver_send(const EncryptedFrame& frame) {
-    (void)frame;
+bool driver_send(const LinkPacket& packet) {
+    (void)packet;
     return true;
 }
 #endif
@@ -124,6 +125,6 @@ RadioTransport current_radio_transport() {
     return g_transport_mode;
 }
 
-bool radio_driver_send(const EncryptedFrame& frame) {
-    return driver_send(frame);
+bool radio_driver_send(const LinkPacket& packet) {
+    return driver_send(packet);
 }
@@ -0,0 +1,417 @@
+#include "replay_source.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#ifdef _WIN32
+#include <cstdio>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+uint16_t rd16(const uint8_t* p) {
+    return static_cast<uint16_t>(p[0] | (p[1] << 8));
+}
+
+uint32_t rd32(const uint8_t* p) {
+    return static_cast<uint32_t>(rd16(p)) | (static_cast<uint32_t>(rd16(p + 2)) << 16);
+}
+
+uint64_t rd64(const uint8_t* p) {
+    return static_cast<uint64_t>(rd32(p)) | (static_cast<uint64_t>(rd32(p + 4)) << 32);
+}
+
+std::size_t dtype_size(NpyDtype t) {
+    switch (t) {
+    case NpyDtype::Int8:
+    case NpyDtype::UInt8: return 1;
+    case NpyDtype::Int16: return 2;
+    case NpyDtype::Int32:
+    case NpyDtype::Float32: return 4;
+    case NpyDtype::Float64: return 8;
+    }
+    return 0;
+}
+
+// Value of `key` in the header dict, e.g. "'descr': '<f4'" -> "'<f4'".
+const char* find_value(const char* dict, const char* end, const char* key) {
+    const std::size_t key_len = std::strlen(key);
+    for (const char* p = dict; p + key_len < end; ++p) {
+        if (std::memcmp(p, key, key_len) == 0) {
+            p += key_len;
+            while (p < end && (*p == ' ' || *p == ':')) {
+                ++p;
+            }
+            return p;
+        }
+    }
+    return nullptr;
+}
+
+bool parse_dtype(const char* p, const char* end, NpyDtype& out) {
+    struct Entry {
+        const char* descr;
+        NpyDtype type;
+    };
+    static const Entry kTypes[] = {
+        {"'|i1'", NpyDtype::Int8},    {"'|u1'", NpyDtype::UInt8},   {"'<i2'", NpyDtype::Int16},
+        {"'<i4'", NpyDtype::Int32},   {"'<f4'", NpyDtype::Float32}, {"'<f8'", NpyDtype::Float64},
+    };
+    for (const Entry& e : kTypes) {
+        const std::size_t n = std::strlen(e.descr);
+        if (p + n <= end && std::memcmp(p, e.descr, n) == 0) {
+            out = e.type;
+            return true;
+        }
+    }
+    return false;
+}
+
+// "(225, 256)" / "(1024,)" / "()" -> element count.
+bool parse_shape(const char* p, const char* end, std::size_t& count) {
+    if (p >= end || *p != '(') {
+        return false;
+    }
+    count = 1;
+    ++p;
+    while (p < end && *p != ')') {
+        if (*p >= '0' && *p <= '9') {
+            std::size_t dim = 0;
+            while (p < end && *p >= '0' && *p <= '9') {
+                dim = dim * 10 + static_cast<std::size_t>(*p - '0');
+                ++p;
+            }
+            count *= dim;
+        } else {
+            ++p;
+        }
+    }
+    return p < end;
+}
+
+// Locates `member` in a zip archive through the central directory (zip64
+// aware, as numpy writes) and returns its data span if it is stored.
+ReplayError find_zip_member(const uint8_t* zip, std::size_t len, const char* member, const uint8_t** data,
+                            std::size_t* size) {
+    constexpr uint32_t kEocdSig = 0x06054b50;
+    constexpr uint32_t kZip64LocatorSig = 0x07064b50;
+    constexpr uint32_t kZip64EocdSig = 0x06064b50;
+    constexpr uint32_t kCentralSig = 0x02014b50;
+    constexpr uint32_t kLocalSig = 0x04034b50;
+
+    if (len < 22) {
+        return ReplayError::NotZip;
+    }
+    std::size_t eocd = len - 22;
+    const std::size_t floor = len > 22 + 0xFFFF ? len - 22 - 0xFFFF : 0;
+    while (rd32(zip + eocd) != kEocdSig) {
+        if (eocd == floor) {
+            return ReplayError::NotZip;
+        }
+        --eocd;
+    }
+    uint64_t entries = rd16(zip + eocd + 10);
+    uint64_t cd_offset = rd32(zip + eocd + 16);
+    if (cd_offset == 0xFFFFFFFFu && eocd >= 20 && rd32(zip + eocd - 20) == kZip64LocatorSig) {
+        const uint64_t z64 = rd64(zip + eocd - 20 + 8);
+        if (z64 + 56 > len || rd32(zip + z64) != kZip64EocdSig) {
+            return ReplayError::Truncated;
+        }
+        entries = rd64(zip + z64 + 32);
+        cd_offset = rd64(zip + z64 + 48);
+    }
+
+    // Accept "name" for "name.npy".
+    const std::size_t want_len = std::strlen(member);
+    uint64_t p = cd_offset;
+    for (uint64_t e = 0; e < entries; ++e) {
+        if (p + 46 > len || rd32(zip + p) != kCentralSig) {
+            return ReplayError::Truncated;
+        }
+        const uint16_t method = rd16(zip + p + 10);
+        uint64_t comp_size = rd32(zip + p + 20);
+        uint64_t uncomp_size = rd32(zip + p + 24);
+        const uint16_t name_len = rd16(zip + p + 28);
+        const uint16_t extra_len = rd16(zip + p + 30);
+        const uint16_t comment_len = rd16(zip + p + 32);
+        uint64_t local = rd32(zip + p + 42);
+        const char* name = reinterpret_cast<const char*>(zip + p + 46);
+        if (p + 46 + name_len + extra_len > len) {
+            return ReplayError::Truncated;
+        }
+
+        const bool match = (name_len == want_len && std::memcmp(name, member, want_len) == 0) ||
+                           (name_len == want_len + 4 && std::memcmp(name, member, want_len) == 0 &&
+                            std::memcmp(name + want_len, ".npy", 4) == 0);
+        if (match) {
+            // Zip64 extra field: 64-bit values for whichever fields are saturated.
+            const uint8_t* x = zip + p + 46 + name_len;
+            const uint8_t* x_end = x + extra_len;
+            while (x + 4 <= x_end) {
+                const uint16_t id = rd16(x);
+                const uint16_t sz = rd16(x + 2);
+                if (id == 0x0001) {
+                    const uint8_t* v = x + 4;
+                    if (uncomp_size == 0xFFFFFFFFu && v + 8 <= x + 4 + sz) {
+                        uncomp_size = rd64(v);
+                        v += 8;
+                    }
+                    if (comp_size == 0xFFFFFFFFu && v + 8 <= x + 4 + sz) {
+                        comp_size = rd64(v);
+                        v += 8;
+                    }
+                    if (local == 0xFFFFFFFFu && v + 8 <= x + 4 + sz) {
+                        local = rd64(v);
+                    }
+                }
+                x += 4 + sz;
+            }
+            if (method != 0 || comp_size != uncomp_size) {
+                return ReplayError::CompressedMember;
+            }
+            if (local + 30 > len || rd32(zip + local) != kLocalSig) {
+                return ReplayError::Truncated;
+            }
+            const uint64_t start = local + 30 + rd16(zip + local + 26) + rd16(zip + local + 28);
+            if (start + uncomp_size > len) {
+                return ReplayError::Truncated;
+            }
+            *data = zip + start;
+            *size = static_cast<std::size_t>(uncomp_size);
+            return ReplayError::None;
+        }
+        p += 46 + name_len + extra_len + comment_len;
+    }
+    return ReplayError::MemberNotFound;
+}
+
+bool map_file(const char* path, const uint8_t** map, std::size_t* len) {
+#ifdef _WIN32
+    FILE* f = std::fopen(path, "rb");
+    if (f == nullptr) {
+        return false;
+    }
+    std::fseek(f, 0, SEEK_END);
+    const long size = std::ftell(f);
+    std::fseek(f, 0, SEEK_SET);
+    auto* buf = new uint8_t[size > 0 ? size : 1];
+    const bool ok = size > 0 && std::fread(buf, 1, static_cast<std::size_t>(size), f) == static_cast<std::size_t>(size);
+    std::fclose(f);
+    if (!ok) {
+        delete[] buf;
+        return false;
+    }
+    *map = buf;
+    *len = static_cast<std::size_t>(size);
+    return true;
+#else
+    const int fd = open(path, O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+    struct stat st {};
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        close(fd);
+        return false;
+    }
+    void* p = mmap(nullptr, static_cast<std::size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (p == MAP_FAILED) {
+        return false;
+    }
+    *map = static_cast<const uint8_t*>(p);
+    *len = static_cast<std::size_t>(st.st_size);
+    return true;
+#endif
+}
+
+void unmap_file(const uint8_t* map, std::size_t len) {
+#ifdef _WIN32
+    (void)len;
+    delete[] map;
+#else
+    munmap(const_cast<uint8_t*>(map), len);
+#endif
+}
+
+int16_t saturate(double v) {
+    return static_cast<int16_t>(std::lround(std::clamp(v, -32768.0, 32767.0)));
+}
+} // namespace
+
+ReplayError npy_parse_header(const uint8_t* data, std::size_t len, NpyInfo& out) {
+    static const uint8_t kMagic[6] = {0x93, 'N', 'U', 'M', 'P', 'Y'};
+    if (data == nullptr || len < 10 || std::memcmp(data, kMagic, sizeof(kMagic)) != 0) {
+        return ReplayError::NotNpy;
+    }
+    const uint8_t major = data[6];
+    std::size_t header_len = 0;
+    std::size_t dict_start = 0;
+    if (major == 1) {
+        header_len = rd16(data + 8);
+        dict_start = 10;
+    } else if (major == 2 || major == 3) {
+        if (len < 12) {
+            return ReplayError::Truncated;
+        }
+        header_len = rd32(data + 8);
+        dict_start = 12;
+    } else {
+        return ReplayError::NotNpy;
+    }
+    if (dict_start + header_len > len) {
+        return ReplayError::Truncated;
+    }
+
+    const char* dict = reinterpret_cast<const char*>(data + dict_start);
+    const char* end = dict + header_len;
+    const char* descr = find_value(dict, end, "'descr'");
+    const char* fortran = find_value(dict, end, "'fortran_order'");
+    const char* shape = find_value(dict, end, "'shape'");
+    if (descr == nullptr || fortran == nullptr || shape == nullptr) {
+        return ReplayError::NotNpy;
+    }
+    if (!parse_dtype(descr, end, out.dtype)) {
+        return ReplayError::UnsupportedDtype;
+    }
+    if (std::strncmp(fortran, "True", 4) == 0) {
+        return ReplayError::FortranOrder;
+    }
+    if (!parse_shape(shape, end, out.count)) {
+        return ReplayError::NotNpy;
+    }
+    out.header_bytes = dict_start + header_len;
+    if (out.header_bytes + out.count * dtype_size(out.dtype) > len) {
+        return ReplayError::Truncated;
+    }
+    return ReplayError::None;
+}
+
+ReplayError replay_open(ReplaySource& src, const char* path, const char* member) {
+    replay_close(src);
+    if (path == nullptr || !map_file(path, &src.map, &src.map_len)) {
+        return ReplayError::OpenFailed;
+    }
+
+    const uint8_t* npy = src.map;
+    std::size_t npy_len = src.map_len;
+    if (src.map_len >= 4 && rd32(src.map) == 0x04034b50) {
+        ReplayError err = ReplayError::MemberNotFound;
+        if (member != nullptr) {
+            err = find_zip_member(src.map, src.map_len, member, &npy, &npy_len);
+        }
+        if (err != ReplayError::None) {
+            replay_close(src);
+            return err;
+        }
+    }
+
+    const ReplayError err = npy_parse_header(npy, npy_len, src.info);
+    if (err != ReplayError::None) {
+        replay_close(src);
+        return err;
+    }
+    src.data = npy + src.info.header_bytes;
+    src.pos = 0;
+    src.passes = 0;
+    return ReplayError::None;
+}
+
+void replay_close(ReplaySource& src) {
+    if (src.map != nullptr) {
+        unmap_file(src.map, src.map_len);
+    }
+    src.map = nullptr;
+    src.map_len = 0;
+    src.data = nullptr;
+    src.info = {};
+    src.pos = 0;
+}
+
+void replay_rewind(ReplaySource& src) {
+    src.pos = 0;
+    src.passes = 0;
+}
+
+std::size_t replay_read(ReplaySource& src, int16_t* out, std::size_t count) {
+    if (src.data == nullptr || out == nullptr || src.info.count == 0) {
+        return 0;
+    }
+    std::size_t written = 0;
+    while (written < count) {
+        if (src.pos == src.info.count) {
+            src.passes++;
+            if (!src.loop) {
+                break;
+            }
+            src.pos = 0;
+        }
+        const std::size_t n = std::min(count - written, src.info.count - src.pos);
+        const uint8_t* p = src.data + src.pos * dtype_size(src.info.dtype);
+        int16_t* o = out + written;
+        // Element loads go through memcpy: mapped data is only byte-aligned.
+        switch (src.info.dtype) {
+        case NpyDtype::Int8:
+            for (std::size_t i = 0; i < n; ++i) {
+                o[i] = static_cast<int8_t>(p[i]);
+            }
+            break;
+        case NpyDtype::UInt8:
+            for (std::size_t i = 0; i < n; ++i) {
+                o[i] = p[i];
+            }
+            break;
+        case NpyDtype::Int16:
+            std::memcpy(o, p, n * sizeof(int16_t));
+            break;
+        case NpyDtype::Int32:
+            for (std::size_t i = 0; i < n; ++i) {
+                int32_t v;
+                std::memcpy(&v, p + 4 * i, sizeof(v));
+                o[i] = saturate(v);
+            }
+            break;
+        case NpyDtype::Float32:
+            for (std::size_t i = 0; i < n; ++i) {
+                float v;
+                std::memcpy(&v, p + 4 * i, sizeof(v));
+                o[i] = saturate(static_cast<double>(v) * src.scale);
+            }
+            break;
+        case NpyDtype::Float64:
+            for (std::size_t i = 0; i < n; ++i) {
+                double v;
+                std::memcpy(&v, p + 8 * i, sizeof(v));
+                o[i] = saturate(v * src.scale);
+            }
+            break;
+        }
+        src.pos += n;
+        written += n;
+    }
+    return written;
+}
+
+std::size_t replay_source_read(int16_t* out, std::size_t count, void* ctx) {
+    return replay_read(*static_cast<ReplaySource*>(ctx), out, count);
+}
+
+const char* replay_error_name(ReplayError err) {
+    switch (err) {
+    case ReplayError::None: return "ok";
+    case ReplayError::OpenFailed: return "cannot open/map file";
+    case ReplayError::NotNpy: return "not a .npy array";
+    case ReplayError::UnsupportedDtype: return "unsupported dtype";
+    case ReplayError::FortranOrder: return "Fortran-order array";
+    case ReplayError::Truncated: return "truncated file";
+    case ReplayError::NotZip: return "not a zip archive";
+    case ReplayError::MemberNotFound: return "npz member not found";
+    case ReplayError::CompressedMember: return "npz member is compressed (np.savez_compressed); unzip it to .npy";
+    }
+    return "unknown";
+}
@@ -0,0 +1,93 @@
+#include "rf_batch.hpp"
+#include "autoencoder.hpp"
+#include "dsp_kernels.hpp"
+#include <algorithm>
+
+namespace {
+static_assert(sizeof(RfFeatureVector) == kFeatureBins * sizeof(float), "feature vectors must pack as [batch][bins]");
+
+// Samples a window actually holds; sample_count is not trusted past the array.
+std::size_t window_samples(const RFSampleWindow& w) {
+    return std::min(w.sample_count, w.samples.size());
+}
+
+// Packs sample pairs of each window into the batch-major layout fft_real_batch
+// expects, zero-padding/truncating to `n` samples.
+void pack_windows(std::complex<float>* out, const RFSampleWindow* windows, std::size_t batch, std::size_t n) {
+    const std::size_t half = n / 2;
+    for (std::size_t b = 0; b < batch; ++b) {
+        const RFSampleWindow& w = windows[b];
+        const std::size_t count = std::min(window_samples(w), n);
+        for (std::size_t m = 0; m < half; ++m) {
+            const std::size_t i = 2 * m;
+            const float re = i < count ? static_cast<float>(w.samples[i]) : 0.0f;
+            const float im = i + 1 < count ? static_cast<float>(w.samples[i + 1]) : 0.0f;
+            out[m * batch + b] = {re, im};
+        }
+    }
+}
+} // namespace
+
+bool rf_batch_init(RfBatchWorkspace& ws, std::size_t fft_size, std::size_t max_batch) {
+    const std::size_t n = std::min(fft_next_pow2(std::max<std::size_t>(fft_size, 2)), kMaxFftSize);
+    // One plan serves both the summary FFT and the model-input FFT.
+    if (max_batch == 0 || !fft_plan_init(ws.plan, std::max(n, kFeatureFftSize))) {
+        return false;
+    }
+    ws.fft_size = n;
+    ws.max_batch = max_batch;
+    ws.spectra.resize((n / 2 + 1) * max_batch);
+    ws.column.resize(n / 2 + 1);
+    ws.mags.resize(n / 2 + 1);
+    // At kFeatureFftSize the summary spectra are the model-input spectra too.
+    ws.feature_spectra.resize(n == kFeatureFftSize ? 0 : (kFeatureFftSize / 2 + 1) * max_batch);
+    ws.features.resize(max_batch);
+    ws.model_scratch.resize(autoencoder_batch_scratch_bytes(max_batch));
+    ws.mse.resize(max_batch);
+    return true;
+}
+
+std::size_t rf_batch_score(RfBatchWorkspace& ws, const RFSampleWindow* windows, std::size_t count, RFEvent* events) {
+    if (windows == nullptr || events == nullptr || ws.max_batch == 0) {
+        return 0;
+    }
+
+    const std::size_t bins = ws.fft_size / 2 + 1;
+    for (std::size_t start = 0; start < count; start += ws.max_batch) {
+        const std::size_t batch = std::min(ws.max_batch, count - start);
+        const RFSampleWindow* chunk = windows + start;
+        pack_windows(ws.spectra.data(), chunk, batch, ws.fft_size);
+        fft_real_batch(ws.plan, ws.spectra.data(), ws.fft_size, batch);
+        const std::complex<float>* feature_spectra = ws.spectra.data();
+        if (ws.fft_size != kFeatureFftSize) {
+            pack_windows(ws.feature_spectra.data(), chunk, batch, kFeatureFftSize);
+            fft_real_batch(ws.plan, ws.feature_spectra.data(), kFeatureFftSize, batch);
+            feature_spectra = ws.feature_spectra.data();
+        }
+        for (std::size_t b = 0; b < batch; ++b) {
+            feature_vector_from_spectrum(feature_spectra + b, batch, ws.features[b]);
+        }
+        autoencoder_reconstruction_error_batch(ws.features[0].bins.data(), batch, ws.model_scratch.data(),
+                                               ws.mse.data());
+
+        for (std::size_t b = 0; b < batch; ++b) {
+            RFEvent& ev = events[start + b];
+            ev = RFEvent{};
+            ev.timestamp_ms = chunk[b].timestamp_ms;
+            ev.center_freq_hz = chunk[b].center_freq_hz;
+            ev.model_version = 1;
+
+            const std::size_t n = std::min(window_samples(chunk[b]), ws.fft_size);
+            if (n != 0) {
+                for (std::size_t k = 0; k < bins; ++k) {
+                    ws.column[k] = ws.spectra[k * batch + b];
+                }
+                const MagnitudeStats stats =
+                    dsp_magnitude_stats(ws.column.data(), bins, 1.0f / static_cast<float>(n), ws.mags.data());
+                ev.features = features_from_magnitude_stats(stats, bins);
+            }
+            ev.anomaly_score = autoencoder_anomaly_score(ws.mse[b]);
+        }
+    }
+    return count;
+}
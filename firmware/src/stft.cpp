@@ -0,0 +1,86 @@
+#include "stft.hpp"
+#include <algorithm>
+#include <cmath>
+
+void build_window_table(WindowFunction fn, float* out, std::size_t n) {
+    constexpr double kTwoPi = 6.283185307179586476925286766559;
+    for (std::size_t i = 0; i < n; ++i) {
+        const double phase = kTwoPi * static_cast<double>(i) / static_cast<double>(n);
+        double w = 1.0;
+        switch (fn) {
+            case WindowFunction::Hann: w = 0.5 - 0.5 * std::cos(phase); break;
+            case WindowFunction::Hamming: w = 0.54 - 0.46 * std::cos(phase); break;
+            case WindowFunction::Blackman: w = 0.42 - 0.5 * std::cos(phase) + 0.08 * std::cos(2.0 * phase); break;
+            case WindowFunction::Rectangular:
+            default: w = 1.0; break;
+        }
+        out[i] = static_cast<float>(w);
+    }
+}
+
+bool stft_init(StftState& st, const StftConfig& cfg) {
+    if (cfg.hop_size == 0 || !fft_plan_init(st.plan, cfg.frame_size)) {
+        return false;
+    }
+    st.cfg = cfg;
+    st.window.resize(cfg.frame_size);
+    build_window_table(cfg.window, st.window.data(), cfg.frame_size);
+    double gain = 0.0;
+    for (float w : st.window) {
+        gain += w;
+    }
+    st.window_gain = static_cast<float>(gain);
+    st.ring.assign(2 * cfg.frame_size, 0);
+    st.spectrum.resize(cfg.frame_size / 2 + 1);
+    st.magnitudes.resize(cfg.frame_size / 2 + 1);
+    stft_reset(st);
+    return true;
+}
+
+void stft_reset(StftState& st) {
+    std::fill(st.ring.begin(), st.ring.end(), 0);
+    st.write_pos = 0;
+    st.until_next_frame = st.cfg.frame_size;
+    st.frames_emitted = 0;
+}
+
+std::size_t stft_push(StftState& st, const int16_t* samples, std::size_t count, uint32_t timestamp_ms,
+                      StftFrameHandler handler, void* ctx) {
+    const std::size_t frame = st.cfg.frame_size;
+    if (frame == 0 || samples == nullptr) {
+        return 0;
+    }
+
+    std::size_t emitted = 0;
+    std::size_t i = 0;
+    while (i < count) {
+        // Copy up to the next frame boundary in one run, mirroring into the upper half.
+        const std::size_t run = std::min(count - i, st.until_next_frame);
+        for (std::size_t r = 0; r < run; ++r) {
+            st.ring[st.write_pos] = samples[i + r];
+            st.ring[st.write_pos + frame] = samples[i + r];
+            st.write_pos = st.write_pos + 1 == frame ? 0 : st.write_pos + 1;
+        }
+        i += run;
+        st.until_next_frame -= run;
+        if (st.until_next_frame != 0) {
+            break;
+        }
+        st.until_next_frame = st.cfg.hop_size;
+
+        // write_pos is the oldest sample, so [write_pos, write_pos + frame) is the newest frame.
+        fft_real_windowed(st.plan, st.ring.data() + st.write_pos, st.window.data(), frame, st.spectrum.data());
+        StftFrame out{};
+        out.index = st.frames_emitted++;
+        out.timestamp_ms = timestamp_ms;
+        out.magnitudes = st.magnitudes.data();
+        out.bin_count = st.magnitudes.size();
+        out.stats = dsp_magnitude_stats(st.spectrum.data(), out.bin_count, 1.0f / st.window_gain,
+                                        st.magnitudes.data());
+        if (handler) {
+            handler(out, ctx);
+        }
+        ++emitted;
+    }
+    return emitted;
+}
@@ -1,13 +1,19 @@
 #include "tasks.hpp"
 #include "adc.hpp"
+#include "band_plan.hpp"
 #include "fault.hpp"
 #include "mesh.hpp"
 #include "model_inference.hpp"
 #include "ota.hpp"
+#include "prescreen.hpp"
 #include "sensors.hpp"
+#include "spsc_ring.hpp"
+#include "stft.hpp"
 #include "watchdog.hpp"
+#include "window_profile.hpp"
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstdio>
 #include <cstring>
 
@@ -19,8 +25,10 @@
 namespace {
 using TaskFn = void(*)(const NodeConfig&, uint32_t, TaskHeartbeat&);
 
+// Frames are queued sealed, so retries resend the same bytes without
+// re-encoding or re-encrypting.
 struct TransportItem {
-    MeshFrame frame{};
+    EncryptedFrame frame{};
     uint8_t attempts = 0;
     uint32_t next_attempt_ms = 0;
     bool in_use = false;
@@ -38,17 +46,17 @@ struct TransportQueue {
     bool full() const { return size >= depth; }
     bool empty() const { return size == 0; }
 
-    bool push(const MeshFrame& frame) {
-        if (full()) {
-            return false;
-        }
-        slots[tail].frame = frame;
+    // The caller seals straight into the reserved slot, then commits it.
+    EncryptedFrame* reserve() {
+        return full() ? nullptr : &slots[tail].frame;
+    }
+
+    void commit() {
         slots[tail].attempts = 0;
         slots[tail].next_attempt_ms = 0;
         slots[tail].in_use = true;
         tail = (tail + 1) % depth;
         size++;
-        return true;
     }
 
     TransportItem& front() {
@@ -65,8 +73,14 @@ struct TransportQueue {
     }
 };
 
+// Handles of captured windows waiting for FFTTflmTask. RFScanTask is the only
+// producer and FFTTflmTask the only consumer, so neither locks nor blocks; each
+// queued handle carries one pool reference.
+constexpr std::size_t kRfWindowQueueDepth = 4;
+
 struct TaskQueues {
-    RFSampleWindow last_rf_window{};
+    SpscRing<WindowHandle, kRfWindowQueueDepth> rf_windows;
+    std::atomic<uint32_t> latest_window{kNoWindow}; // last processed window, one reference held
     RFEvent last_rf_event{};
     GpsStatus last_gps{};
     HealthStatus last_health{};
@@ -75,8 +89,72 @@ struct TaskQueues {
 TaskQueues g_queues{};
 TransportQueue g_transport_queue{};
 uint32_t g_seq_no = 0;
+
+// What PacketBuilderTask last queued: the telemetry keyframe that delta
+// frames build on, and what went out outside the telemetry frame.
+struct SentState {
+    MeshFrame keyframe{};
+    bool keyframe_valid = false;
+    uint16_t since_keyframe = 0;
+    bool routing_valid = false;
+    uint32_t routing_version = 0;
+    uint32_t routing_ms = 0;
+    OtaState ota_state = OtaState::Idle;
+};
+SentState g_sent{};
 NodeConfig g_runtime_cfg{};
 
+// STFT stage between RFScanTask and the model. Each new capture window is
+// streamed through once; the strongest frame supplies the telemetry features.
+// Frames only overlap across windows that are contiguous in the capture.
+struct StftStage {
+    StftState state;
+    bool ready = false;
+    uint64_t next_sample = 0; // first_sample that continues the ring
+};
+
+struct StftBest {
+    RfFeatures features{};
+    bool found = false;
+};
+
+StftStage g_stft{};
+
+// Energy pre-screen, one noise floor per band (index 0 without a band plan).
+std::array<PrescreenState, kMaxBands> g_prescreen{};
+PrescreenStats g_prescreen_stats{};
+
+// Model input for the current window; static so it stays off the task stack.
+RfFeatureVector g_feature_vector{};
+
+void on_stft_frame(const StftFrame& frame, void* ctx) {
+    auto* best = static_cast<StftBest*>(ctx);
+    const RfFeatures features = features_from_magnitude_stats(frame.stats, frame.bin_count);
+    if (!best->found || features.peak_dbm > best->features.peak_dbm) {
+        best->features = features;
+        best->found = true;
+    }
+}
+
+float score_window(const RfWindow& window) {
+    if (!extract_rf_feature_vector(window.samples, window.sample_count, g_feature_vector)) {
+        return 0.0f;
+    }
+    return run_model_inference(g_feature_vector);
+}
+
+bool ensure_stft(const NodeConfig& cfg) {
+    if (g_stft.ready) {
+        return true;
+    }
+    StftConfig stft_cfg{};
+    stft_cfg.frame_size = std::min(fft_next_pow2(std::max<std::size_t>(cfg.fft_size, 2)), kMaxFftSize);
+    stft_cfg.hop_size = cfg.stft_hop_size ? cfg.stft_hop_size : stft_cfg.frame_size / 2;
+    stft_cfg.window = static_cast<WindowFunction>(cfg.stft_window);
+    g_stft.ready = stft_init(g_stft.state, stft_cfg);
+    return g_stft.ready;
+}
+
 TaskStatus g_status{
     {"TransportTask", 0},
     {"RFScanTask", 0},
@@ -104,11 +182,17 @@ void touch(TaskHeartbeat& hb, uint32_t now_ms) {
     hb.last_beat_ms = now_ms;
 }
 
-bool enqueue_transport(const MeshFrame& frame) {
-    if (!g_transport_queue.push(frame)) {
+bool enqueue_transport(const MeshFrame& frame, const MeshFrame* keyframe = nullptr) {
+    EncryptedFrame* slot = g_transport_queue.reserve();
+    if (slot == nullptr) {
         record_fault("Transport queue full");
         return false;
     }
+    if (!seal_mesh_frame(frame, *slot, keyframe)) {
+        record_fault("Transport seal failed");
+        return false;
+    }
+    g_transport_queue.commit();
     return true;
 }
 
@@ -121,7 +205,7 @@ void service_transport_queue(uint32_t now_ms) {
         return;
     }
 
-    const bool ok = send_mesh_frame(item.frame);
+    const bool ok = send_sealed_frame(item.frame);
     if (ok) {
         g_transport_queue.pop();
         return;
@@ -138,21 +222,123 @@ void service_transport_queue(uint32_t now_ms) {
 }
 
 void rf_scan_task(const NodeConfig& cfg, uint32_t now_ms, TaskHeartbeat& hb) {
-    g_queues.last_rf_window = collect_rf_window(now_ms);
-    g_queues.last_rf_window.center_freq_hz = cfg.rf_center_freq_hz;
+    if (!adc_capture_running()) {
+        // Window length is fixed for the capture's lifetime; normally already
+        // selected by init_model_inference(cfg).
+        if (!window_profile_select(cfg.fft_size)) {
+            record_fault("Window profile allocation failed");
+        }
+        AdcCaptureConfig capture_cfg{};
+        capture_cfg.sample_rate_hz = cfg.adc_sample_rate_hz;
+        capture_cfg.decimation = cfg.decimation;
+        if (cfg.band_count != 0 && !band_plan_active()) {
+            if (!band_plan_init(cfg)) {
+                record_fault("Band plan invalid");
+            }
+            // Resolved entries, so Goertzel bins refer to each band's own window length.
+            for (std::size_t i = 0; i < band_plan_count(); ++i) {
+                if (!set_band_feature_backend(static_cast<uint8_t>(i), *band_plan_band(i))) {
+                    record_fault("Band feature backend invalid");
+                }
+            }
+        }
+        if (band_plan_active()) {
+            // Retunes happen at capture window boundaries, not in this task.
+            capture_cfg.scheduler = band_plan_next_window;
+            band_plan_set_tuner(adc_frontend_tune, nullptr);
+        }
+        if (!adc_capture_start(capture_cfg)) {
+            record_fault("ADC capture start failed");
+        } else if (band_plan_active()) {
+            adc_capture_want_band(0);
+        }
+    }
+    // The captured window's handle moves into the queue; the samples stay put.
+    // A full queue leaves the window in the capture handoff and counts an overrun.
+    if (adc_capture_pending()) {
+        if (WindowHandle* slot = g_queues.rf_windows.try_reserve()) {
+            const WindowHandle h = adc_capture_take_handle();
+            if (h != kNoWindow) {
+                if (!band_plan_active()) {
+                    window_pool_get(h)->center_freq_hz = cfg.rf_center_freq_hz;
+                } else {
+                    // One window per band in turn, so a sweep period that
+                    // divides this task's period cannot starve a band.
+                    const uint8_t band = window_pool_get(h)->band;
+                    adc_capture_want_band(static_cast<uint8_t>((band + 1u) % band_plan_count()));
+                }
+                *slot = h;
+                g_queues.rf_windows.commit();
+            }
+        }
+    }
     touch(hb, now_ms);
 }
 
 void fft_task(const NodeConfig& cfg, uint32_t now_ms, TaskHeartbeat& hb) {
-    const RfFeatures features = extract_rf_features(g_queues.last_rf_window);
-    const float score = run_model_inference(features);
-
-    g_queues.last_rf_event.timestamp_ms = now_ms;
-    g_queues.last_rf_event.center_freq_hz = cfg.rf_center_freq_hz;
-    g_queues.last_rf_event.features = features;
-    g_queues.last_rf_event.anomaly_score = score;
-    g_queues.last_rf_event.model_version = 1;
+    select_rf_feature_band(static_cast<uint8_t>(kMaxBands));
+    RfFeatureBackend backend = rf_feature_backend();
+    bool float_path = backend == RfFeatureBackend::RealFft || backend == RfFeatureBackend::ComplexFft;
+    bool updated = false;
+    // Each queued window is processed exactly once; an empty queue counts an
+    // underrun and keeps the previous event.
+    if (const WindowHandle* handle = g_queues.rf_windows.front()) {
+        const RfWindow* window = window_pool_get(*handle);
+        bool analyze = true;
+        if (cfg.prescreen.enabled) {
+            const float energy = window_ac_energy(window->samples, window->sample_count);
+            PrescreenState& screen = g_prescreen[window->band < kMaxBands ? window->band : 0];
+            analyze = prescreen_update(screen, cfg.prescreen, energy, &g_prescreen_stats) != PrescreenDecision::Skip;
+        }
+        if (!analyze) {
+            // Quiet window: no transform or inference; the last event stands.
+        } else if (band_plan_active()) {
+            // Consecutive windows may come from different tunings, so the STFT
+            // ring (which overlaps frames across windows) is bypassed and each
+            // window is scored on its own against its band's state.
+            // PacketBuilderTask reports the worst band since its last frame.
+            select_rf_feature_band(window->band);
+            backend = rf_feature_backend();
+            float_path = backend == RfFeatureBackend::RealFft || backend == RfFeatureBackend::ComplexFft;
+            const RfFeatures features = extract_rf_features(window->samples, window->sample_count);
+            const float score = float_path ? score_window(*window) : run_model_inference(features);
+            band_plan_record(window->band, features, score, now_ms);
+        } else if (!float_path || !ensure_stft(cfg)) {
+            // Fixed-point and Goertzel backends keep the single-window scalar path.
+            const RfFeatures features = extract_rf_features(window->samples, window->sample_count);
+            g_queues.last_rf_event.features = features;
+            g_queues.last_rf_event.anomaly_score = float_path ? score_window(*window) : run_model_inference(features);
+            updated = true;
+        } else {
+            // Skipped and dropped windows (the capture keeps only the newest)
+            // leave a gap; restart the ring rather than overlap frames across it.
+            if (window->first_sample != g_stft.next_sample) {
+                stft_reset(g_stft.state);
+            }
+            g_stft.next_sample = window->first_sample + window->sample_count;
+            StftBest best{};
+            stft_push(g_stft.state, window->samples, window->sample_count, window->timestamp_ms,
+                      on_stft_frame, &best);
+            // No frame yet (ring still filling) keeps the previous event.
+            if (best.found) {
+                g_queues.last_rf_event.features = best.features;
+                g_queues.last_rf_event.anomaly_score = score_window(*window);
+                updated = true;
+            }
+        }
+        if (updated) {
+            g_queues.last_rf_event.center_freq_hz = window->center_freq_hz;
+            g_queues.last_rf_event.band = window->band;
+        }
+        // The queue's reference becomes the snapshot reference.
+        window_pool_release(static_cast<WindowHandle>(g_queues.latest_window.exchange(*handle)));
+        g_queues.rf_windows.pop();
+    }
 
+    if (updated) {
+        g_queues.last_rf_event.timestamp_ms = now_ms;
+        g_queues.last_rf_event.model_version = 1;
+    }
     touch(hb, now_ms);
 }
 
@@ -168,10 +354,11 @@ void health_task(const NodeConfig& cfg, uint32_t now_ms, TaskHeartbeat& hb) {
     touch(hb, now_ms);
 }
 
-void packet_builder_task(const NodeConfig& cfg, uint32_t now_ms, TaskHeartbeat& hb) {
+// Envelope shared by every message type; takes the next sequence number.
+MeshFrame make_frame(const NodeConfig& cfg, MeshMsgType type) {
     MeshFrame frame{};
-    frame.header.version = 1;
-    frame.header.msg_type = MeshMsgType::Telemetry;
+    frame.header.version = cfg.mesh_schema_version;
+    frame.header.msg_type = type;
     frame.header.ttl = 4;
     frame.header.hop_count = 0;
     frame.header.seq_no = ++g_seq_no;
@@ -187,17 +374,64 @@ void packet_builder_task(const NodeConfig& cfg, uint32_t now_ms, TaskHeartbeat&
 
     frame.counters.tx_counter = g_seq_no;
     frame.counters.replay_window = 0;
+    return frame;
+}
 
+void packet_builder_task(const NodeConfig& cfg, uint32_t now_ms, TaskHeartbeat& hb) {
+    MeshFrame frame = make_frame(cfg, MeshMsgType::Telemetry);
+    BandReport report{};
+    if (band_plan_active() && band_plan_take_report(report)) {
+        RFEvent& ev = g_queues.last_rf_event;
+        ev.features = report.features;
+        ev.anomaly_score = report.score;
+        ev.band = report.band;
+        ev.center_freq_hz = band_plan_band(report.band)->center_freq_hz;
+        ev.timestamp_ms = report.timestamp_ms;
+        ev.model_version = 1;
+    }
     frame.telemetry.rf_event = g_queues.last_rf_event;
     frame.telemetry.gps = g_queues.last_gps;
     frame.telemetry.health = g_queues.last_health;
-
-    frame.routing = current_routing_payload();
-    frame.routing.epoch_ms = now_ms;
     frame.fault = fault_status();
-    frame.ota = ota_status();
+    // Every telemetry_keyframe_interval-th frame is a keyframe; the ones in
+    // between carry only what moved since it. A keyframe that failed to queue
+    // is not built on.
+    const bool delta = g_sent.keyframe_valid && g_sent.since_keyframe + 1u < cfg.telemetry_keyframe_interval;
+    if (delta) {
+        frame.header.ref_seq_no = g_sent.keyframe.header.seq_no;
+        if (enqueue_transport(frame, &g_sent.keyframe)) {
+            g_sent.since_keyframe++;
+        }
+    } else if (enqueue_transport(frame)) {
+        g_sent.keyframe = frame;
+        g_sent.keyframe_valid = true;
+        g_sent.since_keyframe = 0;
+    }
+
+    // The route table and OTA status travel in their own frames: routing when
+    // the table changes and at least every heartbeat_interval_ms, OTA while an
+    // update is in progress and once on returning to idle.
+    const MeshRoutingPayload routing = current_routing_payload();
+    if (!g_sent.routing_valid || routing.version != g_sent.routing_version ||
+        now_ms - g_sent.routing_ms >= cfg.heartbeat_interval_ms) {
+        MeshFrame update = make_frame(cfg, MeshMsgType::Routing);
+        update.routing = routing;
+        update.routing.epoch_ms = now_ms;
+        if (enqueue_transport(update)) {
+            g_sent.routing_valid = true;
+            g_sent.routing_version = routing.version;
+            g_sent.routing_ms = now_ms;
+        }
+    }
 
-    enqueue_transport(frame);
+    const OtaStatus ota = ota_status();
+    if (ota.state != OtaState::Idle || g_sent.ota_state != OtaState::Idle) {
+        MeshFrame update = make_frame(cfg, MeshMsgType::Ota);
+        update.ota = ota;
+        if (enqueue_transport(update)) {
+            g_sent.ota_state = ota.state;
+        }
+    }
     touch(hb, now_ms);
 }
 
@@ -286,6 +520,30 @@ const std::array<TaskConfig, kTaskCount>& task_plan() {
     return kPlan;
 }
 
+SpscRingStats rf_window_queue_stats() {
+    return g_queues.rf_windows.stats();
+}
+
+PrescreenStats prescreen_stats() {
+    return g_prescreen_stats;
+}
+
+WindowHandle acquire_latest_rf_window() {
+    // Retain under the slot so FFTTflmTask cannot release it in between: swap
+    // the slot empty, add the caller's reference, then put it back unless a
+    // newer window arrived meanwhile.
+    const auto h = static_cast<WindowHandle>(g_queues.latest_window.exchange(kNoWindow));
+    if (h == kNoWindow) {
+        return kNoWindow;
+    }
+    window_pool_retain(h);
+    uint32_t expected = kNoWindow;
+    if (!g_queues.latest_window.compare_exchange_strong(expected, h)) {
+        window_pool_release(h);
+    }
+    return h;
+}
+
 TaskStatus run_firmware_cycle(const NodeConfig& cfg, uint32_t now_ms) {
     auto& slots = task_slots();
 
@@ -0,0 +1,78 @@
+#include "window_pool.hpp"
+#include "window_profile.hpp"
+
+#include <array>
+#include <atomic>
+#include <cassert>
+
+namespace {
+std::array<RfWindow, kWindowPoolSize> g_windows{};
+std::array<std::atomic<uint32_t>, kWindowPoolSize> g_refs{};
+std::atomic<uint32_t> g_in_use{0};
+std::atomic<uint32_t> g_high_water{0};
+std::atomic<uint32_t> g_exhausted{0};
+
+bool valid(WindowHandle h) {
+    return h < kWindowPoolSize;
+}
+} // namespace
+
+WindowHandle window_pool_acquire() {
+    for (std::size_t i = 0; i < kWindowPoolSize; ++i) {
+        uint32_t expected = 0;
+        if (g_refs[i].compare_exchange_strong(expected, 1, std::memory_order_acquire, std::memory_order_relaxed)) {
+            // Only the acquirer touches the window until it hands the handle on,
+            // so storage is resolved here; the profile cannot change while any
+            // window is held.
+            g_windows[i].samples = window_profile_samples(i);
+            const uint32_t in_use = g_in_use.fetch_add(1, std::memory_order_relaxed) + 1;
+            uint32_t high = g_high_water.load(std::memory_order_relaxed);
+            while (in_use > high &&
+                   !g_high_water.compare_exchange_weak(high, in_use, std::memory_order_relaxed)) {
+            }
+            return static_cast<WindowHandle>(i);
+        }
+    }
+    g_exhausted.fetch_add(1, std::memory_order_relaxed);
+    return kNoWindow;
+}
+
+void window_pool_retain(WindowHandle h) {
+    if (!valid(h)) {
+        return;
+    }
+    const uint32_t prev = g_refs[h].fetch_add(1, std::memory_order_relaxed);
+    assert(prev > 0 && "retain of a free window");
+    (void)prev;
+}
+
+void window_pool_release(WindowHandle h) {
+    if (!valid(h)) {
+        return;
+    }
+    // acq_rel so the last holder's reads finish before the next acquirer writes.
+    const uint32_t prev = g_refs[h].fetch_sub(1, std::memory_order_acq_rel);
+    assert(prev > 0 && "release of a free window");
+    if (prev == 1) {
+        g_in_use.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
+RfWindow* window_pool_get(WindowHandle h) {
+    if (!valid(h)) {
+        return nullptr;
+    }
+    return &g_windows[h];
+}
+
+uint32_t window_pool_refcount(WindowHandle h) {
+    return valid(h) ? g_refs[h].load(std::memory_order_relaxed) : 0;
+}
+
+WindowPoolStats window_pool_stats() {
+    WindowPoolStats stats{};
+    stats.in_use = g_in_use.load(std::memory_order_relaxed);
+    stats.high_water = g_high_water.load(std::memory_order_relaxed);
+    stats.exhausted = g_exhausted.load(std::memory_order_relaxed);
+    return stats;
+}
@@ -0,0 +1,113 @@
+#include "window_profile.hpp"
+#include "window_pool.hpp"
+
+#include <array>
+#include <complex>
+#include <memory>
+#include <new>
+
+namespace {
+template <std::size_t N>
+struct ProfileBuffers {
+    static_assert(N >= kMinWindowSamples && N <= kMaxWindowSamples && (N & (N - 1)) == 0,
+                  "window length must be a power of two in 64..4096");
+    static constexpr std::size_t kBins = N / 2 + 1;
+
+    std::array<std::array<int16_t, N>, kWindowPoolSize> windows;
+    std::array<std::complex<float>, kBins> spectrum;
+    std::array<float, kBins> mags;
+    FftPlan plan;
+};
+
+// Type-erased entry points of the active specialization.
+struct ProfileOps {
+    int16_t* (*samples)(void* buffers, std::size_t index);
+    MagnitudeStats (*spectrum)(void* buffers, const int16_t* samples, const float** mags_out);
+    void (*destroy)(void* buffers);
+};
+
+template <std::size_t N>
+int16_t* profile_samples(void* buffers, std::size_t index) {
+    return static_cast<ProfileBuffers<N>*>(buffers)->windows[index].data();
+}
+
+template <std::size_t N>
+MagnitudeStats profile_spectrum(void* buffers, const int16_t* samples, const float** mags_out) {
+    auto& b = *static_cast<ProfileBuffers<N>*>(buffers);
+    fft_real(b.plan, samples, N, N, b.spectrum.data());
+    if (mags_out != nullptr) {
+        *mags_out = b.mags.data();
+    }
+    return dsp_magnitude_stats(b.spectrum.data(), ProfileBuffers<N>::kBins, 1.0f / static_cast<float>(N),
+                               b.mags.data());
+}
+
+template <std::size_t N>
+void profile_destroy(void* buffers) {
+    delete static_cast<ProfileBuffers<N>*>(buffers);
+}
+
+WindowProfile g_profile{};
+ProfileOps g_ops{};
+void* g_buffers = nullptr;
+
+template <std::size_t N>
+bool activate() {
+    std::unique_ptr<ProfileBuffers<N>> buffers(new (std::nothrow) ProfileBuffers<N>());
+    if (!buffers || !fft_plan_init(buffers->plan, N)) {
+        return false;
+    }
+    if (g_buffers != nullptr) {
+        g_ops.destroy(g_buffers);
+    }
+    g_buffers = buffers.release();
+    g_ops = {profile_samples<N>, profile_spectrum<N>, profile_destroy<N>};
+    g_profile.samples = N;
+    g_profile.bins = ProfileBuffers<N>::kBins;
+    g_profile.bytes = sizeof(ProfileBuffers<N>) + (N / 2) * sizeof(std::complex<float>) + N * sizeof(uint16_t);
+    return true;
+}
+} // namespace
+
+bool window_profile_select(std::size_t fft_size) {
+    std::size_t n = fft_next_pow2(fft_size);
+    n = n < kMinWindowSamples ? kMinWindowSamples : (n > kMaxWindowSamples ? kMaxWindowSamples : n);
+    if (n == g_profile.samples) {
+        return true;
+    }
+    // Held windows point into the current storage; nothing to move before the first select.
+    if (g_buffers != nullptr && window_pool_stats().in_use != 0) {
+        return false;
+    }
+    switch (n) {
+    case 64: return activate<64>();
+    case 128: return activate<128>();
+    case 256: return activate<256>();
+    case 512: return activate<512>();
+    case 1024: return activate<1024>();
+    case 2048: return activate<2048>();
+    case 4096: return activate<4096>();
+    default: return false;
+    }
+}
+
+const WindowProfile& window_profile() {
+    if (g_buffers == nullptr) {
+        window_profile_select(kDefaultWindowSamples);
+    }
+    return g_profile;
+}
+
+int16_t* window_profile_samples(std::size_t index) {
+    if (index >= kWindowPoolSize || window_profile().samples == 0) {
+        return nullptr;
+    }
+    return g_ops.samples(g_buffers, index);
+}
+
+MagnitudeStats window_profile_spectrum(const int16_t* samples, const float** mags_out) {
+    if (samples == nullptr || window_profile().samples == 0) {
+        return {0.0f, 0.0f};
+    }
+    return g_ops.spectrum(g_buffers, samples, mags_out);
+}
@@ -0,0 +1,82 @@
+#include "autoencoder.hpp"
+#include "model_inference.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+#ifndef OL_TEST_DATA_DIR
+#define OL_TEST_DATA_DIR "../tests"
+#endif
+
+struct GoldenVector {
+    int label = 0;
+    float mse_float = 0.0f; // Python float model
+    float mse_int8 = 0.0f;  // Python int8 simulation of this engine
+    std::vector<float> features;
+};
+
+static std::vector<GoldenVector> load_golden() {
+    std::ifstream f(OL_TEST_DATA_DIR "/autoencoder_golden.txt");
+    std::size_t count = 0;
+    std::size_t width = 0;
+    f >> count >> width;
+    assert(width == kAutoencoderInputs);
+    std::vector<GoldenVector> out(count);
+    for (GoldenVector& g : out) {
+        f >> g.label >> g.mse_float >> g.mse_int8;
+        g.features.resize(width);
+        for (float& v : g.features) {
+            f >> v;
+        }
+    }
+    assert(f.good());
+    return out;
+}
+
+int main() {
+    const std::vector<GoldenVector> golden = load_golden();
+    assert(golden.size() == 24);
+    const float threshold = autoencoder_mse_threshold();
+
+    std::size_t agree = 0;
+    double rel_err_sum = 0.0;
+    float normal_max = 0.0f;
+    float anomaly_min = 1.0f;
+    for (const GoldenVector& g : golden) {
+        const float mse = autoencoder_reconstruction_error(g.features.data());
+        // Same integer pipeline as the exporter: only the final float sum may differ.
+        assert(std::fabs(mse - g.mse_int8) <= 1e-5f * g.mse_int8);
+        // Accuracy vs the float model.
+        const double rel = std::fabs(mse - g.mse_float) / g.mse_float;
+        assert(rel < 0.15);
+        rel_err_sum += rel;
+        if ((mse > threshold) == (g.mse_float > threshold)) {
+            ++agree;
+        }
+
+        const float score = run_model_inference(g.features.data(), g.features.size());
+        assert(score >= 0.0f && score <= 1.0f);
+        if (g.label == 0) {
+            normal_max = std::max(normal_max, score);
+        } else {
+            anomaly_min = std::min(anomaly_min, score);
+        }
+    }
+    const double mean_rel = rel_err_sum / static_cast<double>(golden.size());
+    assert(mean_rel < 0.05);
+    assert(agree == golden.size());
+    // The golden set is separable at the calibrated threshold (score 0.5).
+    assert(normal_max < 0.5f && anomaly_min > 0.5f);
+
+    assert(run_model_inference(golden[0].features.data(), 64) == 0.0f);
+    assert(autoencoder_arena_bytes() <= 1024);
+
+    std::printf("test_autoencoder passed: mean rel err vs float %.4f, agreement %zu/%zu\n", mean_rel, agree,
+                golden.size());
+    (void)mean_rel;
+    return 0;
+}
@@ -0,0 +1,245 @@
+#include "adc.hpp"
+#include "band_plan.hpp"
+#include "config.hpp"
+#include "window_pool.hpp"
+#include "window_profile.hpp"
+
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+namespace {
+struct TuneLog {
+    std::vector<uint32_t> freqs;
+    std::vector<int8_t> gains;
+};
+
+bool record_tune(const BandConfig& band, void* ctx) {
+    auto* log = static_cast<TuneLog*>(ctx);
+    log->freqs.push_back(band.center_freq_hz);
+    log->gains.push_back(band.gain_db);
+    return true;
+}
+
+NodeConfig three_band_config() {
+    NodeConfig cfg = load_config();
+    cfg.fft_size = 128;
+    cfg.adc_sample_rate_hz = 20000;
+    cfg.retune_settle_us = 100; // 2 samples at 20 kHz
+    cfg.band_count = 3;
+    cfg.bands[0] = {433920000, 5, 64, 10, 0.5f, {}, 0, 0};  // 100 samples -> 2 windows of 64
+    cfg.bands[1] = {868000000, 1, 0, 20, 0.0f, {}, 0, 0};   // fft_size/threshold from the node
+    cfg.bands[2] = {915000000, 5, 100, 30, 0.0f, {}, 0, 0}; // 100 rounds up to 128
+    return cfg;
+}
+
+void test_init() {
+    NodeConfig cfg = three_band_config();
+    bool ok = band_plan_init(cfg);
+    assert(ok);
+    (void)ok;
+    assert(band_plan_active());
+    assert(band_plan_count() == 3);
+    assert(band_plan_band(0)->fft_size == 64);
+    assert(band_plan_band(1)->fft_size == 128);
+    assert(band_plan_band(1)->anomaly_threshold == cfg.anomaly_threshold);
+    assert(band_plan_band(2)->fft_size == 128);
+    assert(band_plan_band(3) == nullptr);
+
+    NodeConfig bad = cfg;
+    bad.bands[1].center_freq_hz = 0;
+    ok = band_plan_init(bad);
+    assert(!ok && !band_plan_active());
+    bad = cfg;
+    bad.band_count = kMaxBands + 1;
+    ok = band_plan_init(bad);
+    assert(!ok);
+    ok = band_plan_init(load_config()); // no plan configured
+    assert(!ok);
+}
+
+// Drives capture one sample at a time and takes every window as it completes,
+// checking that each band's windows land on the right tuning and that the
+// retune to band k+1 has already happened when band k's last window is handed out.
+void test_sweep_schedule() {
+    TuneLog log;
+    const bool ok = band_plan_init(three_band_config()) && window_profile_select(128);
+    assert(ok);
+    (void)ok;
+    band_plan_set_tuner(record_tune, &log);
+
+    AdcCaptureConfig capture{};
+    capture.sample_rate_hz = 20000;
+    capture.start_producer = false;
+    capture.scheduler = band_plan_next_window;
+    const bool started = adc_capture_start(capture);
+    assert(started);
+    (void)started;
+    assert(log.freqs.size() == 1); // tuned for band 0 before the first sample
+
+    struct Expected {
+        uint64_t first;
+        uint8_t band;
+        uint32_t freq;
+        std::size_t count;
+        std::size_t tunes_when_taken;
+    };
+    // Each retune discards 2 settling samples ahead of the band's first window.
+    const Expected expected[] = {
+        {2, 0, 433920000, 64, 1},
+        {66, 0, 433920000, 64, 2},
+        {132, 1, 868000000, 128, 3},
+        {262, 2, 915000000, 128, 4},
+        {392, 0, 433920000, 64, 4},
+    };
+    std::size_t taken = 0;
+    for (int16_t i = 0; i < 456; ++i) {
+        adc_capture_ingest(&i, 1);
+        uint64_t first = 0;
+        const WindowHandle h = adc_capture_take_handle(&first);
+        if (h == kNoWindow) {
+            continue;
+        }
+        assert(taken < 5);
+        const Expected& e = expected[taken];
+        const RfWindow* w = window_pool_get(h);
+        assert(first == e.first);
+        assert(w->band == e.band);
+        assert(w->center_freq_hz == e.freq);
+        assert(w->sample_count == e.count);
+        assert(w->samples[0] == static_cast<int16_t>(e.first));
+        assert(w->samples[w->sample_count - 1] == static_cast<int16_t>(e.first + e.count - 1));
+        assert(log.freqs.size() == e.tunes_when_taken);
+        (void)w;
+        (void)e;
+        window_pool_release(h);
+        ++taken;
+    }
+    assert(taken == 5);
+    assert(log.gains[1] == 20 && log.gains[2] == 30);
+
+    const AdcCaptureStats stats = adc_capture_stats();
+    assert(stats.samples_skipped == 8);
+    assert(stats.windows_dropped == 0);
+    (void)stats;
+    const BandPlanStats plan = band_plan_stats();
+    assert(plan.retunes == 4 && plan.retune_failures == 0 && plan.sweeps == 1);
+    (void)plan;
+    adc_capture_stop();
+    band_plan_set_tuner(nullptr, nullptr);
+}
+
+// A single-band plan tunes once and keeps capturing without settle gaps.
+void test_single_band() {
+    NodeConfig cfg = three_band_config();
+    cfg.band_count = 1;
+    const bool ok = band_plan_init(cfg);
+    assert(ok);
+    (void)ok;
+    AdcWindowPlan p = band_plan_next_window(0, nullptr);
+    assert(p.skip == 2 && p.samples == 64 && p.band == 0);
+    p = band_plan_next_window(130, nullptr);
+    assert(p.skip == 0 && p.center_freq_hz == 433920000);
+    assert(band_plan_stats().retunes == 1);
+    assert(band_plan_stats().sweeps == 1);
+}
+
+void test_band_state() {
+    const bool ok = band_plan_init(three_band_config());
+    assert(ok);
+    (void)ok;
+    bool anomaly = band_plan_record(0, {-60.0f, -50.0f}, 0.1f, 10);
+    (void)anomaly;
+    assert(!anomaly && band_state(0)->noise_floor_dbm == -60.0f);
+    anomaly = band_plan_record(0, {-52.0f, -45.0f}, 0.1f, 20);
+    assert(!anomaly && std::fabs(band_state(0)->noise_floor_dbm - -59.0f) < 1e-4f);
+    // Above band 0's own threshold: counted, and kept out of the noise floor.
+    anomaly = band_plan_record(0, {-20.0f, -5.0f}, 0.6f, 30);
+    assert(anomaly && std::fabs(band_state(0)->noise_floor_dbm - -59.0f) < 1e-4f);
+    assert(band_state(0)->windows == 3 && band_state(0)->anomalies == 1);
+    assert(band_state(0)->last_timestamp_ms == 30);
+    // Band 1 inherits the node threshold (0.8), so the same score is quiet there.
+    anomaly = band_plan_record(1, {-70.0f, -60.0f}, 0.6f, 40);
+    assert(!anomaly && band_state(1)->noise_floor_dbm == -70.0f);
+    assert(band_state(2)->windows == 0);
+    anomaly = band_plan_record(7, {-70.0f, -60.0f}, 0.9f, 50);
+    assert(!anomaly && band_state(7) == nullptr);
+}
+
+// The report is the band furthest above (or least below) its own threshold
+// since the last take.
+void test_report() {
+    const bool ok = band_plan_init(three_band_config());
+    assert(ok);
+    (void)ok;
+    BandReport report{};
+    bool taken = band_plan_take_report(report);
+    (void)taken;
+    assert(!taken);
+    band_plan_record(1, {-70.0f, -60.0f}, 0.7f, 10); // 0.1 under the node threshold
+    band_plan_record(0, {-60.0f, -50.0f}, 0.3f, 20); // 0.2 under its own 0.5
+    taken = band_plan_take_report(report);
+    assert(taken && report.band == 1 && !report.anomaly && report.timestamp_ms == 10);
+    taken = band_plan_take_report(report);
+    assert(!taken);
+    // A crossing wins over a higher score that stayed under its threshold.
+    band_plan_record(0, {-30.0f, -10.0f}, 0.55f, 30);
+    band_plan_record(1, {-70.0f, -60.0f}, 0.75f, 40);
+    band_plan_record(2, {-70.0f, -60.0f}, 0.1f, 50);
+    taken = band_plan_take_report(report);
+    assert(taken && report.band == 0 && report.anomaly);
+    assert(report.score == 0.55f && report.features.peak_dbm == -10.0f);
+    (void)report;
+}
+
+// Four one-window bands whose sweep lines up with the consumer: without the
+// band filter every take would see the same band, with it the takes rotate.
+// The front end hears every retune.
+void test_band_rotation() {
+    NodeConfig cfg = three_band_config();
+    cfg.retune_settle_us = 0;
+    cfg.band_count = 4;
+    for (std::size_t i = 0; i < 4; ++i) {
+        cfg.bands[i] = {static_cast<uint32_t>(900000000 + i), 1, 64, static_cast<int8_t>(i), 0.0f, {}, 0, 0};
+    }
+    const bool ok = band_plan_init(cfg) && window_profile_select(128);
+    assert(ok);
+    (void)ok;
+    band_plan_set_tuner(adc_frontend_tune, nullptr);
+    AdcCaptureConfig capture{};
+    capture.start_producer = false;
+    capture.scheduler = band_plan_next_window;
+    const bool started = adc_capture_start(capture);
+    assert(started);
+    (void)started;
+
+    std::vector<int16_t> sweep(4 * 64, 0);
+    for (uint8_t expected = 0; expected < 8; ++expected) {
+        adc_capture_want_band(expected % 4);
+        adc_capture_ingest(sweep.data(), sweep.size());
+        const WindowHandle h = adc_capture_take_handle();
+        assert(h != kNoWindow && window_pool_get(h)->band == expected % 4);
+        window_pool_release(h);
+    }
+    const AdcCaptureStats stats = adc_capture_stats();
+    assert(stats.windows_completed == 32 && stats.windows_filtered == 24 && stats.windows_dropped == 0);
+    (void)stats;
+    const AdcFrontEnd fe = adc_frontend();
+    assert(fe.tunes == band_plan_stats().retunes && fe.center_freq_hz == 900000000 && fe.gain_db == 0);
+    (void)fe;
+    adc_capture_stop();
+    band_plan_set_tuner(nullptr, nullptr);
+}
+} // namespace
+
+int main() {
+    test_init();
+    test_sweep_schedule();
+    test_single_band();
+    test_band_state();
+    test_report();
+    test_band_rotation();
+    std::printf("band plan tests passed\n");
+    return 0;
+}
@@ -0,0 +1,141 @@
+#include "decimator.hpp"
+
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+namespace {
+constexpr double kPi = 3.14159265358979323846;
+
+// RMS gain for a tone at `f_out` cycles per output sample, after the filters settle.
+double tone_gain(uint16_t factor, double f_out, uint8_t order = kDefaultCicOrder) {
+    Decimator dec;
+    const bool ok = decimator_init(dec, factor, order);
+    assert(ok);
+    (void)ok;
+    constexpr std::size_t kOutputs = 1024;
+    constexpr double kAmp = 8000.0;
+    std::vector<int16_t> in(kOutputs * factor);
+    for (std::size_t i = 0; i < in.size(); ++i) {
+        in[i] = static_cast<int16_t>(std::lround(kAmp * std::sin(2.0 * kPi * f_out / factor * i)));
+    }
+    std::vector<int16_t> out(kOutputs + 1);
+    const std::size_t n = decimator_process(dec, in.data(), in.size(), out.data());
+    assert(n == kOutputs);
+    double energy = 0.0;
+    for (std::size_t i = 64; i < n; ++i) {
+        energy += static_cast<double>(out[i]) * out[i];
+    }
+    return std::sqrt(energy / static_cast<double>(n - 64)) / (kAmp / std::sqrt(2.0));
+}
+
+void test_init() {
+    Decimator dec;
+    bool ok = decimator_init(dec, 0);
+    (void)ok;
+    assert(!ok);
+    ok = decimator_init(dec, 256);
+    assert(!ok);
+    ok = decimator_init(dec, 8, 0);
+    assert(!ok);
+    ok = decimator_init(dec, 8, kMaxCicOrder + 1);
+    assert(!ok);
+    // CIC x32 at order 4 needs 20 bits of growth.
+    ok = decimator_init(dec, 64, 4);
+    assert(!ok);
+    ok = decimator_init(dec, 8);
+    assert(ok && dec.cic_factor == 4 && dec.fir_factor == 2 && dec.cic_shift == 6);
+    ok = decimator_init(dec, 5);
+    assert(ok && dec.cic_factor == 5 && dec.fir_factor == 1 && dec.cic_shift == 7);
+
+    // Factor 1 passes samples through untouched.
+    ok = decimator_init(dec, 1);
+    assert(ok);
+    const int16_t in[4] = {1, -2, 3, -4};
+    int16_t out[4] = {};
+    const std::size_t n = decimator_process(dec, in, 4, out);
+    assert(n == 4 && out[1] == -2 && out[3] == -4);
+    (void)n;
+}
+
+// Unity gain at DC and a flat compensated passband (within 1%), with aliasing
+// tones beyond the output Nyquist strongly attenuated.
+void test_response() {
+    for (uint16_t factor : {2, 4, 8, 16, 32}) {
+        for (double f : {0.0125, 0.05, 0.1, 0.2, 0.3}) {
+            const double g = tone_gain(factor, f);
+            assert(std::fabs(g - 1.0) < 0.01);
+            (void)g;
+        }
+        // Folds back onto 0.4 / 0.2 cycles/output sample.
+        assert(tone_gain(factor, 0.6) < 0.003);
+        assert(tone_gain(factor, 0.8) < 0.003);
+    }
+    // Odd factors: CIC only, so the kept band is the lower half.
+    for (uint16_t factor : {3, 5, 7}) {
+        for (double f : {0.05, 0.1, 0.15}) {
+            const double g = tone_gain(factor, f);
+            assert(std::fabs(g - 1.0) < 0.01);
+            (void)g;
+        }
+        const double alias = tone_gain(factor, 0.7);
+        assert(alias < 0.05);
+        (void)alias;
+    }
+    for (uint8_t order = 1; order <= kMaxCicOrder; ++order) {
+        assert(std::fabs(tone_gain(4, 0.1, order) - 1.0) < 0.01);
+    }
+
+    Decimator dec;
+    decimator_init(dec, 8);
+    const std::vector<int16_t> dc(8 * 256, -1500);
+    std::vector<int16_t> out(257);
+    const std::size_t n = decimator_process(dec, dc.data(), dc.size(), out.data());
+    assert(n == 256);
+    assert(std::abs(out[n - 1] + 1500) <= 1);
+    (void)n;
+    // Full-scale input saturates instead of wrapping.
+    const std::vector<int16_t> full(8 * 64, INT16_MIN);
+    decimator_reset(dec);
+    decimator_process(dec, full.data(), full.size(), out.data());
+    assert(out[63] <= -32700);
+}
+
+// Output is independent of how the input stream is chunked.
+void test_chunking() {
+    Decimator one;
+    Decimator chunked;
+    decimator_init(one, 6);
+    decimator_init(chunked, 6);
+    std::vector<int16_t> in(6000);
+    uint32_t x = 12345;
+    for (int16_t& v : in) {
+        x = x * 1103515245u + 12345u;
+        v = static_cast<int16_t>((x >> 16) % 4096) - 2048;
+    }
+    std::vector<int16_t> a(1001);
+    std::vector<int16_t> b(1001 + 64);
+    const std::size_t na = decimator_process(one, in.data(), in.size(), a.data());
+    std::size_t nb = 0;
+    std::size_t pos = 0;
+    for (std::size_t step = 1; pos < in.size(); step = step % 17 + 1) {
+        const std::size_t n = std::min(step, in.size() - pos);
+        nb += decimator_process(chunked, in.data() + pos, n, b.data() + nb);
+        pos += n;
+    }
+    assert(na == 1000 && nb == na);
+    for (std::size_t i = 0; i < na; ++i) {
+        assert(a[i] == b[i]);
+    }
+    (void)na;
+}
+} // namespace
+
+int main() {
+    test_init();
+    test_response();
+    test_chunking();
+    std::printf("decimator tests passed\n");
+    return 0;
+}
@@ -0,0 +1,81 @@
+#include "dsp_kernels.hpp"
+#include "model_inference.hpp"
+#include "telemetry.hpp"
+
+#include <cassert>
+#include <cmath>
+#include <complex>
+#include <cstdio>
+#include <vector>
+
+int main() {
+    // 67 bins exercises the vector bodies plus scalar tails.
+    constexpr std::size_t kBins = 67;
+    std::vector<std::complex<float>> bins(kBins);
+    uint32_t lcg = 7;
+    for (auto& b : bins) {
+        lcg = lcg * 1664525u + 1013904223u;
+        const float re = static_cast<float>(static_cast<int>(lcg >> 16) % 2000 - 1000) * 0.37f;
+        lcg = lcg * 1664525u + 1013904223u;
+        const float im = static_cast<float>(static_cast<int>(lcg >> 16) % 2000 - 1000) * 0.37f;
+        b = {re, im};
+    }
+
+    std::vector<float> logs_in(1000);
+    for (std::size_t i = 0; i < logs_in.size(); ++i) {
+        logs_in[i] = std::pow(10.0f, -8.0f + 16.0f * static_cast<float>(i) / static_cast<float>(logs_in.size()));
+    }
+
+    const DspIsa detected = dsp_detect_isa();
+    const bool scalar_ok = dsp_select_isa(DspIsa::Scalar);
+    assert(scalar_ok);
+    (void)scalar_ok;
+    std::vector<float> ref_sq(kBins), ref_mag(kBins), ref_log(logs_in.size());
+    dsp_magnitude_squared(bins.data(), kBins, ref_sq.data());
+    const MagnitudeStats ref_stats = dsp_magnitude_stats(bins.data(), kBins, 0.125f, ref_mag.data());
+    dsp_log10(logs_in.data(), logs_in.size(), ref_log.data());
+
+    for (std::size_t i = 0; i < logs_in.size(); ++i) {
+        assert(std::fabs(ref_log[i] - std::log10(static_cast<double>(logs_in[i]))) < 5e-6);
+    }
+    assert(std::isfinite(dsp_log10(0.0f)));
+    assert(std::isfinite(dsp_log10(-1.0f)));
+
+    RFSampleWindow window{};
+    window.sample_count = kMaxRfSamples;
+    for (std::size_t i = 0; i < window.sample_count; ++i) {
+        window.samples[i] = static_cast<int16_t>(static_cast<int>((i * 2654435761u) >> 20) % 4096 - 2048);
+    }
+    init_model_inference();
+    const RfFeatures ref_features = extract_rf_features(window);
+
+    for (DspIsa isa : {DspIsa::Sse2, DspIsa::Avx2, DspIsa::Neon}) {
+        if (!dsp_select_isa(isa)) {
+            continue;
+        }
+        std::vector<float> sq(kBins), mag(kBins), logs(logs_in.size());
+        dsp_magnitude_squared(bins.data(), kBins, sq.data());
+        const MagnitudeStats stats = dsp_magnitude_stats(bins.data(), kBins, 0.125f, mag.data());
+        dsp_log10(logs_in.data(), logs_in.size(), logs.data());
+        for (std::size_t k = 0; k < kBins; ++k) {
+            assert(std::fabs(sq[k] - ref_sq[k]) <= 1e-6f * ref_sq[k]);
+            assert(std::fabs(mag[k] - ref_mag[k]) <= 1e-6f * ref_mag[k]);
+        }
+        assert(stats.max == ref_stats.max);
+        assert(std::fabs(stats.sum - ref_stats.sum) <= static_cast<float>(kBins) * 6e-8f * ref_stats.sum);
+        for (std::size_t i = 0; i < logs.size(); ++i) {
+            assert(std::fabs(logs[i] - ref_log[i]) < 1e-6f);
+        }
+
+        const RfFeatures features = extract_rf_features(window);
+        assert(std::fabs(features.avg_dbm - ref_features.avg_dbm) < 1e-3f);
+        assert(std::fabs(features.peak_dbm - ref_features.peak_dbm) < 1e-3f);
+        (void)stats;
+        (void)features;
+        std::printf("OK test_dsp_kernels: %s matches scalar\n", dsp_isa_name(isa));
+    }
+    (void)ref_stats;
+    (void)ref_features;
+    dsp_select_isa(detected);
+    return 0;
+}
@@ -0,0 +1,103 @@
+#include "model_inference.hpp"
+#include "telemetry.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <complex>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <vector>
+
+// Counts heap allocations so the hot path can be checked allocation-free.
+static std::size_t g_allocations = 0;
+
+void* operator new(std::size_t size) {
+    ++g_allocations;
+    if (void* p = std::malloc(size ? size : 1)) {
+        return p;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    std::free(p);
+}
+
+constexpr double kPi = 3.14159265358979323846;
+
+// Python reference (ai/scripts/extract_features.py::iq_to_features) in double:
+// |FFT_256(x / full_scale)|[:128] + 1e-6 -> log1p -> / (max + 1e-6).
+static std::vector<double> reference_features(const RFSampleWindow& window) {
+    std::vector<double> out(kFeatureBins);
+    double max_log = 0.0;
+    for (std::size_t k = 0; k < kFeatureBins; ++k) {
+        std::complex<double> acc{0.0, 0.0};
+        for (std::size_t t = 0; t < std::min(window.sample_count, kFeatureFftSize); ++t) {
+            const double angle = -2.0 * kPi * static_cast<double>(k * t % kFeatureFftSize) / kFeatureFftSize;
+            acc += (window.samples[t] / static_cast<double>(kAdcFullScale)) *
+                   std::complex<double>(std::cos(angle), std::sin(angle));
+        }
+        out[k] = std::log1p(std::abs(acc) + 1e-6);
+        max_log = std::max(max_log, out[k]);
+    }
+    for (double& v : out) {
+        v /= max_log + 1e-6;
+    }
+    return out;
+}
+
+static RFSampleWindow make_window(std::size_t count, double freq, double amp) {
+    RFSampleWindow window{};
+    window.sample_count = count;
+    for (std::size_t i = 0; i < count; ++i) {
+        const double v = amp * std::sin(2.0 * kPi * freq * static_cast<double>(i)) +
+                         static_cast<double>((i * 29) % 61) - 30.0;
+        window.samples[i] = static_cast<int16_t>(std::lround(v));
+    }
+    return window;
+}
+
+int main() {
+    init_model_inference();
+
+    const RFSampleWindow windows[] = {
+        make_window(kMaxRfSamples, 0.11, 1500.0),
+        make_window(kMaxRfSamples, 0.37, 200.0),
+        make_window(40, 0.05, 1800.0),
+    };
+    RfFeatureVector vec{};
+    for (const RFSampleWindow& w : windows) {
+        const bool ok = extract_rf_feature_vector(w, vec);
+        assert(ok);
+        (void)ok;
+        const std::vector<double> ref = reference_features(w);
+        float max_v = 0.0f;
+        for (std::size_t k = 0; k < kFeatureBins; ++k) {
+            assert(std::fabs(vec.bins[k] - ref[k]) < 2e-5);
+            assert(vec.bins[k] >= 0.0f && vec.bins[k] <= 1.0f);
+            max_v = std::max(max_v, vec.bins[k]);
+        }
+        assert(std::fabs(max_v - 1.0f) < 1e-5f);
+        (void)max_v;
+    }
+
+    // Hot path: feature vector + autoencoder score allocate nothing after init.
+    const std::size_t before = g_allocations;
+    float sink = 0.0f;
+    for (int r = 0; r < 16; ++r) {
+        extract_rf_feature_vector(windows[r % 3], vec);
+        sink += run_model_inference(vec);
+    }
+    assert(g_allocations == before);
+    assert(sink >= 0.0f);
+    (void)before;
+
+    std::printf("test_feature_vector passed (score sample %.3f)\n", sink / 16.0f);
+    return 0;
+}
@@ -0,0 +1,103 @@
+#include "fft.hpp"
+#include "model_inference.hpp"
+#include "telemetry.hpp"
+
+#include <cassert>
+#include <cmath>
+#include <complex>
+#include <cstdio>
+#include <vector>
+
+constexpr double kPi = 3.14159265358979323846;
+
+static std::vector<std::complex<double>> reference_dft(const std::vector<std::complex<float>>& in) {
+    const std::size_t n = in.size();
+    std::vector<std::complex<double>> out(n);
+    for (std::size_t k = 0; k < n; ++k) {
+        std::complex<double> acc{0.0, 0.0};
+        for (std::size_t t = 0; t < n; ++t) {
+            const double angle = -2.0 * kPi * static_cast<double>(k * t % n) / static_cast<double>(n);
+            acc += std::complex<double>(in[t]) * std::complex<double>(std::cos(angle), std::sin(angle));
+        }
+        out[k] = acc;
+    }
+    return out;
+}
+
+static double max_error(const FftPlan& plan, std::size_t n) {
+    std::vector<std::complex<float>> data(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        data[i] = {static_cast<float>((i * 37) % 101) - 50.0f, static_cast<float>((i * 11) % 23) - 11.0f};
+    }
+    const auto ref = reference_dft(data);
+    const bool ok = fft_complex(plan, data.data(), n);
+    assert(ok);
+    (void)ok;
+    double err = 0.0;
+    for (std::size_t k = 0; k < n; ++k) {
+        err = std::max(err, std::abs(std::complex<double>(data[k]) - ref[k]) / static_cast<double>(n));
+    }
+    return err;
+}
+
+int main() {
+    FftPlan plan;
+    bool ok = fft_plan_init(plan, 96);
+    (void)ok;
+    assert(!ok);
+    ok = fft_plan_init(plan, kMaxFftSize * 2);
+    assert(!ok);
+    ok = fft_plan_init(plan, 1024);
+    assert(ok);
+
+    // One plan serves every smaller power of two via strided tables.
+    for (std::size_t n = 2; n <= 1024; n <<= 1) {
+        const double err = max_error(plan, n);
+        assert(err < 1e-4);
+        (void)err;
+    }
+    std::vector<std::complex<float>> too_big(2048);
+    ok = fft_complex(plan, too_big.data(), too_big.size());
+    assert(!ok);
+
+    // A pure tone lands in its bin when driven through extract_rf_features.
+    NodeConfig cfg = load_config();
+    init_model_inference(cfg);
+    RFSampleWindow window{};
+    window.sample_count = kMaxRfSamples;
+    for (std::size_t i = 0; i < window.sample_count; ++i) {
+        window.samples[i] = static_cast<int16_t>(1000.0 * std::cos(2.0 * kPi * 8.0 * static_cast<double>(i) / 128.0));
+    }
+    const RfFeatures tone = extract_rf_features(window);
+    // |X[8]| / N = 500 -> 20*log10(500) - 20
+    assert(std::fabs(tone.peak_dbm - (20.0f * std::log10(500.0f) - 20.0f)) < 0.05f);
+    assert(tone.peak_dbm > tone.avg_dbm);
+
+    // Real-input path matches the complex path bin for bin.
+    for (std::size_t n = 2; n <= 1024; n <<= 1) {
+        std::vector<int16_t> samples(n);
+        std::vector<std::complex<float>> full(n);
+        for (std::size_t i = 0; i < n; ++i) {
+            samples[i] = static_cast<int16_t>(static_cast<int>((i * 2654435761u) >> 20) % 4096 - 2048);
+            full[i] = {static_cast<float>(samples[i]), 0.0f};
+        }
+        std::vector<std::complex<float>> half(n / 2 + 1);
+        const bool real_ok = fft_real(plan, samples.data(), n, n, half.data());
+        assert(real_ok);
+        (void)real_ok;
+        fft_complex(plan, full.data(), n);
+        for (std::size_t k = 0; k <= n / 2; ++k) {
+            assert(std::abs(half[k] - full[k]) / static_cast<float>(n) < 1e-3f);
+        }
+    }
+
+    set_rf_feature_backend(RfFeatureBackend::ComplexFft);
+    const RfFeatures tone_complex = extract_rf_features(window);
+    set_rf_feature_backend(RfFeatureBackend::RealFft);
+    (void)tone_complex;
+    assert(std::fabs(tone_complex.peak_dbm - tone.peak_dbm) < 1e-3f);
+    assert(std::fabs(tone_complex.avg_dbm - tone.avg_dbm) < 1e-2f);
+
+    std::printf("OK test_fft: tone peak_dbm=%.3f avg_dbm=%.3f\n", tone.peak_dbm, tone.avg_dbm);
+    return 0;
+}
@@ -0,0 +1,109 @@
+#include "fft.hpp"
+#include "fft_q15.hpp"
+#include "model_inference.hpp"
+#include "telemetry.hpp"
+
+#include <cassert>
+#include <cmath>
+#include <complex>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+constexpr double kPi = 3.14159265358979323846;
+
+static uint32_t float_bits(float v) {
+    uint32_t bits = 0;
+    std::memcpy(&bits, &v, sizeof(bits));
+    return bits;
+}
+
+static RFSampleWindow make_window(std::size_t kind) {
+    RFSampleWindow w{};
+    w.sample_count = kMaxRfSamples;
+    uint32_t lcg = 12345;
+    for (std::size_t i = 0; i < w.sample_count; ++i) {
+        lcg = lcg * 1664525u + 1013904223u;
+        const double t = static_cast<double>(i);
+        double v = 0.0;
+        switch (kind) {
+            case 0: v = static_cast<double>(i % 64); break;                       // host ADC stub ramp
+            case 1: v = 1800.0 * std::cos(2.0 * kPi * 13.0 * t / 128.0); break;  // strong tone
+            case 2: v = 3.0 * std::sin(2.0 * kPi * 5.0 * t / 128.0); break;      // near-silent tone
+            default: v = static_cast<double>(static_cast<int>(lcg >> 20) % 4096 - 2048); break; // full-scale noise
+        }
+        w.samples[i] = static_cast<int16_t>(std::lround(v));
+    }
+    if (kind == 0) {
+        w.samples[5] = 200;
+    }
+    return w;
+}
+
+int main() {
+    // Fixed transform tracks the float transform after block exponent scaling.
+    FftPlan fplan;
+    FftPlanQ15 qplan;
+    const bool planned = fft_plan_init(fplan, 256) && fft_plan_init_q15(qplan, 256);
+    assert(planned);
+    (void)planned;
+    for (std::size_t kind = 0; kind < 4; ++kind) {
+        const RFSampleWindow w = make_window(kind);
+        std::vector<std::complex<float>> ref(w.sample_count / 2 + 1);
+        std::vector<int16_t> fixed(w.sample_count + 2);
+        int exponent = 0;
+        fft_real(fplan, w.samples.data(), w.sample_count, w.sample_count, ref.data());
+        const bool ok = fft_real_q15(qplan, w.samples.data(), w.sample_count, w.sample_count, fixed.data(), exponent);
+        assert(ok);
+        (void)ok;
+        float peak = 0.0f;
+        for (const auto& b : ref) peak = std::max(peak, std::abs(b));
+        for (std::size_t k = 0; k < ref.size(); ++k) {
+            const std::complex<float> got(std::ldexp(static_cast<float>(fixed[2 * k]), exponent),
+                                          std::ldexp(static_cast<float>(fixed[2 * k + 1]), exponent));
+            assert(std::abs(got - ref[k]) <= 0.01f * peak + 1.0f);
+        }
+    }
+
+    // Fixed log2 stays within its documented error.
+    for (uint64_t x = 1; x < (1ULL << 40); x = x * 3 + 1) {
+        const double err = std::fabs(log2_q16(x) / 65536.0 - std::log2(static_cast<double>(x)));
+        assert(err < 3e-4);
+        (void)err;
+    }
+    assert(isqrt_u64(1ULL << 40) == (1u << 20));
+    assert(isqrt_u64(99) == 9);
+
+    // Feature output agrees with the float backend and is pinned bit-for-bit.
+    static const uint32_t kPinned[4][2] = {
+        {0xC1B70538u, 0x41260550u},
+        {0xC0E49160u, 0x421C57D0u},
+        {0xC26B6E3Cu, 0xC182D0D0u},
+        {0x41172060u, 0x41CCF0D0u},
+    };
+    init_model_inference();
+    for (std::size_t kind = 0; kind < 4; ++kind) {
+        const RFSampleWindow w = make_window(kind);
+        set_rf_feature_backend(RfFeatureBackend::RealFft);
+        const RfFeatures ref = extract_rf_features(w);
+        set_rf_feature_backend(RfFeatureBackend::FixedQ15);
+        const RfFeatures fixed = extract_rf_features(w);
+        assert(std::fabs(fixed.avg_dbm - ref.avg_dbm) < 0.1f);
+        assert(std::fabs(fixed.peak_dbm - ref.peak_dbm) < 0.1f);
+        assert(float_bits(fixed.avg_dbm) == kPinned[kind][0]);
+        assert(float_bits(fixed.peak_dbm) == kPinned[kind][1]);
+        (void)ref;
+        (void)fixed;
+    }
+    // Past the largest Q15 plan the features are empty, not the last spectrum.
+    const std::vector<int16_t> big(kMaxFftSize + 1, 1000);
+    const RfFeatures none = extract_rf_features(big.data(), big.size());
+    assert(none.avg_dbm == 0.0f && none.peak_dbm == 0.0f);
+    (void)none;
+    set_rf_feature_backend(RfFeatureBackend::RealFft);
+    (void)kPinned;
+    (void)float_bits;
+
+    std::printf("OK test_fft_q15\n");
+    return 0;
+}
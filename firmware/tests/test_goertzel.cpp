@@ -0,0 +1,191 @@
+#include "fft.hpp"
+#include "goertzel.hpp"
+#include "model_inference.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <complex>
+#include <cstdio>
+#include <vector>
+
+constexpr double kPi = 3.14159265358979323846;
+
+static std::vector<int16_t> test_signal(std::size_t n) {
+    std::vector<int16_t> out(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const double t = static_cast<double>(i) / static_cast<double>(n);
+        const double v = 3000.0 * std::cos(2.0 * kPi * 9.0 * t) + 800.0 * std::sin(2.0 * kPi * 30.0 * t) +
+                         static_cast<double>((i * 37) % 101) - 50.0;
+        out[i] = static_cast<int16_t>(std::lround(v));
+    }
+    return out;
+}
+
+static void test_matches_fft_bins() {
+    const std::size_t sizes[] = {32, 128, 1024};
+    for (std::size_t n : sizes) {
+        const auto samples = test_signal(n);
+        FftPlan plan;
+        const bool planned = fft_plan_init(plan, n);
+        assert(planned);
+        (void)planned;
+        std::vector<std::complex<float>> spectrum(n / 2 + 1);
+        fft_real(plan, samples.data(), n, n, spectrum.data());
+
+        const uint16_t bins[] = {0, 1, 9, static_cast<uint16_t>(n / 4), static_cast<uint16_t>(30 % (n / 2)),
+                                 static_cast<uint16_t>(n / 2)};
+        GoertzelBank bank;
+        const bool ok = goertzel_bank_init(bank, bins, 6, n);
+        assert(ok);
+        (void)ok;
+        float mags[6];
+        const MagnitudeStats stats = goertzel_bank_run(bank, samples.data(), n, 1.0f, mags);
+
+        float expect_max = 0.0f;
+        float expect_sum = 0.0f;
+        for (std::size_t i = 0; i < 6; ++i) {
+            const float ref = std::abs(spectrum[bins[i]]);
+            // Relative to the window energy scale: float recurrence error grows with n.
+            assert(std::fabs(mags[i] - ref) <= 1e-4f * 3000.0f * static_cast<float>(n));
+            (void)ref;
+            expect_max = std::max(expect_max, mags[i]);
+            expect_sum += mags[i];
+        }
+        assert(stats.max == expect_max);
+        assert(std::fabs(stats.sum - expect_sum) <= 1e-3f * expect_sum);
+        (void)stats;
+    }
+}
+
+static void test_zero_padding() {
+    // 48 samples evaluated as a 64-point window must match the zero-padded FFT.
+    auto samples = test_signal(64);
+    FftPlan plan;
+    const bool planned = fft_plan_init(plan, 64);
+    assert(planned);
+    (void)planned;
+    std::vector<std::complex<float>> spectrum(33);
+    fft_real(plan, samples.data(), 48, 64, spectrum.data());
+
+    const uint16_t bins[] = {3, 7, 20};
+    GoertzelBank bank;
+    const bool ok = goertzel_bank_init(bank, bins, 3, 64);
+    assert(ok);
+    (void)ok;
+    float mags[3];
+    goertzel_bank_run(bank, samples.data(), 48, 1.0f, mags);
+    for (std::size_t i = 0; i < 3; ++i) {
+        assert(std::fabs(mags[i] - std::abs(spectrum[bins[i]])) < 0.5f);
+    }
+}
+
+static void test_init_rejects() {
+    GoertzelBank bank;
+    const uint16_t too_high[] = {65};
+    bool ok = goertzel_bank_init(bank, too_high, 1, 128);
+    (void)ok;
+    assert(!ok);
+    const uint16_t ok_bins[kMaxGoertzelBins + 1] = {};
+    ok = goertzel_bank_init(bank, ok_bins, 0, 128);
+    assert(!ok);
+    ok = goertzel_bank_init(bank, ok_bins, kMaxGoertzelBins + 1, 128);
+    assert(!ok);
+    ok = goertzel_bank_init(bank, ok_bins, kMaxGoertzelBins, 128);
+    assert(ok && bank.bin_count == kMaxGoertzelBins);
+}
+
+static void test_backend() {
+    NodeConfig cfg = load_config();
+    cfg.watch_bins = {4, 9, 16, 30, 0, 0, 0, 0};
+    cfg.watch_bin_count = 4;
+    init_model_inference(cfg);
+    assert(rf_feature_backend() == RfFeatureBackend::GoertzelBank);
+
+    RFSampleWindow window{};
+    window.sample_count = kMaxRfSamples;
+    const auto samples = test_signal(kMaxRfSamples);
+    for (std::size_t i = 0; i < kMaxRfSamples; ++i) {
+        window.samples[i] = samples[i];
+    }
+    const RfFeatures watched = extract_rf_features(window);
+    // The 9-bin tone dominates the watched set: amplitude 3000 reads 1500 after 1/N.
+    assert(std::fabs(watched.peak_dbm - (20.0f * std::log10(1500.0f) - 20.0f)) < 0.05f);
+    assert(watched.peak_dbm > watched.avg_dbm);
+
+    // Retargeting to a quiet set drops the peak.
+    const uint16_t quiet[] = {40, 50};
+    const bool ok = set_goertzel_bins(quiet, 2);
+    assert(ok);
+    (void)ok;
+    const RfFeatures off = extract_rf_features(window);
+    assert(off.peak_dbm < watched.peak_dbm - 20.0f);
+    (void)off;
+    (void)watched;
+
+    set_rf_feature_backend(RfFeatureBackend::RealFft);
+    const RfFeatures full = extract_rf_features(window);
+    assert(std::isfinite(full.peak_dbm));
+    (void)full;
+}
+
+// Swept bands carry their own backend: a band with watch bins is scored by a
+// bank over its own window length, others follow the node-wide backend unless
+// they name one.
+static void test_band_backend() {
+    set_rf_feature_backend(RfFeatureBackend::RealFft);
+    BandConfig watched{};
+    watched.fft_size = 64;
+    watched.watch_bins = {9, 20, 0, 0, 0, 0, 0, 0};
+    watched.watch_bin_count = 2;
+    BandConfig plain{};
+    plain.fft_size = 64;
+    BandConfig fixed = plain;
+    fixed.feature_backend = 1 + static_cast<uint8_t>(RfFeatureBackend::FixedQ15);
+    BandConfig bad_bin = watched;
+    bad_bin.watch_bins[1] = 40; // past n/2 of a 64-point window
+    BandConfig bad_backend = plain;
+    bad_backend.feature_backend = 99;
+    const bool ok = set_band_feature_backend(0, watched) && set_band_feature_backend(1, plain) &&
+                    set_band_feature_backend(2, fixed);
+    const bool rejected = !set_band_feature_backend(3, bad_bin) && !set_band_feature_backend(4, bad_backend) &&
+                          !set_band_feature_backend(static_cast<uint8_t>(kMaxBands), watched);
+    assert(ok && rejected);
+    (void)ok;
+    (void)rejected;
+
+    const auto samples = test_signal(64);
+    select_rf_feature_band(static_cast<uint8_t>(kMaxBands));
+    const RfFeatures node = extract_rf_features(samples.data(), samples.size());
+    select_rf_feature_band(0);
+    assert(rf_feature_backend() == RfFeatureBackend::GoertzelBank);
+    const RfFeatures band = extract_rf_features(samples.data(), samples.size());
+    // Bin 9 of the band's own 64-point spectrum: amplitude 3000 reads 1500 after 1/N.
+    assert(std::fabs(band.peak_dbm - (20.0f * std::log10(1500.0f) - 20.0f)) < 0.05f);
+    assert(band.avg_dbm != node.avg_dbm);
+    (void)node;
+    (void)band;
+
+    select_rf_feature_band(1);
+    assert(rf_feature_backend() == RfFeatureBackend::RealFft);
+    const RfFeatures same = extract_rf_features(samples.data(), samples.size());
+    assert(same.peak_dbm == node.peak_dbm && same.avg_dbm == node.avg_dbm);
+    (void)same;
+    select_rf_feature_band(2);
+    assert(rf_feature_backend() == RfFeatureBackend::FixedQ15);
+    assert(std::isfinite(extract_rf_features(samples.data(), samples.size()).peak_dbm));
+    select_rf_feature_band(3);
+    assert(rf_feature_backend() == RfFeatureBackend::RealFft);
+    select_rf_feature_band(static_cast<uint8_t>(kMaxBands));
+    assert(rf_feature_backend() == RfFeatureBackend::RealFft);
+}
+
+int main() {
+    test_matches_fft_bins();
+    test_zero_padding();
+    test_init_rejects();
+    test_backend();
+    test_band_backend();
+    std::puts("test_goertzel passed");
+    return 0;
+}
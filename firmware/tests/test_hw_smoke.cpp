@@ -35,7 +35,7 @@ int main() {
     frame.header.seq_no = 1;
     std::snprintf(frame.header.src_node_id, sizeof(frame.header.src_node_id), "smoke");
 
-    EncryptedFrame dummy{};
+    LinkPacket dummy{};
     dummy.len = 32;
     dummy.bytes.fill(0xAA);
     const bool sent = radio_driver_send(dummy);
@@ -0,0 +1,199 @@
+#include "mesh.hpp"
+#include "mesh_encode.hpp"
+#include "mesh_schema.hpp"
+#include "telemetry.hpp"
+
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+
+namespace {
+MeshFrame make_frame(const char* src, uint32_t seq) {
+    MeshFrame f{};
+    f.header.version = kMeshSchemaV2;
+    f.header.msg_type = MeshMsgType::Telemetry;
+    f.header.ttl = 4;
+    f.header.seq_no = seq;
+    std::snprintf(f.header.src_node_id, sizeof(f.header.src_node_id), "%s", src);
+    f.security.encrypted = true;
+    f.security.nonce = {static_cast<uint8_t>(seq), 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+    f.counters.tx_counter = seq;
+    f.telemetry.rf_event = {seq * 1000, 915000000, {-71.5f, -60.0f}, 0.12f, 1, 3};
+    f.telemetry.gps = {seq * 1000, 47.620512f, -122.349305f, 56.2f, 9, 1.1f, true, false, false, 38.0f};
+    f.telemetry.health = {seq * 1000, 3.91f, 24.5f, 0.4f, false};
+    f.fault.counters.watchdog_resets = 1;
+    return f;
+}
+
+// The next frame from the same node, `step` seconds on, with every value
+// jittering inside its deadband.
+MeshFrame next_frame(const MeshFrame& key, uint32_t step) {
+    MeshFrame f = make_frame(key.header.src_node_id, key.header.seq_no + step);
+    f.header.ref_seq_no = key.header.seq_no;
+    const float wobble = (step % 2 == 0) ? 1.0f : -1.0f;
+    f.telemetry.gps.latitude_deg += wobble * 4e-6f;
+    f.telemetry.gps.altitude_m += wobble * 0.5f;
+    f.telemetry.gps.cn0_db_hz_avg += wobble * 0.5f;
+    f.telemetry.health.battery_v -= 0.01f;
+    f.telemetry.health.temp_c += wobble * 0.2f;
+    f.telemetry.rf_event.features.avg_dbm += wobble * 0.25f;
+    return f;
+}
+
+// Rows inside their deadband are left out, and so are maps with nothing else
+// to say; receivers rebuild the frame from the cached keyframe.
+void test_deadbands() {
+    init_mesh();
+    const MeshFrame key = make_frame("node-a", 10);
+    MeshFrame f = next_frame(key, 1);
+    f.telemetry.rf_event.anomaly_score = 0.5f;
+    f.telemetry.rf_event.band = 0;
+    f.fault.counters.tamper_events = 1;
+
+    const auto near = [](float got, float want, float tol) { return std::fabs(got - want) <= tol; };
+    const EncodedFrame full = encode_mesh_frame(key);
+    const EncodedFrame delta = encode_mesh_delta(f, key);
+    assert(full.len > 0 && delta.len > 0 && delta.len < full.len);
+    MeshFrameView view;
+    bool ok = mesh_frame_view_open(delta.bytes.data(), delta.len, view);
+    assert(ok);
+    // Only the header is always whole; the envelope maps are deltas too.
+    assert(mesh_frame_view_has(view, MeshMapKey::Security) && mesh_frame_view_has(view, MeshMapKey::Counters));
+    assert(mesh_frame_view_has(view, MeshMapKey::Rf) && mesh_frame_view_has(view, MeshMapKey::Fault));
+    assert(!mesh_frame_view_has(view, MeshMapKey::Gps) && !mesh_frame_view_has(view, MeshMapKey::Health));
+    uint32_t v = 0;
+    // Moved rows and the timestamp ride along; the rest stay out.
+    assert(mesh_frame_view_uint(view, MeshMapKey::Rf, 1, v) && v == 11000);
+    assert(mesh_frame_view_uint(view, MeshMapKey::Rf, 7, v) && v == 0);
+    assert(!mesh_frame_view_uint(view, MeshMapKey::Rf, 2, v));
+    assert(!mesh_frame_view_uint(view, MeshMapKey::Fault, 2, v));
+    assert(!mesh_frame_view_uint(view, MeshMapKey::Security, 1, v));
+    assert(mesh_frame_view_uint(view, MeshMapKey::Header, static_cast<uint8_t>(MeshHeaderKey::RefSeqNo), v) &&
+           v == 10);
+
+    MeshFrame out{};
+    ok = receive_mesh_frame(full, out);
+    assert(ok && out.header.ref_seq_no == 0);
+    ok = receive_mesh_frame(delta, out);
+    assert(ok && out.header.seq_no == 11 && out.header.ref_seq_no == 10);
+    assert(out.telemetry.rf_event.timestamp_ms == 11000 && out.telemetry.rf_event.band == 0);
+    assert(near(out.telemetry.rf_event.anomaly_score, 0.5f, 1e-3f));
+    assert(out.telemetry.rf_event.center_freq_hz == 915000000);
+    assert(out.fault.counters.tamper_events == 1 && out.fault.counters.watchdog_resets == 1);
+    assert(out.security.encrypted && out.security.nonce == f.security.nonce && out.counters.tx_counter == 11);
+    // Left-out maps hold the keyframe's values, within a deadband of the sender's.
+    assert(out.telemetry.gps.timestamp_ms == 10000 && out.telemetry.health.timestamp_ms == 10000);
+    assert(near(out.telemetry.gps.latitude_deg, f.telemetry.gps.latitude_deg, 1e-5f));
+    assert(near(out.telemetry.health.battery_v, f.telemetry.health.battery_v, 0.02f));
+    assert(out.telemetry.gps.num_sats == 9 && out.telemetry.gps.valid_fix);
+
+    // A row past its deadband brings its map back.
+    f.telemetry.gps.latitude_deg = key.telemetry.gps.latitude_deg + 2e-5f;
+    const EncodedFrame moved = encode_mesh_delta(f, key);
+    ok = mesh_frame_view_open(moved.bytes.data(), moved.len, view);
+    assert(ok && mesh_frame_view_has(view, MeshMapKey::Gps));
+    ok = receive_mesh_frame(moved, out);
+    assert(ok && near(out.telemetry.gps.latitude_deg, f.telemetry.gps.latitude_deg, 1e-6f));
+    assert(out.telemetry.gps.timestamp_ms == 11000);
+
+    // Same frame against itself: header only.
+    const EncodedFrame same = encode_mesh_delta(key, key);
+    assert(same.len > 0 && same.bytes[0] == 0xA1);
+    (void)ok;
+    (void)near;
+    (void)full;
+    (void)delta;
+    (void)moved;
+    (void)same;
+    (void)out;
+    (void)v;
+}
+
+// Deltas whose keyframe is unknown or superseded are refused, and the cache
+// keeps the most recently used sources.
+void test_keyframe_cache() {
+    init_mesh();
+    const MeshFrame key = make_frame("node-b", 10);
+    const EncodedFrame delta = encode_mesh_delta(next_frame(key, 1), key);
+    MeshFrame out{};
+    bool ok = receive_mesh_frame(delta, out);
+    assert(!ok && mesh_metrics().delta_misses == 1);
+    ok = receive_mesh_frame(encode_mesh_frame(key), out);
+    assert(ok);
+    ok = receive_mesh_frame(delta, out);
+    assert(ok);
+    // A newer keyframe replaces the old one.
+    ok = receive_mesh_frame(encode_mesh_frame(make_frame("node-b", 20)), out);
+    assert(ok);
+    ok = receive_mesh_frame(delta, out);
+    assert(!ok && mesh_metrics().delta_misses == 2);
+
+    // Nine sources through eight slots: the least recently used goes.
+    init_mesh();
+    char name[8];
+    for (int i = 0; i < 9; ++i) {
+        std::snprintf(name, sizeof(name), "n%d", i);
+        ok = receive_mesh_frame(encode_mesh_frame(make_frame(name, 5)), out);
+        assert(ok);
+        if (i == 7) {
+            // Touch n0 so n1 is the oldest when n8 arrives.
+            const MeshFrame k0 = make_frame("n0", 5);
+            ok = receive_mesh_frame(encode_mesh_delta(next_frame(k0, 1), k0), out);
+            assert(ok);
+        }
+    }
+    const MeshFrame k0 = make_frame("n0", 5);
+    const MeshFrame k1 = make_frame("n1", 5);
+    ok = receive_mesh_frame(encode_mesh_delta(next_frame(k0, 2), k0), out);
+    assert(ok);
+    ok = receive_mesh_frame(encode_mesh_delta(next_frame(k1, 2), k1), out);
+    assert(!ok);
+
+    // Non-telemetry frames decode as before and are not cached.
+    MeshFrame routing = make_frame("node-c", 3);
+    routing.header.msg_type = MeshMsgType::Routing;
+    routing.routing.version = 4;
+    ok = receive_mesh_frame(encode_mesh_frame(routing), out);
+    assert(ok && out.routing.version == 4);
+    (void)ok;
+}
+
+// One keyframe and nine deltas through the encrypted path, against ten full
+// frames.
+void test_steady_state_bytes() {
+    init_mesh();
+    AesGcmKey aes{};
+    aes.bytes.fill(0x11);
+    const MeshFrame key = make_frame("node-d", 100);
+    EncryptedFrame sealed{};
+    EncodedFrame clear{};
+    MeshFrame out{};
+    std::size_t full_bytes = 0;
+    std::size_t delta_bytes = 0;
+    for (uint32_t step = 0; step < 10; ++step) {
+        const MeshFrame f = step == 0 ? key : next_frame(key, step);
+        const bool sealed_ok = encrypt_mesh_frame_into(f, aes, sealed, step == 0 ? nullptr : &key);
+        assert(sealed_ok);
+        (void)sealed_ok;
+        delta_bytes += sealed.len;
+        const bool opened = decrypt_mesh_frame(sealed, aes, clear) && receive_mesh_frame(clear, out);
+        assert(opened);
+        (void)opened;
+        assert(out.header.seq_no == f.header.seq_no && out.telemetry.rf_event.timestamp_ms == 100000);
+        full_bytes += encrypt_mesh_frame(f, aes).len;
+    }
+    assert(mesh_metrics().delta_misses == 0);
+    assert(delta_bytes * 2 <= full_bytes);
+    (void)clear;
+    (void)out;
+    (void)full_bytes;
+    (void)delta_bytes;
+}
+} // namespace
+
+int main() {
+    test_deadbands();
+    test_keyframe_cache();
+    test_steady_state_bytes();
+    return 0;
+}
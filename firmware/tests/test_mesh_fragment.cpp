@@ -0,0 +1,212 @@
+#include "mesh.hpp"
+#include "mesh_encode.hpp"
+#include "mesh_fragment.hpp"
+#include "mesh_schema.hpp"
+#include "telemetry.hpp"
+
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+namespace {
+// A sealed frame of `len` bytes whose nonce is set by `seed`.
+EncryptedFrame make_sealed(std::size_t len, uint8_t seed) {
+    EncryptedFrame f{};
+    for (std::size_t i = 0; i < len; ++i) {
+        f.bytes[i] = static_cast<uint8_t>(i * 7 + seed);
+    }
+    f.len = len;
+    return f;
+}
+
+std::vector<LinkPacket> fragments_of(const EncryptedFrame& f, uint16_t link_id) {
+    std::vector<LinkPacket> out(mesh_fragment_count(f.len));
+    for (std::size_t i = 0; i < out.size(); ++i) {
+        const bool built = mesh_fragment_build(f, link_id, i, out[i]);
+        assert(built && out[i].len <= kLinkMtu);
+        (void)built;
+    }
+    return out;
+}
+
+bool feed(const LinkPacket& p, uint32_t now_ms, EncryptedFrame& out) {
+    return mesh_fragment_receive(p.bytes.data(), p.len, now_ms, out);
+}
+
+// Only called inside asserts, hence inline.
+inline bool same(const EncryptedFrame& a, const EncryptedFrame& b) {
+    return a.len == b.len && std::memcmp(a.bytes.data(), b.bytes.data(), a.len) == 0;
+}
+
+// The largest sealed frame comes back whole whatever order its fragments
+// arrive in, duplicates included.
+void test_roundtrip() {
+    mesh_fragment_reset();
+    const EncryptedFrame big = make_sealed(kMaxCipherLen, 1);
+    const auto packets = fragments_of(big, 0x1234);
+    assert(packets.size() == 2 && packets.size() <= kMaxFragments);
+    assert(packets[0].len == kLinkMtu && packets[0].bytes[0] == 0x12 && packets[0].bytes[1] == 0x34);
+    assert(packets[1].bytes[4] == 0x11);
+    EncryptedFrame out{};
+    bool done = feed(packets[1], 0, out);
+    assert(!done);
+    done = feed(packets[1], 1, out);
+    assert(!done);
+    done = feed(packets[0], 2, out);
+    assert(done && same(out, big));
+    assert(mesh_fragment_stats().reassembled == 1);
+    // A late duplicate starts a fresh slot and never completes on its own.
+    done = feed(packets[1], 4, out);
+    assert(!done);
+
+    // Single-fragment frames come straight through.
+    const EncryptedFrame small = make_sealed(kFragmentPayload, 2);
+    const auto one = fragments_of(small, 0x1234);
+    assert(one.size() == 1 && one[0].bytes[4] == 0);
+    done = feed(one[0], 5, out);
+    assert(done && same(out, small));
+    assert(mesh_fragment_stats().reassembled == 1);
+    (void)done;
+}
+
+// Interleaved frames from different senders, or from one sender, each fill
+// their own slot.
+void test_interleaved() {
+    mesh_fragment_reset();
+    const EncryptedFrame a = make_sealed(250, 3);
+    const EncryptedFrame b = make_sealed(250, 4);
+    const auto pa = fragments_of(a, 1);
+    const auto pb = fragments_of(b, 1);
+    const auto pc = fragments_of(a, 2);
+    EncryptedFrame out{};
+    bool done = feed(pa[0], 0, out) || feed(pb[0], 0, out) || feed(pc[1], 0, out);
+    assert(!done);
+    done = feed(pb[1], 1, out);
+    assert(done && same(out, b));
+    done = feed(pc[0], 1, out);
+    assert(done && same(out, a));
+    done = feed(pa[1], 1, out);
+    assert(done && same(out, a));
+    assert(mesh_fragment_stats().reassembled == 3 && mesh_fragment_stats().evictions == 0);
+    (void)done;
+}
+
+// Partial frames are dropped after the timeout, and the oldest one goes when
+// every slot is taken.
+void test_timeout_and_eviction() {
+    mesh_fragment_reset();
+    const EncryptedFrame a = make_sealed(280, 5);
+    const auto pa = fragments_of(a, 7);
+    EncryptedFrame out{};
+    bool done = feed(pa[0], 100, out);
+    assert(!done);
+    done = feed(pa[1], 100 + kReassemblyTimeoutMs, out);
+    assert(!done && mesh_fragment_stats().timeouts == 1);
+
+    mesh_fragment_reset();
+    std::vector<std::vector<LinkPacket>> frames;
+    for (uint8_t i = 0; i <= kReassemblySlots; ++i) {
+        frames.push_back(fragments_of(make_sealed(280, static_cast<uint8_t>(10 + i)), 7));
+        done = feed(frames.back()[0], i, out);
+        assert(!done);
+    }
+    assert(mesh_fragment_stats().evictions == 1);
+    // The first frame was evicted; the second is still whole once its tail lands.
+    done = feed(frames[1][1], 10, out);
+    assert(done && same(out, make_sealed(280, 11)));
+    done = feed(frames[0][1], 10, out);
+    assert(!done);
+    (void)done;
+}
+
+// Packets with impossible headers are counted and dropped.
+void test_invalid() {
+    mesh_fragment_reset();
+    const auto packets = fragments_of(make_sealed(280, 6), 9);
+    EncryptedFrame out{};
+    LinkPacket p = packets[0];
+    p.bytes[4] = 0x21; // index 2 of 2
+    bool ok = feed(p, 0, out);
+    assert(!ok);
+    p.bytes[4] = 0x0F; // 16 fragments
+    ok = feed(p, 0, out);
+    assert(!ok);
+    p = packets[0];
+    p.len -= 1; // short middle fragment
+    ok = feed(p, 0, out);
+    assert(!ok);
+    ok = mesh_fragment_receive(p.bytes.data(), kFragmentHeaderLen, 0, out);
+    assert(!ok && mesh_fragment_stats().invalid == 4);
+    ok = mesh_fragment_build(make_sealed(280, 6), 9, 2, p);
+    assert(!ok);
+    (void)ok;
+}
+
+std::vector<LinkPacket> g_air;
+
+bool capture_sender(const LinkPacket& packet) {
+    g_air.push_back(packet);
+    return true;
+}
+
+// A route table frame large enough to need two fragments goes out through the
+// send handler and decodes after reassembly.
+void test_end_to_end() {
+    init_mesh();
+    mesh_fragment_reset();
+    set_mesh_node_id("node-frag");
+    set_mesh_send_handler(capture_sender);
+    MeshFrame frame{};
+    frame.header.version = kMeshSchemaV2;
+    frame.header.msg_type = MeshMsgType::Routing;
+    frame.header.ttl = 3;
+    frame.header.seq_no = 42;
+    std::snprintf(frame.header.src_node_id, sizeof(frame.header.src_node_id), "node-frag");
+    frame.routing.version = 9;
+    frame.routing.entry_count = kMaxRoutes;
+    for (std::size_t i = 0; i < kMaxRoutes; ++i) {
+        std::snprintf(frame.routing.entries[i].neighbor_id, kMaxNodeIdLength, "neighbor-%03zu", i);
+        frame.routing.entries[i].rssi_dbm = static_cast<int8_t>(-50 - static_cast<int>(i));
+        frame.routing.entries[i].cost = static_cast<uint8_t>(i + 1);
+    }
+
+    EncryptedFrame sealed{};
+    bool ok = seal_mesh_frame(frame, sealed) && send_sealed_frame(sealed);
+    assert(ok && g_air.size() == mesh_fragment_count(sealed.len) && g_air.size() > 1);
+    assert(mesh_metrics().fragments_sent == g_air.size());
+    const uint16_t link_id = mesh_link_id("node-frag");
+    assert(g_air[0].bytes[0] == link_id >> 8 && g_air[0].bytes[1] == (link_id & 0xFF));
+
+    // A retry resends the same tag, so its fragments fill the same slot.
+    std::vector<LinkPacket> first = g_air;
+    g_air.clear();
+    ok = send_sealed_frame(sealed);
+    assert(ok && g_air.size() == first.size());
+    EncryptedFrame rx{};
+    ok = feed(first[0], 0, rx);
+    assert(!ok);
+    ok = feed(g_air[1], 0, rx);
+    assert(ok && same(rx, sealed));
+
+    AesGcmKey key{};
+    key.bytes.fill(0x11);
+    EncodedFrame clear{};
+    MeshFrame out{};
+    ok = decrypt_mesh_frame(rx, key, clear) && receive_mesh_frame(clear, out);
+    assert(ok && out.header.seq_no == 42 && out.routing.entry_count == kMaxRoutes);
+    assert(std::strcmp(out.routing.entries[7].neighbor_id, "neighbor-007") == 0);
+    set_mesh_send_handler(nullptr);
+    (void)ok;
+    (void)link_id;
+}
+} // namespace
+
+int main() {
+    test_roundtrip();
+    test_interleaved();
+    test_timeout_and_eviction();
+    test_invalid();
+    test_end_to_end();
+    return 0;
+}
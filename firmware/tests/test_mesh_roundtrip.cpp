@@ -9,7 +9,8 @@
 static MeshFrame make_sample(uint32_t seq) {
     MeshFrame f{};
     f.header.version = 1;
-    f.header.msg_type = MeshMsgType::Telemetry;
+    // Odd frames carry telemetry, even frames the route table.
+    f.header.msg_type = seq % 2 ? MeshMsgType::Telemetry : MeshMsgType::Routing;
     f.header.ttl = 3;
     f.header.hop_count = 0;
     f.header.seq_no = seq;
@@ -21,6 +22,7 @@ static MeshFrame make_sample(uint32_t seq) {
     f.telemetry.rf_event.features.peak_dbm = -42.0f;
     f.telemetry.rf_event.anomaly_score = 0.2f;
     f.telemetry.rf_event.model_version = 1;
+    f.telemetry.rf_event.band = static_cast<uint8_t>(seq % 2);
     f.telemetry.gps.valid_fix = true;
     f.telemetry.health.battery_v = 3.8f;
     f.routing.entry_count = 1;
@@ -46,19 +48,27 @@ int main() {
         assert(ok);
         assert(decoded.header.seq_no == delivered + 1);
         assert(std::string(decoded.header.dest_node_id) == std::string("gw"));
-        assert(decoded.routing.version == 42);
-        assert(decoded.routing.entry_count == 1);
-        assert(std::string(decoded.routing.entries[0].neighbor_id) == "p1");
+        if (decoded.header.msg_type == MeshMsgType::Telemetry) {
+            assert(decoded.telemetry.rf_event.band == 1);
+            assert(decoded.telemetry.rf_event.timestamp_ms == decoded.header.seq_no);
+            assert(decoded.routing.entry_count == 0); // route table not carried
+        } else {
+            assert(decoded.header.msg_type == MeshMsgType::Routing);
+            assert(decoded.routing.version == 42);
+            assert(decoded.routing.entry_count == 1);
+            assert(std::string(decoded.routing.entries[0].neighbor_id) == "p1");
+            assert(decoded.telemetry.rf_event.timestamp_ms == 0); // telemetry not carried
+        }
         delivered++;
     });
 
-    for (uint32_t seq = 1; seq <= 3; ++seq) {
+    for (uint32_t seq = 1; seq <= 4; ++seq) {
         MeshFrame f = make_sample(seq);
         EncryptedFrame enc = encrypt_mesh_frame(f, key);
         radio.enqueue_to_air(enc);
     }
     radio.pump_air(0.0f, 77);
 
-    assert(delivered == 3);
+    assert(delivered == 4);
     return 0;
 }
@@ -0,0 +1,373 @@
+#include "mesh_encode.hpp"
+#include "mesh_schema.hpp"
+#include "telemetry.hpp"
+
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <string>
+
+static_assert(cbor_keys_dense(kSchemaHeader) && cbor_keys_dense(kSchemaSecurity) &&
+                  cbor_keys_dense(kSchemaCounters) && cbor_keys_dense(kSchemaRf) && cbor_keys_dense(kSchemaGps) &&
+                  cbor_keys_dense(kSchemaHealth) && cbor_keys_dense(kSchemaRouteEntry) &&
+                  cbor_keys_dense(kSchemaRouting) && cbor_keys_dense(kSchemaFault) && cbor_keys_dense(kSchemaOta) &&
+                  cbor_keys_dense(kSchemaRfV2) && cbor_keys_dense(kSchemaGpsV2) && cbor_keys_dense(kSchemaHealthV2),
+              "schema rows keyed 1..N");
+
+namespace {
+// Same frame as test_mesh_golden; the clear CBOR body is locked here so codec
+// changes are caught independently of the AES-GCM envelope.
+MeshFrame make_golden_frame() {
+    MeshFrame f{};
+    f.header.version = 1;
+    f.header.msg_type = MeshMsgType::Telemetry;
+    f.header.ttl = 3;
+    f.header.seq_no = 7;
+    std::snprintf(f.header.src_node_id, sizeof(f.header.src_node_id), "node-gold");
+    std::snprintf(f.header.dest_node_id, sizeof(f.header.dest_node_id), "gw");
+    f.security.encrypted = true;
+    f.security.nonce = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+    f.security.auth_tag.fill(0xAA);
+    f.counters.tx_counter = 7;
+    f.counters.replay_window = 1;
+    f.telemetry.rf_event.timestamp_ms = 1234;
+    f.telemetry.rf_event.center_freq_hz = 915000000;
+    f.telemetry.rf_event.features.avg_dbm = -55.5f;
+    f.telemetry.rf_event.features.peak_dbm = -42.0f;
+    f.telemetry.rf_event.anomaly_score = 0.12f;
+    f.telemetry.rf_event.model_version = 2;
+    f.telemetry.gps.timestamp_ms = 1234;
+    f.telemetry.gps.latitude_deg = 1.23f;
+    f.telemetry.gps.longitude_deg = 4.56f;
+    f.telemetry.gps.altitude_m = 7.89f;
+    f.telemetry.gps.num_sats = 8;
+    f.telemetry.gps.hdop = 1.1f;
+    f.telemetry.gps.valid_fix = true;
+    f.telemetry.gps.cn0_db_hz_avg = 38.0f;
+    f.telemetry.health.timestamp_ms = 1234;
+    f.telemetry.health.battery_v = 3.8f;
+    f.telemetry.health.temp_c = 26.0f;
+    f.telemetry.health.imu_tilt_deg = 0.4f;
+    f.routing.epoch_ms = 1234;
+    f.routing.version = 9;
+    f.routing.entry_count = 1;
+    std::snprintf(f.routing.entries[0].neighbor_id, sizeof(f.routing.entries[0].neighbor_id), "p1");
+    f.routing.entries[0].rssi_dbm = -60;
+    f.routing.entries[0].link_quality = 180;
+    f.routing.entries[0].cost = 1;
+    f.ota.state = OtaState::Idle;
+    return f;
+}
+
+std::string to_hex(const EncodedFrame& enc) {
+    static const char* hex = "0123456789ABCDEF";
+    std::string out;
+    for (std::size_t i = 0; i < enc.len; ++i) {
+        out.push_back(hex[enc.bytes[i] >> 4]);
+        out.push_back(hex[enc.bytes[i] & 0x0F]);
+    }
+    return out;
+}
+
+EncodedFrame from_bytes(std::initializer_list<uint8_t> bytes) {
+    EncodedFrame enc{};
+    std::copy(bytes.begin(), bytes.end(), enc.bytes.begin());
+    enc.len = bytes.size();
+    return enc;
+}
+
+void test_golden_clear_body() {
+    const EncodedFrame enc = encode_mesh_frame(make_golden_frame());
+    static const std::string golden =
+        "A701A70101020103030400050706696E6F64652D676F6C640762677702A30101024C000102030405060708090A0B0350AAAAAAAA"
+        "AAAAAAAAAAAAAAAAAAAAAAAA03A20107020104A6011904D2021A3689CAC003F81A00005EC204F81A000028C205F81A8FC2F53D0602"
+        "05AA011904D202F81AA4709D3F03F81A85EB914004F81AE17AFC40050806F81ACDCC8C3F0701080009000AF81A0000184206A50119"
+        "04D202F81A3333734003F81A0000D04104F81ACDCCCC3E050008A40100020003000400";
+    const std::string hex = to_hex(enc);
+    assert(hex == golden);
+    (void)hex;
+}
+
+MeshFrame make_full_frame(MeshMsgType type) {
+    MeshFrame f = make_golden_frame();
+    f.header.msg_type = type;
+    f.header.hop_count = 2;
+    f.header.seq_no = 70000;
+    f.telemetry.rf_event.band = 5;
+    f.telemetry.gps.jamming_detected = true;
+    f.telemetry.health.tamper_flag = true;
+    f.fault.fault_active = true;
+    f.fault.counters = {3, 300, 70000};
+    f.ota = {OtaState::Verifying, 4096, 1u << 20, true};
+    return f;
+}
+
+// Each type carries the envelope plus its own maps; everything else is left
+// out on the wire and untouched on decode.
+void test_layouts() {
+    const MeshMsgType types[] = {MeshMsgType::Telemetry, MeshMsgType::Routing, MeshMsgType::Control,
+                                 MeshMsgType::Ota};
+    std::size_t control_len = 0;
+    for (MeshMsgType type : types) {
+        const MeshFrame f = make_full_frame(type);
+        const uint16_t layout = mesh_layout(type);
+        const EncodedFrame enc = encode_mesh_frame(f);
+        assert(enc.len > 0 && enc.bytes[0] == (0xA0 | mesh_layout_count(layout)));
+        MeshFrame d{};
+        const bool ok = decode_mesh_frame_clear(enc, d);
+        assert(ok && d.header.msg_type == type && d.header.seq_no == 70000 && d.header.hop_count == 2);
+        assert(std::string(d.header.src_node_id) == "node-gold");
+        assert(d.security.nonce == f.security.nonce && d.security.auth_tag == f.security.auth_tag);
+        assert(d.counters.tx_counter == 7);
+
+        const bool telemetry = type == MeshMsgType::Telemetry;
+        assert(d.telemetry.rf_event.band == (telemetry ? 5 : 0));
+        assert(d.telemetry.rf_event.features.avg_dbm == (telemetry ? -55.5f : 0.0f));
+        assert(d.telemetry.gps.jamming_detected == telemetry);
+        assert(d.telemetry.health.tamper_flag == telemetry);
+        assert(d.fault.fault_active == telemetry && d.fault.counters.tamper_events == (telemetry ? 70000u : 0u));
+        const bool routing = type == MeshMsgType::Routing;
+        assert(d.routing.entry_count == (routing ? 1u : 0u) && d.routing.version == (routing ? 9u : 0u));
+        assert(!routing || d.routing.entries[0].rssi_dbm == -60);
+        const bool ota = type == MeshMsgType::Ota;
+        assert(d.ota.state == (ota ? OtaState::Verifying : OtaState::Idle) && d.ota.signature_valid == ota);
+
+        const EncodedFrame again = encode_mesh_frame(d);
+        assert(again.len == enc.len &&
+               std::equal(enc.bytes.begin(), enc.bytes.begin() + enc.len, again.bytes.begin()));
+        (void)ok;
+        (void)layout;
+        (void)telemetry;
+        (void)routing;
+        (void)ota;
+        (void)again;
+        if (type == MeshMsgType::Control) {
+            control_len = enc.len;
+        }
+    }
+    // The envelope alone is the smallest frame.
+    for (MeshMsgType type : types) {
+        const EncodedFrame enc = encode_mesh_frame(make_full_frame(type));
+        assert(enc.len >= control_len);
+        (void)enc;
+    }
+    (void)control_len;
+}
+
+// Frames that still carry all nine maps decode by their msg_type: a
+// Telemetry frame keeps its telemetry and drops the route table and OTA map.
+void test_legacy_all_maps() {
+    static const char* legacy =
+        "A901A70101020103030400050706696E6F64652D676F6C640762677702A30101024C000102030405060708090A0B0350AAAAAAAA"
+        "AAAAAAAAAAAAAAAAAAAAAAAA03A20107020104A6011904D2021A3689CAC003F81A00005EC204F81A000028C205F81A8FC2F53D0602"
+        "05AA011904D202F81AA4709D3F03F81A85EB914004F81AE17AFC40050806F81ACDCC8C3F0701080009000AF81A0000184206A50119"
+        "04D202F81A3333734003F81A0000D04104F81ACDCCCC3E050007A4011904D202090381A4016270310218C40318B404010401"
+        "08A4010002000300040009A40100020003000400";
+    EncodedFrame enc{};
+    for (std::size_t i = 0; legacy[2 * i] != '\0'; ++i) {
+        enc.bytes[i] = static_cast<uint8_t>(std::stoi(std::string(legacy + 2 * i, 2), nullptr, 16));
+        enc.len = i + 1;
+    }
+    MeshFrame d{};
+    const bool ok = decode_mesh_frame_clear(enc, d);
+    (void)ok;
+    assert(ok);
+    assert(d.header.msg_type == MeshMsgType::Telemetry && d.header.seq_no == 7);
+    assert(d.telemetry.rf_event.timestamp_ms == 1234 && d.telemetry.gps.num_sats == 8);
+    assert(d.routing.entry_count == 0 && d.routing.epoch_ms == 0);
+    (void)d;
+}
+
+// Each route adds a fixed number of bytes for a given name length, so the
+// frame length is linear in the route count. Encoding must fail exactly when
+// that length exceeds kMaxMeshFrameLen, including when the routing map only
+// fits through the staged path.
+void test_frame_cap() {
+    bool staged_fit = false;
+    for (std::size_t name_len = 0; name_len < kMaxNodeIdLength; ++name_len) {
+        MeshFrame f = make_golden_frame();
+        f.header.msg_type = MeshMsgType::Routing;
+        for (RouteEntry& e : f.routing.entries) {
+            std::memset(e.neighbor_id, 0, sizeof(e.neighbor_id));
+            std::memset(e.neighbor_id, 'n', name_len);
+            e.rssi_dbm = -70;
+            e.link_quality = 200;
+            e.cost = 3;
+        }
+        f.routing.entry_count = 0;
+        const std::size_t base_len = encode_mesh_frame(f).len;
+        f.routing.entry_count = 1;
+        const std::size_t entry_len = encode_mesh_frame(f).len - base_len;
+        for (std::size_t routes = 0; routes <= kMaxRoutes; ++routes) {
+            f.routing.entry_count = routes;
+            const EncodedFrame enc = encode_mesh_frame(f);
+            const std::size_t expected = base_len + routes * entry_len;
+            (void)enc;
+            if (expected > kMaxMeshFrameLen) {
+                assert(enc.len == 0);
+                continue;
+            }
+            assert(enc.len == expected);
+            MeshFrame d{};
+            const bool ok = decode_mesh_frame_clear(enc, d);
+            assert(ok && d.routing.entry_count == routes);
+            (void)ok;
+            (void)d;
+            staged_fit = staged_fit || routes * kSchemaRouteEntryMaxLen > kMaxMeshFrameLen - base_len;
+        }
+    }
+    assert(staged_fit);
+    (void)staged_fit;
+}
+
+void test_decode_tolerance() {
+    // {1: {2: 1}, 4: {7: 3, 1: 1000, 12: "xy"}, 10: [1, 2]}: out-of-order and unknown keys.
+    const EncodedFrame enc = from_bytes({0xA3, 0x01, 0xA1, 0x02, 0x01, 0x04, 0xA3, 0x07, 0x03, 0x01, 0x19, 0x03,
+                                         0xE8, 0x0C, 0x62, 0x78, 0x79, 0x0A, 0x82, 0x01, 0x02});
+    MeshFrame d{};
+    bool ok = decode_mesh_frame_clear(enc, d);
+    (void)ok;
+    assert(ok);
+    assert(d.telemetry.rf_event.band == 3 && d.telemetry.rf_event.timestamp_ms == 1000);
+    (void)enc;
+    (void)d;
+
+    // Wrong type for a known key.
+    ok = decode_mesh_frame_clear(from_bytes({0xA2, 0x01, 0xA0, 0x04, 0xA1, 0x01, 0x62, 0x78, 0x79}), d);
+    assert(!ok);
+    // The header must lead the frame.
+    ok = decode_mesh_frame_clear(from_bytes({0xA2, 0x03, 0xA0, 0x01, 0xA0}), d);
+    assert(!ok);
+
+    // Every strict prefix of a valid frame is rejected.
+    const EncodedFrame full = encode_mesh_frame(make_golden_frame());
+    for (std::size_t len = 0; len < full.len; ++len) {
+        EncodedFrame cut = full;
+        cut.len = len;
+        MeshFrame out{};
+        ok = decode_mesh_frame_clear(cut, out);
+        assert(!ok);
+    }
+}
+
+// Schema v2 is the golden frame with header.version = 2: same maps, with
+// the float rows quantised.
+void test_schema_v2() {
+    MeshFrame f = make_golden_frame();
+    f.header.version = kMeshSchemaV2;
+    const EncodedFrame enc = encode_mesh_frame(f);
+    static const std::string golden =
+        "A701A70102020103030400050706696E6F64652D676F6C640762677702A30101024C000102030405060708090A0B0350AAAAAAAA"
+        "AAAAAAAAAAAAAAAAAAAAAAAA03A20107020104A6011904D2021A3689CAC003386E04385305F92FAE060205AA011904D2021A0012"
+        "C4B0031A0045948004184F0508060B0701080009000AF950C006A5011904D202190ED8031901040404050008A401000200030004"
+        "00";
+    const std::string hex = to_hex(enc);
+    assert(hex == golden);
+    (void)hex;
+    // 28 bytes under v1 is enough to keep a telemetry frame in one fragment.
+    const std::size_t v1_len = encode_mesh_frame(make_golden_frame()).len;
+    assert(enc.len + 28 <= v1_len);
+    (void)v1_len;
+
+    MeshFrame d{};
+    bool ok = decode_mesh_frame_clear(enc, d);
+    (void)ok;
+    assert(ok && d.header.version == kMeshSchemaV2 && d.header.seq_no == 7);
+    const auto near = [](float got, float want, float step) { return std::fabs(got - want) <= step / 2 + 1e-6f; };
+    (void)near;
+    assert(d.telemetry.rf_event.features.avg_dbm == -55.5f && d.telemetry.rf_event.features.peak_dbm == -42.0f);
+    assert(near(d.telemetry.rf_event.anomaly_score, 0.12f, 0.12f / 1024));
+    assert(d.telemetry.rf_event.center_freq_hz == 915000000 && d.telemetry.rf_event.model_version == 2);
+    assert(near(d.telemetry.gps.latitude_deg, 1.23f, 1e-6f) && near(d.telemetry.gps.longitude_deg, 4.56f, 1e-6f));
+    assert(near(d.telemetry.gps.altitude_m, 7.89f, 0.1f) && near(d.telemetry.gps.hdop, 1.1f, 0.1f));
+    assert(d.telemetry.gps.cn0_db_hz_avg == 38.0f && d.telemetry.gps.num_sats == 8 && d.telemetry.gps.valid_fix);
+    assert(near(d.telemetry.health.battery_v, 3.8f, 0.001f) && near(d.telemetry.health.temp_c, 26.0f, 0.1f));
+    assert(near(d.telemetry.health.imu_tilt_deg, 0.4f, 0.1f));
+    // Quantised values re-encode to the same bytes.
+    const EncodedFrame again = encode_mesh_frame(d);
+    assert(again.len == enc.len && std::equal(enc.bytes.begin(), enc.bytes.begin() + enc.len, again.bytes.begin()));
+    (void)again;
+
+    // Negative, saturating and non-finite inputs.
+    f.telemetry.gps.latitude_deg = -45.123456f;
+    f.telemetry.gps.longitude_deg = -179.999f;
+    f.telemetry.gps.altitude_m = -12.34f;
+    f.telemetry.health.temp_c = -40.05f;
+    f.telemetry.health.battery_v = std::numeric_limits<float>::quiet_NaN();
+    f.telemetry.health.imu_tilt_deg = 1e30f;
+    f.telemetry.rf_event.anomaly_score = 1e6f;
+    d = MeshFrame{};
+    ok = decode_mesh_frame_clear(encode_mesh_frame(f), d);
+    assert(ok && near(d.telemetry.gps.latitude_deg, -45.123456f, 8e-6f));
+    assert(near(d.telemetry.gps.longitude_deg, -179.999f, 3e-5f));
+    assert(near(d.telemetry.gps.altitude_m, -12.34f, 0.1f) && near(d.telemetry.health.temp_c, -40.05f, 0.1f));
+    assert(d.telemetry.health.battery_v == 0.0f);
+    assert(d.telemetry.health.imu_tilt_deg == 2147483647.0f / 10.0f);
+    assert(std::isinf(d.telemetry.rf_event.anomaly_score));
+
+    // v1 frames still decode exactly next to v2 ones.
+    d = MeshFrame{};
+    ok = decode_mesh_frame_clear(encode_mesh_frame(make_golden_frame()), d);
+    assert(ok && d.header.version == kMeshSchemaV1 && d.telemetry.gps.latitude_deg == 1.23f);
+}
+
+// Every non-NaN half value survives the round trip exactly, and in-between
+// floats round to nearest even.
+void test_half_floats() {
+    MeshFrame f = make_golden_frame();
+    f.header.version = kMeshSchemaV2;
+    const auto round_trip = [&f](float v) {
+        f.telemetry.rf_event.anomaly_score = v;
+        MeshFrame d{};
+        const bool ok = decode_mesh_frame_clear(encode_mesh_frame(f), d);
+        assert(ok);
+        (void)ok;
+        return d.telemetry.rf_event.anomaly_score;
+    };
+    for (uint32_t h = 0; h < 0x10000; ++h) {
+        const int exp = static_cast<int>((h >> 10) & 0x1F);
+        const int mant = static_cast<int>(h & 0x3FF);
+        if (exp == 0x1F && mant != 0) {
+            continue;
+        }
+        float v = exp == 0x1F ? std::numeric_limits<float>::infinity()
+                              : std::ldexp(static_cast<float>(exp == 0 ? mant : 1024 + mant), (exp == 0 ? 1 : exp) - 25);
+        v = (h & 0x8000) != 0 ? -v : v;
+        const float got = round_trip(v);
+        assert(got == v && std::signbit(got) == std::signbit(v));
+        (void)got;
+    }
+    const float nan_back = round_trip(std::numeric_limits<float>::quiet_NaN());
+    const float tie_even = round_trip(1.0f + std::ldexp(1.0f, -11));
+    const float tie_odd = round_trip(1.0f + 3 * std::ldexp(1.0f, -11));
+    const float largest = round_trip(65519.0f);
+    const float overflow = round_trip(65520.0f);
+    const float half_min = round_trip(std::ldexp(1.0f, -25));
+    const float above_half_min = round_trip(1.5f * std::ldexp(1.0f, -25));
+    assert(std::isnan(nan_back));
+    assert(tie_even == 1.0f && tie_odd == 1.0f + std::ldexp(1.0f, -9));
+    assert(largest == 65504.0f && std::isinf(overflow));
+    assert(half_min == 0.0f && above_half_min == std::ldexp(1.0f, -24));
+    (void)nan_back;
+    (void)tie_even;
+    (void)tie_odd;
+    (void)largest;
+    (void)overflow;
+    (void)half_min;
+    (void)above_half_min;
+}
+
+} // namespace
+
+int main() {
+    test_golden_clear_body();
+    test_layouts();
+    test_legacy_all_maps();
+    test_frame_cap();
+    test_decode_tolerance();
+    test_schema_v2();
+    test_half_floats();
+    return 0;
+}
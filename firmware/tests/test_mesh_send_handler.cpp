@@ -1,13 +1,17 @@
 #include "mesh.hpp"
 #include "telemetry.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <cstdio>
+#include <cstring>
 
 static bool g_called = false;
+static LinkPacket g_last{};
 
-static bool failing_sender(const EncryptedFrame&) {
+static bool failing_sender(const LinkPacket& packet) {
     g_called = true;
+    g_last = packet;
     return false;
 }
 
@@ -33,5 +37,27 @@ int main() {
     (void)ok;
     assert(!ok);
     assert(g_called);
+
+    // A sealed frame resends byte for byte, matching what send_mesh_frame built.
+    // The handler fails the first link packet, so that is the last one sent:
+    // the fragment header, then the head of the sealed bytes.
+    const auto same_bytes = [](const EncryptedFrame& sealed, const LinkPacket& packet) {
+        const std::size_t head = std::min(sealed.len, kFragmentPayload);
+        return packet.len == kFragmentHeaderLen + head && packet.bytes[4] == mesh_fragment_count(sealed.len) - 1 &&
+               std::memcmp(sealed.bytes.data(), packet.bytes.data() + kFragmentHeaderLen, head) == 0;
+    };
+    EncryptedFrame sealed{};
+    bool sealed_ok = seal_mesh_frame(frame, sealed);
+    (void)sealed_ok;
+    assert(sealed_ok && same_bytes(sealed, g_last));
+    g_last = LinkPacket{};
+    ok = send_sealed_frame(sealed);
+    assert(!ok && same_bytes(sealed, g_last));
+    (void)same_bytes;
+
+    // Expired frames are refused before anything is encoded.
+    frame.header.hop_count = frame.header.ttl;
+    sealed_ok = seal_mesh_frame(frame, sealed);
+    assert(!sealed_ok && sealed.len == 0);
     return 0;
 }
@@ -0,0 +1,200 @@
+#include "mesh.hpp"
+#include "mesh_encode.hpp"
+#include "mesh_schema.hpp"
+#include "telemetry.hpp"
+
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+namespace {
+constexpr uint8_t field(MeshHeaderKey key) {
+    return static_cast<uint8_t>(key);
+}
+
+MeshFrame make_frame(MeshMsgType type, uint32_t seq, uint8_t ttl, uint8_t hop_count) {
+    MeshFrame f{};
+    f.header.version = 1;
+    f.header.msg_type = type;
+    f.header.ttl = ttl;
+    f.header.hop_count = hop_count;
+    f.header.seq_no = seq;
+    std::snprintf(f.header.src_node_id, sizeof(f.header.src_node_id), "node-view");
+    std::snprintf(f.header.dest_node_id, sizeof(f.header.dest_node_id), "gw");
+    f.security.encrypted = true;
+    f.security.nonce = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+    f.counters.tx_counter = seq;
+    f.telemetry.rf_event.timestamp_ms = 1234;
+    f.telemetry.rf_event.center_freq_hz = 915000000;
+    f.telemetry.rf_event.features = {-55.5f, -42.0f};
+    f.telemetry.rf_event.anomaly_score = 0.12f;
+    f.telemetry.gps.num_sats = 8;
+    f.telemetry.health.battery_v = 3.8f;
+    f.fault.counters.watchdog_resets = 2;
+    f.routing.version = 9;
+    f.routing.entry_count = 2;
+    std::snprintf(f.routing.entries[0].neighbor_id, sizeof(f.routing.entries[0].neighbor_id), "p1");
+    std::snprintf(f.routing.entries[1].neighbor_id, sizeof(f.routing.entries[1].neighbor_id), "p2");
+    f.routing.entries[1].rssi_dbm = -70;
+    f.ota.state = OtaState::Downloading;
+    f.ota.current_offset = 4096;
+    return f;
+}
+
+// Single-field reads match the encoded frame, and decoding every carried map
+// through the view rebuilds the same bytes as the full decoder.
+void test_fields_and_maps() {
+    for (MeshMsgType type : {MeshMsgType::Telemetry, MeshMsgType::Routing, MeshMsgType::Control, MeshMsgType::Ota}) {
+        const MeshFrame src = make_frame(type, 11, 5, 2);
+        const EncodedFrame enc = encode_mesh_frame(src);
+        assert(enc.len > 0);
+        MeshFrameView view;
+        const bool opened = mesh_frame_view_open(enc.bytes.data(), enc.len, view);
+        assert(opened);
+
+        uint32_t v = 0;
+        assert(mesh_frame_view_uint(view, MeshMapKey::Header, field(MeshHeaderKey::Ttl), v) && v == 5);
+        assert(mesh_frame_view_uint(view, MeshMapKey::Header, field(MeshHeaderKey::HopCount), v) && v == 2);
+        assert(mesh_frame_view_uint(view, MeshMapKey::Header, field(MeshHeaderKey::SeqNo), v) && v == 11);
+        assert(mesh_frame_view_uint(view, MeshMapKey::Header, field(MeshHeaderKey::MsgType), v) &&
+               v == static_cast<uint32_t>(type));
+        const char* text = nullptr;
+        std::size_t len = 0;
+        const bool found = mesh_frame_view_text(view, MeshMapKey::Header, field(MeshHeaderKey::SrcNodeId), text, len);
+        assert(found && std::string(text, len) == "node-view");
+        // Wrong type and missing key are both misses.
+        assert(!mesh_frame_view_text(view, MeshMapKey::Header, field(MeshHeaderKey::Ttl), text, len));
+        assert(!mesh_frame_view_uint(view, MeshMapKey::Header, 20, v));
+
+        const uint16_t layout = mesh_layout(type);
+        MeshFrame rebuilt{};
+        for (uint8_t k = 1; k <= kMeshMapCount; ++k) {
+            const auto map = static_cast<MeshMapKey>(k);
+            const bool carried = (layout & mesh_map_bit(map)) != 0;
+            const bool decoded = mesh_frame_view_decode(view, map, rebuilt);
+            assert(mesh_frame_view_has(view, map) == carried && decoded == carried);
+            (void)carried;
+            (void)decoded;
+        }
+        const EncodedFrame again = encode_mesh_frame(rebuilt);
+        assert(again.len == enc.len && std::memcmp(again.bytes.data(), enc.bytes.data(), enc.len) == 0);
+
+        if (type == MeshMsgType::Telemetry) {
+            float score = 0.0f;
+            assert(mesh_frame_view_float(view, MeshMapKey::Rf, 5, score) && score == 0.12f);
+            assert(mesh_frame_view_uint(view, MeshMapKey::Rf, 2, v) && v == 915000000);
+            assert(!mesh_frame_view_float(view, MeshMapKey::Routing, 1, score));
+            (void)score;
+        }
+        (void)enc;
+        (void)opened;
+        (void)found;
+        (void)again;
+        (void)v;
+        (void)text;
+        (void)len;
+    }
+}
+
+// Float reads follow the frame's schema version: v2 rows come back from
+// their half-float and scaled-integer forms.
+void test_v2_floats() {
+    MeshFrame src = make_frame(MeshMsgType::Telemetry, 4, 5, 0);
+    src.header.version = kMeshSchemaV2;
+    src.telemetry.gps.latitude_deg = 1.5f;
+    src.telemetry.health.temp_c = -12.5f;
+    const EncodedFrame enc = encode_mesh_frame(src);
+    MeshFrameView view;
+    const bool opened = mesh_frame_view_open(enc.bytes.data(), enc.len, view);
+    assert(opened && view.version == kMeshSchemaV2);
+    (void)opened;
+    float v = 0.0f;
+    assert(mesh_frame_view_float(view, MeshMapKey::Rf, 3, v) && v == -55.5f);
+    assert(mesh_frame_view_float(view, MeshMapKey::Rf, 5, v) && std::fabs(v - 0.12f) < 1e-4f);
+    assert(mesh_frame_view_float(view, MeshMapKey::Gps, 2, v) && v == 1.5f);
+    assert(mesh_frame_view_float(view, MeshMapKey::Health, 2, v) && std::fabs(v - 3.8f) < 1e-6f);
+    assert(mesh_frame_view_float(view, MeshMapKey::Health, 3, v) && v == -12.5f);
+    // The uint accessor reads the raw wire integer.
+    uint32_t u = 0;
+    assert(mesh_frame_view_uint(view, MeshMapKey::Gps, 2, u) && u == 1500000);
+    (void)v;
+    (void)u;
+    (void)enc;
+}
+
+void test_malformed() {
+    const EncodedFrame enc = encode_mesh_frame(make_frame(MeshMsgType::Routing, 3, 4, 0));
+    MeshFrameView view;
+    // Open checks the header only: a truncated header is rejected there, and
+    // a truncated tail when its maps are first asked for.
+    std::size_t header_end = 0;
+    for (std::size_t n = 0; n < enc.len; ++n) {
+        if (mesh_frame_view_open(enc.bytes.data(), n, view)) {
+            header_end = header_end == 0 ? n : header_end;
+            assert(mesh_frame_view_has(view, MeshMapKey::Header));
+            assert(!mesh_frame_view_has(view, MeshMapKey::Routing));
+        } else {
+            assert(header_end == 0);
+            assert(!mesh_frame_view_has(view, MeshMapKey::Header));
+        }
+    }
+    assert(header_end > 0);
+    bool opened = mesh_frame_view_open(enc.bytes.data(), enc.len, view);
+    assert(opened && mesh_frame_view_has(view, MeshMapKey::Routing));
+    // Header must lead.
+    const uint8_t no_header[] = {0xA1, 0x02, 0xA0};
+    opened = mesh_frame_view_open(no_header, sizeof(no_header), view);
+    assert(!opened);
+    opened = mesh_frame_view_open(nullptr, 0, view);
+    assert(!opened);
+    (void)opened;
+    (void)header_end;
+}
+
+// should_forward_view makes the same TTL and duplicate decisions as
+// should_forward_frame without decoding.
+void test_forward_decision() {
+    init_mesh();
+    reset_mesh_metrics();
+    MeshFrameView view;
+
+    EncodedFrame enc = encode_mesh_frame(make_frame(MeshMsgType::Telemetry, 1, 3, 1));
+    bool opened = mesh_frame_view_open(enc.bytes.data(), enc.len, view);
+    bool forward = should_forward_view(view);
+    assert(opened && forward);
+    // Same source and seq again: a duplicate.
+    forward = should_forward_view(view);
+    assert(!forward);
+
+    // The frame path shares the seen window.
+    MeshFrame f = make_frame(MeshMsgType::Telemetry, 1, 3, 1);
+    forward = should_forward_frame(f);
+    assert(!forward);
+    f.header.seq_no = 2;
+    forward = should_forward_frame(f);
+    assert(forward && f.header.hop_count == 2);
+
+    enc = encode_mesh_frame(make_frame(MeshMsgType::Telemetry, 3, 2, 2));
+    opened = mesh_frame_view_open(enc.bytes.data(), enc.len, view);
+    forward = should_forward_view(view);
+    assert(opened && !forward);
+    assert(mesh_metrics().ttl_drops == 1);
+
+    MeshFrameView empty;
+    forward = should_forward_view(empty);
+    assert(!forward);
+    (void)opened;
+    (void)forward;
+    (void)f;
+}
+} // namespace
+
+int main() {
+    test_fields_and_maps();
+    test_v2_floats();
+    test_malformed();
+    test_forward_decision();
+    return 0;
+}
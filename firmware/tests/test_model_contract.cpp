@@ -1,4 +1,5 @@
 #include "telemetry.hpp"
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 #include <fstream>
@@ -0,0 +1,123 @@
+#include "prescreen.hpp"
+
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+namespace {
+PrescreenConfig make_config() {
+    PrescreenConfig cfg{};
+    cfg.enabled = true;
+    cfg.trigger_db = 6.0f;  // x3.98
+    cfg.release_db = 3.0f;  // x2.0
+    cfg.hold_windows = 3;
+    cfg.full_scan_every = 8;
+    return cfg;
+}
+
+void test_energy() {
+    std::vector<int16_t> w(128, 700);
+    assert(window_ac_energy(w.data(), w.size()) == 0.0f); // DC offset is not energy
+    for (std::size_t i = 0; i < w.size(); ++i) {
+        w[i] = static_cast<int16_t>(i % 2 ? 700 + 30 : 700 - 30);
+    }
+    assert(std::fabs(window_ac_energy(w.data(), w.size()) - 900.0f) < 1e-3f);
+    assert(window_ac_energy(nullptr, 4) == 0.0f);
+    assert(window_ac_energy(w.data(), 0) == 0.0f);
+}
+
+// Quiet input: one full scan to seed the floor, then only the periodic scans.
+void test_quiet_skips() {
+    const PrescreenConfig cfg = make_config();
+    PrescreenState st{};
+    PrescreenStats stats{};
+    std::vector<PrescreenDecision> got;
+    for (int i = 0; i < 17; ++i) {
+        got.push_back(prescreen_update(st, cfg, 100.0f, &stats));
+    }
+    assert(got[0] == PrescreenDecision::ForcedScan);
+    for (int i = 1; i < 8; ++i) {
+        assert(got[i] == PrescreenDecision::Skip);
+    }
+    assert(got[8] == PrescreenDecision::ForcedScan);
+    assert(got[16] == PrescreenDecision::ForcedScan);
+    assert(stats.windows == 17 && stats.skipped == 14 && stats.forced_scans == 3);
+    assert(stats.escalated == 0 && stats.triggers == 0);
+
+    PrescreenConfig never = cfg;
+    never.full_scan_every = 0;
+    PrescreenState quiet{};
+    prescreen_update(quiet, never, 100.0f);
+    for (int i = 0; i < 50; ++i) {
+        const PrescreenDecision d = prescreen_update(quiet, never, 100.0f);
+        assert(d == PrescreenDecision::Skip);
+        (void)d;
+    }
+}
+
+// Trigger above +6 dB, stay escalated while above +3 dB, release after the
+// energy has been below +3 dB for hold_windows windows.
+void test_hysteresis() {
+    const PrescreenConfig cfg = make_config();
+    PrescreenState st{};
+    PrescreenStats stats{};
+    prescreen_update(st, cfg, 100.0f, &stats);
+    PrescreenDecision d = prescreen_update(st, cfg, 350.0f, &stats);
+    (void)d;
+    assert(d == PrescreenDecision::Skip); // +5.4 dB
+    const float floor_before = st.noise_floor;
+    d = prescreen_update(st, cfg, 500.0f, &stats);
+    assert(d == PrescreenDecision::Escalate);
+    d = prescreen_update(st, cfg, 250.0f, &stats);
+    assert(d == PrescreenDecision::Escalate); // above release
+    d = prescreen_update(st, cfg, 100.0f, &stats);
+    assert(d == PrescreenDecision::Escalate); // hold 2
+    d = prescreen_update(st, cfg, 100.0f, &stats);
+    assert(d == PrescreenDecision::Escalate); // hold 1
+    d = prescreen_update(st, cfg, 100.0f, &stats);
+    assert(d == PrescreenDecision::Skip); // released
+    assert(!st.escalated);
+    // The floor does not learn from escalated windows.
+    assert(st.noise_floor == floor_before);
+    (void)floor_before;
+    assert(stats.triggers == 1 && stats.escalated == 4);
+
+    // A second burst re-triggers.
+    d = prescreen_update(st, cfg, 2000.0f, &stats);
+    assert(d == PrescreenDecision::Escalate && stats.triggers == 2);
+}
+
+// The floor follows slow drifts in quiet windows, so a gradual rise does not trigger.
+void test_floor_tracking() {
+    const PrescreenConfig cfg = make_config();
+    PrescreenState st{};
+    prescreen_update(st, cfg, 100.0f);
+    float energy = 100.0f;
+    for (int i = 0; i < 200; ++i) {
+        energy *= 1.02f;
+        const PrescreenDecision d = prescreen_update(st, cfg, energy);
+        assert(d != PrescreenDecision::Escalate);
+        (void)d;
+    }
+    assert(st.noise_floor > 1000.0f);
+    // Silence clamps at the minimum floor instead of reaching zero.
+    PrescreenState silent{};
+    for (int i = 0; i < 100; ++i) {
+        prescreen_update(silent, cfg, 0.0f);
+    }
+    assert(silent.noise_floor >= 1.0f);
+    const PrescreenDecision d = prescreen_update(silent, cfg, 2.0f);
+    assert(d == PrescreenDecision::Skip);
+    (void)d;
+}
+} // namespace
+
+int main() {
+    test_energy();
+    test_quiet_skips();
+    test_hysteresis();
+    test_floor_tracking();
+    std::printf("prescreen tests passed\n");
+    return 0;
+}
@@ -0,0 +1,185 @@
+#include "adc.hpp"
+#include "replay_source.hpp"
+#include "window_pool.hpp"
+#include "window_profile.hpp"
+
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifndef OL_TEST_DATA_DIR
+#define OL_TEST_DATA_DIR "../tests"
+#endif
+#ifndef OL_AI_DATA_DIR
+#define OL_AI_DATA_DIR "../../ai/data"
+#endif
+
+// tests/replay_fixture.npz was written with
+//   np.savez(path, iq_real=np.arange(-150, 150, dtype=np.int16).reshape(3, 100),
+//            gain=np.array([0.5, -0.25, 1.5], dtype='<f8'))
+namespace {
+const std::string kFixture = std::string(OL_TEST_DATA_DIR) + "/replay_fixture.npz";
+
+void test_header_errors() {
+    NpyInfo info{};
+    const char good[] = "\x93NUMPY\x01\x00\x36\x00{'descr': '<i2', 'fortran_order': False, 'shape': (4,), }\n"
+                        "\x01\x00\x02\x00\x03\x00\x04\x00";
+    const auto* g = reinterpret_cast<const uint8_t*>(good);
+    ReplayError err = npy_parse_header(g, sizeof(good) - 1, info);
+    (void)err;
+    assert(err == ReplayError::None);
+    assert(info.dtype == NpyDtype::Int16 && info.count == 4 && info.header_bytes == 64);
+    err = npy_parse_header(g, 70, info);
+    assert(err == ReplayError::Truncated);
+
+    std::string big_endian(good, sizeof(good) - 1);
+    big_endian.replace(big_endian.find("<i2"), 3, ">i2");
+    err = npy_parse_header(reinterpret_cast<const uint8_t*>(big_endian.data()), big_endian.size(), info);
+    assert(err == ReplayError::UnsupportedDtype);
+    std::string fortran(good, sizeof(good) - 1);
+    fortran.replace(fortran.find("False"), 5, "True ");
+    err = npy_parse_header(reinterpret_cast<const uint8_t*>(fortran.data()), fortran.size(), info);
+    assert(err == ReplayError::FortranOrder);
+    err = npy_parse_header(reinterpret_cast<const uint8_t*>("PK\x03\x04......"), 10, info);
+    assert(err == ReplayError::NotNpy);
+    (void)info;
+}
+
+// A shipped raw capture decodes to the same counts as an independent read.
+void test_raw_npy() {
+    const std::string path = std::string(OL_AI_DATA_DIR) + "/raw/normal_54.npy";
+    ReplaySource src;
+    const ReplayError err = replay_open(src, path.c_str());
+    assert(err == ReplayError::None);
+    (void)err;
+    assert(src.info.dtype == NpyDtype::Float32);
+    assert(src.info.count == 1024);
+
+    FILE* f = std::fopen(path.c_str(), "rb");
+    assert(f != nullptr);
+    std::vector<float> ref(1024);
+    std::fseek(f, static_cast<long>(src.info.header_bytes), SEEK_SET);
+    const std::size_t got = std::fread(ref.data(), sizeof(float), ref.size(), f);
+    std::fclose(f);
+    assert(got == ref.size());
+    (void)got;
+
+    std::vector<int16_t> out(1000);
+    std::size_t n = replay_read(src, out.data(), out.size());
+    assert(n == 1000);
+    for (std::size_t i = 0; i < out.size(); ++i) {
+        assert(out[i] == static_cast<int16_t>(std::lround(ref[i] * 2048.0f)));
+    }
+    // Without looping the tail is short and then empty; with looping it wraps.
+    n = replay_read(src, out.data(), out.size());
+    assert(n == 24);
+    n = replay_read(src, out.data(), out.size());
+    assert(n == 0);
+    assert(src.passes >= 1);
+    replay_rewind(src);
+    src.loop = true;
+    n = replay_read(src, out.data(), out.size());
+    assert(n == 1000);
+    n = replay_read(src, out.data(), out.size());
+    assert(n == 1000);
+    (void)n;
+    assert(out[24] == static_cast<int16_t>(std::lround(ref[0] * 2048.0f)));
+    replay_close(src);
+    assert(src.map == nullptr);
+}
+
+void test_npz() {
+    ReplaySource src;
+    ReplayError err = replay_open(src, kFixture.c_str(), "iq_real");
+    assert(err == ReplayError::None);
+    assert(src.info.dtype == NpyDtype::Int16 && src.info.count == 300);
+    std::vector<int16_t> out(300);
+    std::size_t n = replay_read(src, out.data(), out.size());
+    assert(n == 300);
+    for (std::size_t i = 0; i < out.size(); ++i) {
+        assert(out[i] == static_cast<int16_t>(static_cast<int>(i) - 150));
+    }
+
+    err = replay_open(src, kFixture.c_str(), "gain.npy");
+    assert(err == ReplayError::None);
+    assert(src.info.dtype == NpyDtype::Float64 && src.info.count == 3);
+    src.scale = 100.0f;
+    n = replay_read(src, out.data(), 3);
+    assert(n == 3);
+    assert(out[0] == 50 && out[1] == -25 && out[2] == 150);
+
+    err = replay_open(src, kFixture.c_str(), "missing");
+    assert(err == ReplayError::MemberNotFound);
+    err = replay_open(src, kFixture.c_str());
+    assert(err == ReplayError::MemberNotFound);
+    assert(src.map == nullptr);
+    // The shipped IQ archive is np.savez_compressed output: deflated members cannot be mapped.
+    const std::string iq = std::string(OL_AI_DATA_DIR) + "/iq/iq_samples.npz";
+    err = replay_open(src, iq.c_str(), "iq_real");
+    assert(err == ReplayError::CompressedMember);
+    err = replay_open(src, "/nonexistent.npy");
+    assert(err == ReplayError::OpenFailed);
+    (void)err;
+    (void)n;
+}
+
+// Unpaced replay through continuous capture: every complete window arrives,
+// none dropped, with the file's samples in order.
+void test_capture_replay() {
+    const bool selected = window_profile_select(128);
+    assert(selected);
+    (void)selected;
+    ReplaySource src;
+    const ReplayError err = replay_open(src, kFixture.c_str(), "iq_real");
+    assert(err == ReplayError::None);
+    (void)err;
+
+    AdcCaptureConfig cfg{};
+    cfg.host_source = replay_source_read;
+    cfg.host_source_ctx = &src;
+    cfg.host_paced = false;
+    const bool started = adc_capture_start(cfg);
+    assert(started);
+    (void)started;
+
+    std::size_t windows = 0;
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (std::chrono::steady_clock::now() < deadline) {
+        uint64_t first = 0;
+        const WindowHandle h = adc_capture_take_handle(&first);
+        if (h == kNoWindow) {
+            if (adc_capture_stats().source_done && !adc_capture_pending()) {
+                break;
+            }
+            std::this_thread::yield();
+            continue;
+        }
+        const RfWindow* w = window_pool_get(h);
+        assert(w->sample_count == 128);
+        for (std::size_t i = 0; i < w->sample_count; ++i) {
+            assert(w->samples[i] == static_cast<int16_t>(static_cast<int>(first + i) - 150));
+        }
+        (void)w;
+        window_pool_release(h);
+        ++windows;
+    }
+    adc_capture_stop();
+    assert(windows == 300 / 128);
+    assert(adc_capture_stats().windows_dropped == 0);
+    replay_close(src);
+}
+} // namespace
+
+int main() {
+    test_header_errors();
+    test_raw_npy();
+    test_npz();
+    test_capture_replay();
+    std::printf("replay source tests passed\n");
+    return 0;
+}
@@ -0,0 +1,136 @@
+#include "autoencoder.hpp"
+#include "fft.hpp"
+#include "model_inference.hpp"
+#include "rf_batch.hpp"
+
+#include <cassert>
+#include <cmath>
+#include <complex>
+#include <cstdio>
+#include <vector>
+
+static int16_t sample_at(std::size_t w, std::size_t i) {
+    const double tone = 1500.0 * std::cos(0.19 * static_cast<double>((w + 1) * i));
+    return static_cast<int16_t>(std::lround(tone) + static_cast<long>((i * 37 + w * 11) % 97) - 48);
+}
+
+static void test_fft_batch_matches_single() {
+    constexpr std::size_t kN = 64;
+    constexpr std::size_t kBatch = 5;
+    FftPlan plan;
+    const bool ok = fft_plan_init(plan, 256);
+    assert(ok);
+    (void)ok;
+
+    // Complex.
+    std::vector<std::complex<float>> batch(kN * kBatch);
+    std::vector<std::vector<std::complex<float>>> single(kBatch, std::vector<std::complex<float>>(kN));
+    for (std::size_t b = 0; b < kBatch; ++b) {
+        for (std::size_t i = 0; i < kN; ++i) {
+            const std::complex<float> v{static_cast<float>(sample_at(b, i)), static_cast<float>(sample_at(b, i + 7))};
+            single[b][i] = v;
+            batch[i * kBatch + b] = v;
+        }
+        fft_complex(plan, single[b].data(), kN);
+    }
+    fft_complex_batch(plan, batch.data(), kN, kBatch);
+    for (std::size_t b = 0; b < kBatch; ++b) {
+        for (std::size_t k = 0; k < kN; ++k) {
+            assert(batch[k * kBatch + b] == single[b][k]);
+        }
+    }
+
+    // Real input.
+    std::vector<std::complex<float>> packed((kN / 2 + 1) * kBatch);
+    std::vector<std::complex<float>> ref(kN / 2 + 1);
+    std::vector<int16_t> samples(kN);
+    for (std::size_t b = 0; b < kBatch; ++b) {
+        for (std::size_t m = 0; m < kN / 2; ++m) {
+            packed[m * kBatch + b] = {static_cast<float>(sample_at(b, 2 * m)), static_cast<float>(sample_at(b, 2 * m + 1))};
+        }
+    }
+    fft_real_batch(plan, packed.data(), kN, kBatch);
+    for (std::size_t b = 0; b < kBatch; ++b) {
+        for (std::size_t i = 0; i < kN; ++i) {
+            samples[i] = sample_at(b, i);
+        }
+        fft_real(plan, samples.data(), kN, kN, ref.data());
+        for (std::size_t k = 0; k <= kN / 2; ++k) {
+            assert(packed[k * kBatch + b] == ref[k]);
+        }
+    }
+}
+
+static void test_score_matches_single() {
+    constexpr std::size_t kWindows = 37; // not a multiple of the batch size
+    std::vector<RFSampleWindow> windows(kWindows);
+    for (std::size_t w = 0; w < kWindows; ++w) {
+        windows[w].timestamp_ms = static_cast<uint32_t>(1000 + w);
+        windows[w].center_freq_hz = 915000000;
+        windows[w].sample_count = kMaxRfSamples;
+        for (std::size_t i = 0; i < kMaxRfSamples; ++i) {
+            windows[w].samples[i] = sample_at(w, i);
+        }
+    }
+    windows[3].sample_count = 0;
+    windows[5].sample_count = 2 * kMaxRfSamples; // past the array: clamped like the single-window path
+
+    RfBatchWorkspace ws;
+    const bool ok = rf_batch_init(ws, kMaxRfSamples, 8);
+    assert(ok);
+    (void)ok;
+    std::vector<RFEvent> events(kWindows);
+    const std::size_t written = rf_batch_score(ws, windows.data(), kWindows, events.data());
+    assert(written == kWindows);
+    (void)written;
+
+    init_model_inference();
+    set_rf_feature_backend(RfFeatureBackend::RealFft);
+    for (std::size_t w = 0; w < kWindows; ++w) {
+        const RfFeatures ref = extract_rf_features(windows[w]);
+        assert(events[w].timestamp_ms == windows[w].timestamp_ms);
+        assert(events[w].center_freq_hz == windows[w].center_freq_hz);
+        assert(std::fabs(events[w].features.avg_dbm - ref.avg_dbm) < 1e-4f);
+        assert(std::fabs(events[w].features.peak_dbm - ref.peak_dbm) < 1e-4f);
+        RfFeatureVector vec{};
+        extract_rf_feature_vector(windows[w], vec);
+        assert(std::fabs(events[w].anomaly_score - run_model_inference(vec)) < 1e-5f);
+        (void)ref;
+    }
+
+    // A second workspace does not disturb the first (no shared state).
+    RfBatchWorkspace other;
+    rf_batch_init(other, 256, 3);
+    std::vector<RFEvent> again(kWindows);
+    rf_batch_score(other, windows.data(), kWindows, again.data());
+    // At kFeatureFftSize the summary spectra double as model input.
+    for (std::size_t w = 0; w < kWindows; ++w) {
+        assert(std::fabs(again[w].anomaly_score - events[w].anomaly_score) < 1e-5f);
+    }
+    rf_batch_score(ws, windows.data(), kWindows, again.data());
+    for (std::size_t w = 0; w < kWindows; ++w) {
+        assert(again[w].features.peak_dbm == events[w].features.peak_dbm);
+    }
+}
+
+static void test_autoencoder_batch_matches_single() {
+    constexpr std::size_t kBatch = 7; // exercises the 4-wide tile and the tail
+    std::vector<float> features(kBatch * kAutoencoderInputs);
+    for (std::size_t i = 0; i < features.size(); ++i) {
+        features[i] = static_cast<float>((i * 2654435761u) >> 24) / 255.0f;
+    }
+    std::vector<int8_t> scratch(autoencoder_batch_scratch_bytes(kBatch));
+    std::vector<float> mse(kBatch);
+    autoencoder_reconstruction_error_batch(features.data(), kBatch, scratch.data(), mse.data());
+    for (std::size_t b = 0; b < kBatch; ++b) {
+        assert(mse[b] == autoencoder_reconstruction_error(features.data() + b * kAutoencoderInputs));
+    }
+}
+
+int main() {
+    test_fft_batch_matches_single();
+    test_score_matches_single();
+    test_autoencoder_batch_matches_single();
+    std::puts("test_rf_batch passed");
+    return 0;
+}
@@ -0,0 +1,155 @@
+#include "stft.hpp"
+
+#include <cassert>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+constexpr double kPi = 3.14159265358979323846;
+
+struct Capture {
+    std::vector<uint32_t> indices;
+    std::vector<float> peaks;
+    std::vector<std::size_t> peak_bins;
+    std::size_t bin_count = 0;
+};
+
+static void capture_frame(const StftFrame& frame, void* ctx) {
+    auto* cap = static_cast<Capture*>(ctx);
+    std::size_t peak_bin = 0;
+    for (std::size_t k = 1; k < frame.bin_count; ++k) {
+        if (frame.magnitudes[k] > frame.magnitudes[peak_bin]) {
+            peak_bin = k;
+        }
+    }
+    cap->indices.push_back(frame.index);
+    cap->peaks.push_back(frame.stats.max);
+    cap->peak_bins.push_back(peak_bin);
+    cap->bin_count = frame.bin_count;
+}
+
+static std::vector<int16_t> tone(std::size_t count, double bin, std::size_t n, double amp) {
+    std::vector<int16_t> out(count);
+    for (std::size_t i = 0; i < count; ++i) {
+        out[i] = static_cast<int16_t>(std::lround(amp * std::cos(2.0 * kPi * bin * static_cast<double>(i) / n)));
+    }
+    return out;
+}
+
+static void test_window_tables() {
+    std::vector<float> w(64);
+    build_window_table(WindowFunction::Hann, w.data(), w.size());
+    assert(w[0] == 0.0f);
+    assert(std::fabs(w[32] - 1.0f) < 1e-6f);
+    // Periodic Hann: symmetric about n/2 and sums to n/2.
+    double sum = 0.0;
+    for (std::size_t i = 0; i < w.size(); ++i) {
+        sum += w[i];
+        if (i > 0) {
+            assert(std::fabs(w[i] - w[w.size() - i]) < 1e-6f);
+        }
+    }
+    assert(std::fabs(sum - 32.0) < 1e-4);
+    (void)sum;
+
+    build_window_table(WindowFunction::Rectangular, w.data(), w.size());
+    for (float v : w) {
+        assert(v == 1.0f);
+        (void)v;
+    }
+}
+
+static void test_frame_cadence() {
+    StftState st;
+    const bool ok = stft_init(st, StftConfig{64, 16, WindowFunction::Hann});
+    assert(ok);
+    (void)ok;
+
+    const auto samples = tone(256, 8.0, 64, 1000.0);
+    Capture cap;
+    // Push in uneven chunks: frame emission must not depend on chunking.
+    std::size_t emitted = 0;
+    emitted += stft_push(st, samples.data(), 10, 0, capture_frame, &cap);
+    emitted += stft_push(st, samples.data() + 10, 100, 1, capture_frame, &cap);
+    emitted += stft_push(st, samples.data() + 110, 146, 2, capture_frame, &cap);
+    // First frame after 64 samples, then one per 16-sample hop.
+    assert(emitted == 1 + (256 - 64) / 16);
+    assert(cap.indices.size() == emitted);
+    assert(cap.bin_count == 33);
+    for (std::size_t i = 0; i < cap.indices.size(); ++i) {
+        assert(cap.indices[i] == i);
+        assert(cap.peak_bins[i] == 8);
+    }
+    (void)emitted;
+}
+
+static void test_amplitude_normalization() {
+    // Window-gain normalization makes a bin-centred tone read amplitude/2 for every window.
+    const WindowFunction fns[] = {WindowFunction::Rectangular, WindowFunction::Hann, WindowFunction::Hamming,
+                                  WindowFunction::Blackman};
+    for (WindowFunction fn : fns) {
+        StftState st;
+        const bool ok = stft_init(st, StftConfig{128, 64, fn});
+        assert(ok);
+        (void)ok;
+        const auto samples = tone(128, 16.0, 128, 2000.0);
+        Capture cap;
+        stft_push(st, samples.data(), samples.size(), 0, capture_frame, &cap);
+        assert(cap.peaks.size() == 1);
+        assert(std::fabs(cap.peaks[0] - 1000.0f) < 1.0f);
+    }
+}
+
+static void test_window_reduces_leakage() {
+    // Off-bin tone: Hann sidelobes far from the peak must sit well below rectangular leakage.
+    const auto samples = tone(128, 20.5, 128, 2000.0);
+    float far_leak[2] = {0.0f, 0.0f};
+    const WindowFunction fns[] = {WindowFunction::Rectangular, WindowFunction::Hann};
+    for (int w = 0; w < 2; ++w) {
+        StftState st;
+        const bool ok = stft_init(st, StftConfig{128, 128, fns[w]});
+        assert(ok);
+        (void)ok;
+        struct Ctx {
+            float leak;
+        } ctx{0.0f};
+        stft_push(st, samples.data(), samples.size(), 0,
+                  [](const StftFrame& f, void* c) {
+                      static_cast<Ctx*>(c)->leak = f.magnitudes[50] / f.stats.max;
+                  },
+                  &ctx);
+        far_leak[w] = ctx.leak;
+    }
+    assert(far_leak[1] * 100.0f < far_leak[0]);
+    (void)far_leak;
+}
+
+static void test_reset() {
+    StftState st;
+    bool ok = stft_init(st, StftConfig{32, 8, WindowFunction::Hann});
+    assert(ok);
+    (void)ok;
+    const auto samples = tone(40, 4.0, 32, 500.0);
+    std::size_t n = stft_push(st, samples.data(), samples.size(), 0, nullptr, nullptr);
+    assert(n == 2);
+    stft_reset(st);
+    n = stft_push(st, samples.data(), 31, 0, nullptr, nullptr);
+    assert(n == 0);
+    (void)n;
+
+    StftState bad;
+    ok = stft_init(bad, StftConfig{48, 16, WindowFunction::Hann});
+    assert(!ok);
+    ok = stft_init(bad, StftConfig{64, 0, WindowFunction::Hann});
+    assert(!ok);
+}
+
+int main() {
+    test_window_tables();
+    test_frame_cadence();
+    test_amplitude_normalization();
+    test_window_reduces_leakage();
+    test_reset();
+    std::puts("test_stft passed");
+    return 0;
+}
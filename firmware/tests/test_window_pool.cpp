@@ -0,0 +1,58 @@
+#include "window_pool.hpp"
+
+#include <array>
+#include <cassert>
+#include <cstdio>
+
+int main() {
+    assert(window_pool_get(kNoWindow) == nullptr);
+
+    // Every window can be claimed once; the next acquire reports exhaustion.
+    std::array<WindowHandle, kWindowPoolSize> handles{};
+    for (std::size_t i = 0; i < kWindowPoolSize; ++i) {
+        handles[i] = window_pool_acquire();
+        assert(handles[i] != kNoWindow);
+        assert(window_pool_refcount(handles[i]) == 1);
+        window_pool_get(handles[i])->samples[0] = static_cast<int16_t>(i);
+    }
+    WindowHandle extra = window_pool_acquire();
+    assert(extra == kNoWindow);
+    WindowPoolStats stats = window_pool_stats();
+    assert(stats.in_use == kWindowPoolSize);
+    assert(stats.high_water == kWindowPoolSize);
+    assert(stats.exhausted == 1);
+
+    // A shared window stays claimed until the last holder releases it, and
+    // every holder sees the same storage.
+    const WindowHandle shared = handles[3];
+    RfWindow* before = window_pool_get(shared);
+    window_pool_retain(shared);
+    assert(window_pool_refcount(shared) == 2);
+    window_pool_release(shared);
+    extra = window_pool_acquire();
+    assert(extra == kNoWindow);
+    assert(window_pool_get(shared) == before);
+    assert(before->samples[0] == 3);
+    window_pool_release(shared);
+    assert(window_pool_refcount(shared) == 0);
+
+    // The freed window is the one handed out next.
+    const WindowHandle again = window_pool_acquire();
+    assert(again == shared);
+    assert(window_pool_get(again) == before);
+    handles[3] = again;
+
+    for (WindowHandle h : handles) {
+        window_pool_release(h);
+    }
+    stats = window_pool_stats();
+    assert(stats.in_use == 0);
+    assert(stats.high_water == kWindowPoolSize);
+    assert(stats.exhausted == 2);
+    (void)stats;
+    (void)before;
+    (void)extra;
+
+    std::printf("window pool tests passed\n");
+    return 0;
+}
@@ -0,0 +1,149 @@
+#include "adc.hpp"
+#include "fft.hpp"
+#include "model_inference.hpp"
+#include "window_pool.hpp"
+#include "window_profile.hpp"
+
+#include <cassert>
+#include <cmath>
+#include <complex>
+#include <cstdio>
+#include <vector>
+
+namespace {
+std::vector<int16_t> tone(std::size_t n, std::size_t bin) {
+    std::vector<int16_t> v(n);
+    for (std::size_t i = 0; i < n; ++i) {
+        const double phase = 6.283185307179586 * static_cast<double>(bin * i) / static_cast<double>(n);
+        v[i] = static_cast<int16_t>(std::lround(1000.0 * std::sin(phase)) + static_cast<long>(i % 7));
+    }
+    return v;
+}
+
+// Every specialization matches the generic plan-based transform and scales
+// its RAM with the window length.
+void test_specializations() {
+    std::size_t prev_bytes = 0;
+    for (std::size_t n = kMinWindowSamples; n <= kMaxWindowSamples; n <<= 1) {
+        const bool ok = window_profile_select(n);
+        assert(ok);
+        (void)ok;
+        const WindowProfile& p = window_profile();
+        assert(p.samples == n);
+        assert(p.bins == n / 2 + 1);
+        assert(prev_bytes == 0 || (p.bytes > prev_bytes * 3 / 2 && p.bytes < prev_bytes * 5 / 2));
+        prev_bytes = p.bytes;
+        (void)prev_bytes;
+        for (std::size_t i = 0; i < kWindowPoolSize; ++i) {
+            assert(window_profile_samples(i) != nullptr);
+        }
+
+        const std::vector<int16_t> x = tone(n, n / 8);
+        FftPlan plan;
+        fft_plan_init(plan, n);
+        std::vector<std::complex<float>> spectrum(n / 2 + 1);
+        std::vector<float> ref(n / 2 + 1);
+        fft_real(plan, x.data(), n, n, spectrum.data());
+        const MagnitudeStats expect = dsp_magnitude_stats(spectrum.data(), ref.size(), 1.0f / static_cast<float>(n),
+                                                          ref.data());
+        const float* mags = nullptr;
+        const MagnitudeStats got = window_profile_spectrum(x.data(), &mags);
+        assert(mags != nullptr);
+        assert(got.max == expect.max);
+        assert(std::fabs(got.sum - expect.sum) <= 1e-5f * expect.sum);
+        for (std::size_t k = 0; k < ref.size(); ++k) {
+            assert(mags[k] == ref[k]);
+        }
+        (void)got;
+        (void)expect;
+        std::printf("profile %4zu: %6zu bytes\n", n, p.bytes);
+    }
+}
+
+void test_rounding_and_config() {
+    bool ok = window_profile_select(100);
+    assert(ok && window_profile().samples == 128);
+    ok = window_profile_select(8);
+    assert(ok && window_profile().samples == kMinWindowSamples);
+    ok = window_profile_select(100000);
+    assert(ok && window_profile().samples == kMaxWindowSamples);
+
+    NodeConfig cfg = load_config();
+    cfg.fft_size = 512;
+    init_model_inference(cfg);
+    assert(window_profile().samples == 512);
+
+    // Full windows take the specialized path and agree with the generic one.
+    const std::vector<int16_t> x = tone(512, 40);
+    const RfFeatures fast = extract_rf_features(x.data(), x.size());
+    set_rf_feature_backend(RfFeatureBackend::ComplexFft);
+    const RfFeatures generic = extract_rf_features(x.data(), x.size());
+    set_rf_feature_backend(RfFeatureBackend::RealFft);
+    assert(std::fabs(fast.peak_dbm - generic.peak_dbm) < 1e-3f);
+    assert(std::fabs(fast.avg_dbm - generic.avg_dbm) < 1e-3f);
+
+    // Raw buffers past the largest plan get empty features, not the previous spectrum.
+    const std::vector<int16_t> big = tone(kMaxFftSize + 1, 40);
+    const RfFeatures real_big = extract_rf_features(big.data(), big.size());
+    set_rf_feature_backend(RfFeatureBackend::ComplexFft);
+    const RfFeatures complex_big = extract_rf_features(big.data(), big.size());
+    set_rf_feature_backend(RfFeatureBackend::RealFft);
+    assert(real_big.peak_dbm == 0.0f && real_big.avg_dbm == 0.0f);
+    assert(complex_big.peak_dbm == 0.0f && complex_big.avg_dbm == 0.0f);
+    (void)ok;
+    (void)fast;
+    (void)generic;
+    (void)real_big;
+    (void)complex_big;
+}
+
+// A held window pins the profile; capture emits windows of the profile length.
+void test_capture_follows_profile() {
+    bool ok = window_profile_select(256);
+    assert(ok);
+    AdcCaptureConfig cfg{};
+    cfg.start_producer = false;
+    ok = adc_capture_start(cfg);
+    assert(ok);
+
+    const std::vector<int16_t> x = tone(256, 3);
+    adc_capture_ingest(x.data(), 200);
+    assert(!adc_capture_pending());
+    adc_capture_ingest(x.data() + 200, 56);
+    const WindowHandle h = adc_capture_take_handle();
+    assert(h != kNoWindow);
+    const RfWindow* w = window_pool_get(h);
+    assert(w->sample_count == 256);
+    assert(w->samples[255] == x[255]);
+
+    ok = window_profile_select(1024);
+    assert(!ok && window_profile().samples == 256);
+    // init_model_inference reports the failure and sizes the DSP to the
+    // windows capture still produces: bin 300 only exists at 1024 points.
+    NodeConfig cfg1024 = load_config();
+    cfg1024.fft_size = 1024;
+    cfg1024.watch_bins = {300, 0, 0, 0, 0, 0, 0, 0};
+    cfg1024.watch_bin_count = 1;
+    ok = init_model_inference(cfg1024);
+    assert(!ok && window_profile().samples == 256 && rf_feature_backend() == RfFeatureBackend::RealFft);
+    window_pool_release(h);
+    adc_capture_stop();
+    ok = window_profile_select(1024);
+    assert(ok && window_profile().samples == 1024);
+    // Windows acquired after the switch point into the new storage.
+    const WindowHandle next = window_pool_acquire();
+    assert(next != kNoWindow && window_pool_get(next)->samples == window_profile_samples(next));
+    window_pool_release(next);
+    (void)ok;
+    (void)w;
+    (void)next;
+}
+} // namespace
+
+int main() {
+    test_specializations();
+    test_rounding_and_config();
+    test_capture_follows_profile();
+    std::printf("window profile tests passed\n");
+    return 0;
+}